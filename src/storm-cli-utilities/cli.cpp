@@ -8,6 +8,8 @@
 #include "storm/utility/initialize.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/simd.h"
+#include "storm/settings/modules/MultiplierSettings.h"
 
 #include <type_traits>
 #include <ctime>
@@ -237,10 +239,17 @@ namespace storm {
             }
         }
         
+        void setVectorInstructionSet() {
+            if (storm::settings::hasModule<storm::settings::modules::MultiplierSettings>()) {
+                storm::utility::simd::setInstructionSet(storm::settings::getModule<storm::settings::modules::MultiplierSettings>().getSimdInstructionSet());
+            }
+        }
+        
         void setUrgentOptions() {
             setResourceLimits();
             setLogLevel();
             setFileLogging();
+            setVectorInstructionSet();
             // Set output precision
             storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
         }
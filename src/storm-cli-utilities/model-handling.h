@@ -14,6 +14,7 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include <type_traits>
 
@@ -460,6 +461,10 @@ namespace storm {
                 options.setAddOverlappingGuardsLabel(true);
             }
 
+            if (buildSettings.isBytecodeExpressionsSet()) {
+                options.setUseBytecodeExpressions(true);
+            }
+
             return storm::api::buildSparseModel<ValueType>(input.model.get(), options, useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
         }
         
@@ -472,6 +477,8 @@ namespace storm {
                 storm::parser::DirectEncodingParserOptions options;
                 options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
                 result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+            } else if (ioSettings.isExplicitBinarySet()) {
+                result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
             } else {
                 STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
                 result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -492,8 +499,8 @@ namespace storm {
                 } else if (builderType == storm::builder::BuilderType::Explicit || builderType == storm::builder::BuilderType::Jit) {
                     result = buildModelSparse<ValueType>(input, buildSettings, builderType == storm::builder::BuilderType::Jit);
                 }
-            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
-                STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
+            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
+                STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse || mpi.engine == storm::utility::Engine::Statistical, storm::exceptions::InvalidSettingsException, "Can only use sparse or statistical engine with explicit input.");
                 result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
             }
             
@@ -579,6 +586,10 @@ namespace storm {
                 storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>(), !ioSettings.isExplicitExportPlaceholdersDisabled());
             }
 
+            if (ioSettings.isExportBinarySet()) {
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBinaryFilename());
+            }
+
             if (ioSettings.isExportDdSet()) {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in drdd format is only supported for DDs.");
             }
@@ -596,6 +607,10 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in drn format is only supported for sparse models.");
             }
 
+            if (ioSettings.isExportBinarySet()) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting in binary format is only supported for sparse models.");
+            }
+
             if (ioSettings.isExportDdSet()) {
                 storm::api::exportSparseModelAsDrdd(model, ioSettings.getExportDdFilename());
             }
@@ -841,7 +856,7 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void printResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::jani::Property const& property, storm::utility::Stopwatch* watch = nullptr) {
+        void printResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::jani::Property const& property, storm::utility::Stopwatch const* watch = nullptr) {
             if (result) {
                 std::stringstream ss;
                 ss << "'" << *property.getFilter().getStatesFormula() << "'";
@@ -861,42 +876,100 @@ namespace storm {
             }
         };
         
+        /*!
+         * The outcome of checking a single property. Messages are collected such that they can be reported together
+         * with the result, which matters if several properties are checked concurrently.
+         */
+        struct PropertyCheckOutcome {
+            std::unique_ptr<storm::modelchecker::CheckResult> result;
+            bool ignored = false;
+            std::string warning;
+            // The console log output emitted while checking the property (only captured for concurrent checks).
+            std::string log;
+            storm::utility::Stopwatch watch;
+        };
+        
         template<typename ValueType>
-        void verifyProperties(SymbolicInput const& input, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
-            auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
-            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
-            for (auto const& property : properties) {
-                printModelCheckingProperty(property);
-                bool ignored = false;
-                storm::utility::Stopwatch watch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result;
-                try {
-                    auto rawFormula = property.getRawFormula();
-                    if (transformationSettings.isChainEliminationSet() &&
-                        !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
-                        STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
-                        ignored = true;
-                    } else if (transformationSettings.isToDiscreteTimeModelSet()) {
-                        auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
-                        auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
-                        if (propertyFormula && filterFormula) {
-                            result = verificationCallback(propertyFormula, filterFormula);
-                        } else {
-                            ignored = true;
-                        }
+        PropertyCheckOutcome checkProperty(storm::jani::Property const& property, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback) {
+            auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+            PropertyCheckOutcome outcome;
+            outcome.watch.start();
+            try {
+                auto rawFormula = property.getRawFormula();
+                if (transformationSettings.isChainEliminationSet() &&
+                    !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
+                    outcome.warning = "Property is not preserved by elimination of non-markovian states.";
+                    outcome.ignored = true;
+                } else if (transformationSettings.isToDiscreteTimeModelSet()) {
+                    auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
+                    auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
+                    if (propertyFormula && filterFormula) {
+                        outcome.result = verificationCallback(propertyFormula, filterFormula);
                     } else {
-                        result = verificationCallback(property.getRawFormula(),
-                                                      property.getFilter().getStatesFormula());
+                        outcome.ignored = true;
                     }
-                } catch (storm::exceptions::BaseException const& ex) {
-                    STORM_LOG_WARN("Cannot handle property: " << ex.what());
+                } else {
+                    outcome.result = verificationCallback(property.getRawFormula(),
+                                                          property.getFilter().getStatesFormula());
                 }
-                watch.stop();
-                if (!ignored) {
-                    postprocessingCallback(result);
-                    printResult<ValueType>(result, property, &watch);
+            } catch (storm::exceptions::BaseException const& ex) {
+                outcome.warning = std::string("Cannot handle property: ") + ex.what();
+            }
+            outcome.watch.stop();
+            return outcome;
+        }
+        
+        template<typename ValueType>
+        void reportPropertyCheckOutcome(storm::jani::Property const& property, PropertyCheckOutcome const& outcome, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback) {
+            STORM_LOG_WARN_COND(outcome.warning.empty(), outcome.warning);
+            if (!outcome.ignored) {
+                postprocessingCallback(outcome.result);
+                printResult<ValueType>(outcome.result, property, &outcome.watch);
+            }
+        }
+        
+        /*!
+         * Checks the given properties using the given callback.
+         *
+         * @param numberOfThreads If this is not one, the properties are checked concurrently by the given number of
+         * threads (zero refers to the number of hardware threads). This requires the verification callback to be
+         * safe to call concurrently. The postprocessing callback and the output are still processed in the order of
+         * the properties, where the console log output of each check is printed below the header of its property.
+         * Output that is written to std::cout directly while checking is not reordered.
+         * Properties with exact or parametric values are always checked sequentially.
+         */
+        template<typename ValueType>
+        void verifyProperties(SymbolicInput const& input, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity(), uint64_t numberOfThreads = 1) {
+            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            if (storm::NumberTraits<ValueType>::IsExact) {
+                STORM_LOG_WARN_COND(numberOfThreads == 1, "Properties with exact or parametric values are checked sequentially.");
+                numberOfThreads = 1;
+            }
+            numberOfThreads = std::min<uint64_t>(storm::utility::parallel::getNumberOfThreads(numberOfThreads), properties.size());
+            if (numberOfThreads <= 1) {
+                for (auto const& property : properties) {
+                    printModelCheckingProperty(property);
+                    PropertyCheckOutcome outcome = checkProperty<ValueType>(property, verificationCallback);
+                    reportPropertyCheckOutcome<ValueType>(property, outcome, postprocessingCallback);
                 }
+                return;
             }
+            
+            STORM_LOG_INFO("Checking " << properties.size() << " properties using " << numberOfThreads << " threads.");
+            std::vector<PropertyCheckOutcome> outcomes(properties.size());
+            storm::utility::parallel::processInOrder(numberOfThreads, properties.size(), [&] (uint64_t index) {
+                std::string log;
+                {
+                    storm::utility::ConsoleLogCapture capture(log);
+                    outcomes[index] = checkProperty<ValueType>(properties[index], verificationCallback);
+                }
+                outcomes[index].log = std::move(log);
+            }, [&] (uint64_t index) {
+                printModelCheckingProperty(properties[index]);
+                STORM_PRINT(outcomes[index].log);
+                reportPropertyCheckOutcome<ValueType>(properties[index], outcomes[index], postprocessingCallback);
+                outcomes[index].result.reset();
+            });
         }
         
         std::vector<storm::expressions::Expression> parseConstraints(storm::expressions::ExpressionManager const& expressionManager, std::string const& constraintsString) {
@@ -991,23 +1064,70 @@ namespace storm {
             });
         }
         
+        /*!
+         * Checks each (time-bounded reachability) property for all of the given time bounds at once and prints the
+         * resulting curve.
+         */
+        template <typename ValueType>
+        void verifyPropertiesForTimeBounds(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, SymbolicInput const& input, ModelProcessingInformation const& mpi, std::vector<double> const& timeBounds) {
+            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            for (auto const& property : properties) {
+                printModelCheckingProperty(property);
+                storm::utility::Stopwatch watch(true);
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+                try {
+                    auto const& states = property.getFilter().getStatesFormula();
+                    bool filterForInitialStates = states->isInitialFormula();
+                    results = storm::api::verifyWithSparseEngineForTimeBounds<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(property.getRawFormula(), filterForInitialStates), timeBounds);
+                    
+                    std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                    if (filterForInitialStates) {
+                        filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+                    } else {
+                        filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+                    }
+                    for (auto& result : results) {
+                        if (result && filter) {
+                            result->filter(filter->asQualitativeCheckResult());
+                        }
+                    }
+                } catch (storm::exceptions::BaseException const& ex) {
+                    STORM_LOG_WARN("Cannot handle property: " << ex.what());
+                    continue;
+                }
+                watch.stop();
+                for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                    STORM_PRINT("Result for time bound " << timeBounds[boundIndex] << ": ");
+                    printFilteredResult<ValueType>(results[boundIndex], property.getFilter().getFilterType());
+                }
+                STORM_PRINT("Time for model checking: " << watch << "." << std::endl);
+            }
+        }
+        
         template <typename ValueType>
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
             auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             auto verificationCallback = [&sparseModel,&ioSettings,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                                            // Each check gets its own environment as properties might be checked concurrently.
+                                            storm::Environment env = mpi.env;
                                             bool filterForInitialStates = states->isInitialFormula();
                                             auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
                                             if (ioSettings.isExportSchedulerSet()) {
                                                 task.setProduceSchedulers(true);
                                             }
-                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+                                            std::unique_ptr<storm::modelchecker::CheckResult> result;
+                                            if (mpi.engine == storm::utility::Engine::Statistical) {
+                                                result = storm::api::verifyWithStatisticalEngine<ValueType>(env, sparseModel, task);
+                                            } else {
+                                                result = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, task);
+                                            }
                                             
                                             std::unique_ptr<storm::modelchecker::CheckResult> filter;
                                             if (filterForInitialStates) {
                                                 filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
                                             } else {
-                                                filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+                                                filter = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, storm::api::createTask<ValueType>(states, false));
                                             }
                                             if (result && filter) {
                                                 result->filter(filter->asQualitativeCheckResult());
@@ -1042,7 +1162,20 @@ namespace storm {
                                             }
                                             ++exportCount;
                                         };
-            verifyProperties<ValueType>(input,verificationCallback, postprocessingCallback);
+            uint64_t numberOfPropertyThreads = 1;
+            boost::optional<std::vector<double>> timeBounds;
+            if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()) {
+                auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+                numberOfPropertyThreads = modelCheckerSettings.getNumberOfPropertyThreads();
+                if (modelCheckerSettings.isTimeBoundsSet() && mpi.engine != storm::utility::Engine::Statistical) {
+                    timeBounds = modelCheckerSettings.getTimeBounds();
+                }
+            }
+            if (timeBounds) {
+                verifyPropertiesForTimeBounds<ValueType>(sparseModel, input, mpi, timeBounds.get());
+            } else {
+                verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback, numberOfPropertyThreads);
+            }
             if (ioSettings.isComputeSteadyStateDistributionSet()) {
                 storm::utility::Stopwatch watch(true);
                 std::unique_ptr<storm::modelchecker::CheckResult> result;
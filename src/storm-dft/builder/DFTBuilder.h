@@ -1,4 +1,5 @@
 #pragma  once
+#include <atomic>
 #include <iostream>
 #include <unordered_map>
 #include <map>
@@ -33,7 +34,7 @@ namespace storm {
 
         private:
             std::size_t mNextId = 0;
-            static std::size_t mUniqueOffset;
+            static std::atomic<std::size_t> mUniqueOffset;
             std::string mTopLevelIdentifier;
             std::unordered_map<std::string, DFTElementPointer> mElements;
             std::unordered_map<DFTElementPointer, std::vector<std::string>> mChildNames;
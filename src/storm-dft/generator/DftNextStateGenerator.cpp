@@ -139,7 +139,7 @@ namespace storm {
                 STORM_LOG_ASSERT((dependency != nullptr) == exploreDependencies, "Failure due to dependencies does not match.");
 
                 // Obtain successor state by propagating failure
-                DFTStatePointer newState = createSuccessorState(state, nextBE, dependency);
+                DFTStatePointer const& newState = createSuccessorStateInBuffer(nextBE, dependency);
 
                 if(newState->isInvalid() || newState->isTransient()) {
                     STORM_LOG_TRACE("State is ignored because " << (newState->isInvalid() ? "it is invalid" : "the transient fault is ignored"));
@@ -154,6 +154,7 @@ namespace storm {
                 } else {
                     // Add new state
                     newStateId = stateToIdCallback(newState);
+                    releaseSuccessorState();
                 }
 
                 // Set transitions
@@ -165,9 +166,10 @@ namespace storm {
 
                     if (!storm::utility::isOne(probability)) {
                         // Add transition to state where dependency was unsuccessful
-                        DFTStatePointer unsuccessfulState = createSuccessorState(state, nextBE, dependency, false);
+                        DFTStatePointer const& unsuccessfulState = createSuccessorStateInBuffer(nextBE, dependency, false);
                         // Add state
                         StateType unsuccessfulStateId = stateToIdCallback(unsuccessfulState);
+                        releaseSuccessorState();
                         ValueType remainingProbability = storm::utility::one<ValueType>() - probability;
                         choice.addProbability(unsuccessfulStateId, remainingProbability);
                         STORM_LOG_TRACE("Added transition to " << unsuccessfulStateId << " with remaining probability " << remainingProbability);
@@ -220,25 +222,50 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(DFTStatePointer const state, std::shared_ptr<storm::storage::DFTBE<ValueType> const>& failedBE, std::shared_ptr<storm::storage::DFTDependency<ValueType> const>& triggeringDependency, bool dependencySuccessful) const {
+        typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(DFTStatePointer const& state, std::shared_ptr<storm::storage::DFTBE<ValueType> const>& failedBE, std::shared_ptr<storm::storage::DFTDependency<ValueType> const>& triggeringDependency, bool dependencySuccessful) const {
             // Construct new state as copy from original one
             DFTStatePointer newState = state->copy();
+            storm::storage::DFTStateSpaceGenerationQueues<ValueType> queues;
+            applyFailure(newState, failedBE, triggeringDependency, dependencySuccessful, queues);
+            return newState;
+        }
+
+        template<typename ValueType, typename StateType>
+        typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer const& DftNextStateGenerator<ValueType, StateType>::createSuccessorStateInBuffer(std::shared_ptr<storm::storage::DFTBE<ValueType> const>& failedBE, std::shared_ptr<storm::storage::DFTDependency<ValueType> const>& triggeringDependency, bool dependencySuccessful) {
+            if (successorState) {
+                successorState->copyFrom(*state);
+            } else {
+                successorState = state->copy();
+            }
+            applyFailure(successorState, failedBE, triggeringDependency, dependencySuccessful, successorQueues);
+            return successorState;
+        }
 
+        template<typename ValueType, typename StateType>
+        void DftNextStateGenerator<ValueType, StateType>::releaseSuccessorState() {
+            // A new state is kept by the callback, so it must not be overwritten by the next successor.
+            if (successorState.use_count() > 1) {
+                successorState = nullptr;
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void DftNextStateGenerator<ValueType, StateType>::applyFailure(DFTStatePointer const& newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const>& failedBE, std::shared_ptr<storm::storage::DFTDependency<ValueType> const>& triggeringDependency, bool dependencySuccessful, storm::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
             if (!dependencySuccessful) {
                 // Dependency was unsuccessful -> no BE fails
                 STORM_LOG_ASSERT(triggeringDependency != nullptr, "Dependency is not given");
-                STORM_LOG_TRACE("With the unsuccessful triggering of PDEP " << triggeringDependency->name() << " [" << triggeringDependency->id() << "]" << " in " << mDft.getStateString(state));
+                STORM_LOG_TRACE("With the unsuccessful triggering of PDEP " << triggeringDependency->name() << " [" << triggeringDependency->id() << "]" << " in " << mDft.getStateString(newState));
                 newState->letDependencyBeUnsuccessful(triggeringDependency);
-                return newState;
+                return;
             }
 
 
-            STORM_LOG_TRACE("With the failure of " << failedBE->name() << " [" << failedBE->id() << "]" << (triggeringDependency != nullptr ? " (through dependency " + triggeringDependency->name() + " [" + std::to_string(triggeringDependency->id()) + ")]" : "") << " in " << mDft.getStateString(state));
+            STORM_LOG_TRACE("With the failure of " << failedBE->name() << " [" << failedBE->id() << "]" << (triggeringDependency != nullptr ? " (through dependency " + triggeringDependency->name() + " [" + std::to_string(triggeringDependency->id()) + ")]" : "") << " in " << mDft.getStateString(newState));
 
             newState->letBEFail(failedBE, triggeringDependency);
 
             // Propagate
-            storm::storage::DFTStateSpaceGenerationQueues<ValueType> queues;
+            queues.clear();
             propagateFailure(newState, failedBE, queues);
 
             // Check whether transient failure lead to TLE failure
@@ -265,15 +292,14 @@ namespace storm {
                 newState->updateDontCareDependencies(failedBE->id());
                 newState->updateFailableInRestrictions(failedBE->id());
             }
-            return newState;
         }
 
 
         template<typename ValueType, typename StateType>
-        void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePointer newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &nextBE,
+        void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePointer const& newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &nextBE,
                                                                            storm::storage::DFTStateSpaceGenerationQueues<ValueType> &queues) const {
             // Propagate failure
-            for (DFTGatePointer parent : nextBE->parents()) {
+            for (DFTGatePointer const& parent : nextBE->parents()) {
                 if (newState->isOperational(parent->id())) {
                     queues.propagateFailure(parent);
                 }
@@ -287,7 +313,7 @@ namespace storm {
             }
 
             // Check restrictions
-            for (DFTRestrictionPointer restr : nextBE->restrictions()) {
+            for (DFTRestrictionPointer const& restr : nextBE->restrictions()) {
                 queues.checkRestrictionLater(restr);
             }
             // Check restrictions
@@ -300,7 +326,7 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        void DftNextStateGenerator<ValueType, StateType>::propagateFailsafe(DFTStatePointer newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &nextBE,
+        void DftNextStateGenerator<ValueType, StateType>::propagateFailsafe(DFTStatePointer const& newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &nextBE,
                                                                             storm::storage::DFTStateSpaceGenerationQueues<ValueType> &queues) const {
             // Propagate failsafe
             while (!queues.failsafePropagationDone()) {
@@ -66,7 +66,7 @@ namespace storm {
              * 
              * @return Successor state.
              */
-            DFTStatePointer createSuccessorState(DFTStatePointer const state, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &failedBE, std::shared_ptr<storm::storage::DFTDependency<ValueType> const> &triggeringDependency, bool dependencySuccessful = true) const;
+            DFTStatePointer createSuccessorState(DFTStatePointer const& state, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &failedBE, std::shared_ptr<storm::storage::DFTDependency<ValueType> const> &triggeringDependency, bool dependencySuccessful = true) const;
 
             /**
              * Propagate the failures in a given state if the given BE fails
@@ -75,7 +75,7 @@ namespace storm {
              * @param nextBE BE whose failure is propagated
              */
             void
-            propagateFailure(DFTStatePointer newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &nextBE,
+            propagateFailure(DFTStatePointer const& newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &nextBE,
                              storm::storage::DFTStateSpaceGenerationQueues<ValueType> &queues) const;
 
             /**
@@ -85,7 +85,7 @@ namespace storm {
              * @param nextBE BE whose failure is propagated
              */
             void
-            propagateFailsafe(DFTStatePointer newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &nextBE,
+            propagateFailsafe(DFTStatePointer const& newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &nextBE,
                               storm::storage::DFTStateSpaceGenerationQueues<ValueType> &queues) const;
 
         private:
@@ -99,6 +99,31 @@ namespace storm {
              */
             StateBehavior<ValueType, StateType> exploreState(StateToIdCallback const& stateToIdCallback, bool exploreDependencies, bool takeFirstDependency);
 
+            /*!
+             * Let the given BE fail in the given state (in place) and propagate the failure.
+             *
+             * @param newState State to modify.
+             * @param failedBE BE which fails next.
+             * @param triggeringDependency Dependency which triggered the failure (or nullptr if BE failed on its own).
+             * @param dependencySuccessful Whether the triggering dependency was successful.
+             * @param queues Queues used for the propagation. They are cleared before.
+             */
+            void applyFailure(DFTStatePointer const& newState, std::shared_ptr<storm::storage::DFTBE<ValueType> const> &failedBE, std::shared_ptr<storm::storage::DFTDependency<ValueType> const> &triggeringDependency, bool dependencySuccessful, storm::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
+
+            /*!
+             * Same as createSuccessorState but the successor is computed in a buffer that is reused for the next successor unless
+             * releaseSuccessorState() detects that the successor was stored. Thus, successors that already exist do not allocate a new
+             * state (see DFTState::copyFrom() for the remaining allocations).
+             *
+             * @return The successor state (valid until the next call).
+             */
+            DFTStatePointer const& createSuccessorStateInBuffer(std::shared_ptr<storm::storage::DFTBE<ValueType> const> &failedBE, std::shared_ptr<storm::storage::DFTDependency<ValueType> const> &triggeringDependency, bool dependencySuccessful = true);
+
+            /*!
+             * Gives up the successor buffer if the state to id callback stored it.
+             */
+            void releaseSuccessorState();
+
             // The dft used for the generation of next states.
             storm::storage::DFT<ValueType> const& mDft;
 
@@ -108,6 +133,12 @@ namespace storm {
             // Current state
             DFTStatePointer state;
 
+            // Buffer for computing successor states of the current state
+            DFTStatePointer successorState;
+
+            // Queues for the propagation in the successor buffer
+            storm::storage::DFTStateSpaceGenerationQueues<ValueType> successorQueues;
+
             // Flag indicating whether all failed states should be merged into one unique failed state.
             bool uniqueFailedState;
 
@@ -1,5 +1,9 @@
 #include "DFTModelChecker.h"
 
+#include <atomic>
+#include <map>
+#include <sstream>
+
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
@@ -9,6 +13,8 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/models/ModelType.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
@@ -104,50 +110,65 @@ namespace storm {
             // Perform modularisation
             if (dfts.size() > 1) {
                 STORM_LOG_DEBUG("Modularisation of " << dft.getTopLevelGate()->name() << " into " << dfts.size() << " submodules.");
-                // TODO: compute simultaneously
-                dft_results results;
+                property_vector moduleProperties;
                 for (auto property : properties) {
                     if (!property->isProbabilityOperatorFormula()) {
                         STORM_LOG_WARN("Could not check property: " << *property);
                     } else {
-                        // Recursively call model checking
-                        std::vector<ValueType> res;
-                        for (auto const ft : dfts) {
-                            // TODO: allow approximation in modularisation
-                            dft_results ftResults = checkHelper(ft, {property}, symred, true, relevantEvents, allowDCForRelevant, 0.0);
-                            STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
-                            res.push_back(boost::get<ValueType>(ftResults[0]));
-                        }
+                        moduleProperties.push_back(property);
+                    }
+                }
+                if (moduleProperties.empty()) {
+                    return dft_results();
+                }
 
-                        // Combine modularisation results
-                        STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults="
-                                                                      << (invResults ? "On" : "Off"));
-                        ValueType result = storm::utility::zero<ValueType>();
-                        int limK = invResults ? -1 : nrM + 1;
-                        int chK = invResults ? -1 : 1;
-                        for (int cK = nrK; cK != limK; cK += chK) {
-                            STORM_LOG_ASSERT(cK >= 0, "ck negative.");
-                            uint64_t permutation = smallestIntWithNBitsSet(static_cast<uint64_t>(cK));
-                            do {
-                                STORM_LOG_TRACE("Permutation=" << permutation);
-                                ValueType permResult = storm::utility::one<ValueType>();
-                                for (size_t i = 0; i < res.size(); ++i) {
-                                    if (permutation & (1ul << i)) {
-                                        permResult *= res[i];
-                                    } else {
-                                        permResult *= storm::utility::one<ValueType>() - res[i];
-                                    }
+                // Recursively call model checking for each module
+                std::vector<std::vector<ValueType>> moduleResults(dfts.size());
+                auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+                // Exact computations are not thread-safe and all modules would export their model to the same file.
+                if (numberOfThreads != 1 && !storm::NumberTraits<ValueType>::IsExact && !ioSettings.isExportExplicitSet() && !ioSettings.isExportDotSet()) {
+                    checkModulesInParallel(dfts, moduleProperties, symred, relevantEvents, allowDCForRelevant, moduleResults);
+                } else {
+                    for (size_t i = 0; i < dfts.size(); ++i) {
+                        moduleResults[i] = checkModule(dfts[i], moduleProperties, symred, relevantEvents, allowDCForRelevant);
+                    }
+                }
+
+                dft_results results;
+                for (size_t propertyIndex = 0; propertyIndex < moduleProperties.size(); ++propertyIndex) {
+                    std::vector<ValueType> res;
+                    for (auto const& moduleResult : moduleResults) {
+                        res.push_back(moduleResult[propertyIndex]);
+                    }
+
+                    // Combine modularisation results
+                    STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults="
+                                                                  << (invResults ? "On" : "Off"));
+                    ValueType result = storm::utility::zero<ValueType>();
+                    int limK = invResults ? -1 : nrM + 1;
+                    int chK = invResults ? -1 : 1;
+                    for (int cK = nrK; cK != limK; cK += chK) {
+                        STORM_LOG_ASSERT(cK >= 0, "ck negative.");
+                        uint64_t permutation = smallestIntWithNBitsSet(static_cast<uint64_t>(cK));
+                        do {
+                            STORM_LOG_TRACE("Permutation=" << permutation);
+                            ValueType permResult = storm::utility::one<ValueType>();
+                            for (size_t i = 0; i < res.size(); ++i) {
+                                if (permutation & (1ul << i)) {
+                                    permResult *= res[i];
+                                } else {
+                                    permResult *= storm::utility::one<ValueType>() - res[i];
                                 }
-                                STORM_LOG_TRACE("Result for permutation:" << permResult);
-                                permutation = nextBitPermutation(permutation);
-                                result += permResult;
-                            } while (permutation < (1ul << nrM) && permutation != 0);
-                        }
-                        if (invResults) {
-                            result = storm::utility::one<ValueType>() - result;
-                        }
-                        results.push_back(result);
+                            }
+                            STORM_LOG_TRACE("Result for permutation:" << permResult);
+                            permutation = nextBitPermutation(permutation);
+                            result += permResult;
+                        } while (permutation < (1ul << nrM) && permutation != 0);
                     }
+                    if (invResults) {
+                        result = storm::utility::one<ValueType>() - result;
+                    }
+                    results.push_back(result);
                 }
                 return results;
             } else {
@@ -156,6 +177,53 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        std::vector<ValueType> DFTModelChecker<ValueType>::checkModule(storm::storage::DFT<ValueType> const& module, property_vector const& properties, bool symred, storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant) {
+            // TODO: allow approximation in modularisation
+            dft_results moduleResults = checkHelper(module, properties, symred, true, relevantEvents, allowDCForRelevant, 0.0);
+            STORM_LOG_ASSERT(moduleResults.size() == properties.size(), "Wrong number of results");
+            std::vector<ValueType> res;
+            for (auto const& moduleResult : moduleResults) {
+                res.push_back(boost::get<ValueType>(moduleResult));
+            }
+            return res;
+        }
+
+        template<typename ValueType>
+        void DFTModelChecker<ValueType>::checkModulesInParallel(std::vector<storm::storage::DFT<ValueType>> const& modules, property_vector const& properties, bool symred, storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant, std::vector<std::vector<ValueType>>& moduleResults) {
+            uint64_t threads = std::min<uint64_t>(storm::utility::parallel::getNumberOfThreads(numberOfThreads), modules.size());
+            STORM_LOG_DEBUG("Checking " << modules.size() << " modules on " << threads << " threads.");
+            // Each thread uses its own (sequential) checker such that the timings of each thread are recorded separately.
+            std::vector<std::unique_ptr<DFTModelChecker<ValueType>>> threadCheckers;
+            for (uint64_t thread = 0; thread < threads; ++thread) {
+                threadCheckers.push_back(std::make_unique<DFTModelChecker<ValueType>>(false));
+            }
+            std::atomic<uint64_t> nextModule(0);
+            parallelModulesTimer.start();
+            storm::utility::parallel::runOnThreads(threads, [&](uint64_t threadIndex) {
+                DFTModelChecker<ValueType>& threadChecker = *threadCheckers[threadIndex];
+                threadChecker.totalTimer.start();
+                for (uint64_t module = nextModule++; module < modules.size(); module = nextModule++) {
+                    moduleResults[module] = threadChecker.checkModule(modules[module], properties, symred, relevantEvents, allowDCForRelevant);
+                }
+                threadChecker.totalTimer.stop();
+            });
+            parallelModulesTimer.stop();
+
+            // Account for the time spent by each thread
+            if (threadTimers.size() < threads) {
+                threadTimers.resize(threads);
+            }
+            for (uint64_t thread = 0; thread < threads; ++thread) {
+                DFTModelChecker<ValueType> const& threadChecker = *threadCheckers[thread];
+                explorationTimer.add(threadChecker.explorationTimer);
+                buildingTimer.add(threadChecker.buildingTimer);
+                bisimulationTimer.add(threadChecker.bisimulationTimer);
+                modelCheckingTimer.add(threadChecker.modelCheckingTimer);
+                threadTimers[thread].add(threadChecker.totalTimer);
+            }
+        }
+
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>
         DFTModelChecker<ValueType>::buildModelViaComposition(storm::storage::DFT<ValueType> const &dft, property_vector const &properties, bool symred, bool allowModularisation, storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant) {
@@ -447,6 +515,31 @@ namespace storm {
             }
         }
 
+        /*!
+         * Determines whether the given property is of the form P=? [phi U<=t psi] and if so, retrieves a description of
+         * the property without its time bound and the time bound t.
+         */
+        boost::optional<std::string> getTimeBoundedReachabilityDescription(storm::logic::Formula const& formula, double& upperBound) {
+            if (!formula.isProbabilityOperatorFormula() || formula.asProbabilityOperatorFormula().hasBound()) {
+                return boost::none;
+            }
+            storm::logic::ProbabilityOperatorFormula const& operatorFormula = formula.asProbabilityOperatorFormula();
+            if (!operatorFormula.getSubformula().isBoundedUntilFormula()) {
+                return boost::none;
+            }
+            storm::logic::BoundedUntilFormula const& pathFormula = operatorFormula.getSubformula().asBoundedUntilFormula();
+            if (pathFormula.isMultiDimensional() || !pathFormula.getTimeBoundReference().isTimeBound() || pathFormula.hasLowerBound() || !pathFormula.hasUpperBound()) {
+                return boost::none;
+            }
+            upperBound = pathFormula.getNonStrictUpperBound<double>();
+            std::stringstream description;
+            if (operatorFormula.hasOptimalityType()) {
+                description << operatorFormula.getOptimalityType() << " ";
+            }
+            description << pathFormula.getLeftSubformula() << " U " << pathFormula.getRightSubformula();
+            return description.str();
+        }
+
         template<typename ValueType>
         std::vector<ValueType>
         DFTModelChecker<ValueType>::checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>> &model,
@@ -467,11 +560,45 @@ namespace storm {
             // Check the model
             STORM_LOG_DEBUG("Model checking...");
             modelCheckingTimer.start();
-            std::vector<ValueType> results;
+            std::vector<ValueType> results(properties.size(), -storm::utility::one<ValueType>());
+            std::vector<bool> checked(properties.size(), false);
+
+            // Time-bounded reachability properties that only differ in their time bound (as created for several
+            // timepoints) are checked jointly, which needs only a single uniformization run on CTMCs.
+            if (storm::NumberTraits<ValueType>::SupportsExponential && (model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::MarkovAutomaton))) {
+                std::map<std::string, std::vector<uint64_t>> propertyGroups;
+                std::vector<double> upperBounds(properties.size());
+                for (uint64_t i = 0; i < properties.size(); ++i) {
+                    auto description = getTimeBoundedReachabilityDescription(*properties[i], upperBounds[i]);
+                    if (description) {
+                        propertyGroups[description.get()].push_back(i);
+                    }
+                }
+                for (auto const& group : propertyGroups) {
+                    if (group.second.size() < 2) {
+                        continue;
+                    }
+                    std::vector<double> groupUpperBounds;
+                    for (auto propertyIndex : group.second) {
+                        groupUpperBounds.push_back(upperBounds[propertyIndex]);
+                    }
+                    STORM_LOG_DEBUG("Checking " << group.second.size() << " time-bounded properties jointly.");
+                    auto groupResults = storm::api::verifyWithSparseEngineForTimeBounds<ValueType>(model, storm::api::createTask<ValueType>(properties[group.second.front()], true), groupUpperBounds);
+                    for (uint64_t j = 0; j < group.second.size(); ++j) {
+                        groupResults[j]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+                        results[group.second[j]] = groupResults[j]->template asExplicitQuantitativeCheckResult<ValueType>().getValueMap().begin()->second;
+                        checked[group.second[j]] = true;
+                    }
+                }
+            }
 
-            // Check each property
+            // Check each remaining property
             storm::utility::Stopwatch singleModelCheckingTimer;
-            for (auto property : properties) {
+            for (uint64_t i = 0; i < properties.size(); ++i) {
+                if (checked[i]) {
+                    continue;
+                }
+                auto const& property = properties[i];
                 singleModelCheckingTimer.reset();
                 singleModelCheckingTimer.start();
                 //STORM_PRINT_AND_LOG("Model checking property " << *property << " ..." << std::endl);
@@ -480,11 +607,9 @@ namespace storm {
 
                 if (result) {
                     result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
-                    ValueType resultValue = result->asExplicitQuantitativeCheckResult<ValueType>().getValueMap().begin()->second;
-                    results.push_back(resultValue);
+                    results[i] = result->asExplicitQuantitativeCheckResult<ValueType>().getValueMap().begin()->second;
                 } else {
                     STORM_LOG_WARN("The property '" << *property << "' could not be checked with the current settings.");
-                    results.push_back(-storm::utility::one<ValueType>());
                 }
                 //STORM_PRINT_AND_LOG("Result (initial states): " << resultValue << std::endl);
                 singleModelCheckingTimer.stop();
@@ -519,6 +644,12 @@ namespace storm {
             os << "Building:\t" << buildingTimer << std::endl;
             os << "Bisimulation:\t" << bisimulationTimer << std::endl;
             os << "Modelchecking:\t" << modelCheckingTimer << std::endl;
+            if (!threadTimers.empty()) {
+                os << "Modules:\t" << parallelModulesTimer << " (checked on " << threadTimers.size() << " threads, the times above are summed over all threads)" << std::endl;
+                for (size_t thread = 0; thread < threadTimers.size(); ++thread) {
+                    os << "Thread " << thread << ":\t" << threadTimers[thread] << std::endl;
+                }
+            }
             os << "Total:\t\t" << totalTimer << std::endl;
         }
 
@@ -36,8 +36,11 @@ namespace storm {
 
             /*!
              * Constructor.
+             *
+             * @param printOutput Flag whether model information should be printed.
+             * @param numberOfThreads The number of threads used to check independent modules (only relevant for modularisation).
              */
-            DFTModelChecker(bool printOutput) : printInfo(printOutput) {
+            DFTModelChecker(bool printOutput, uint64_t numberOfThreads = 1) : printInfo(printOutput), numberOfThreads(numberOfThreads) {
             }
 
             /*!
@@ -79,12 +82,17 @@ namespace storm {
 
             bool printInfo;
 
+            uint64_t numberOfThreads;
+
             // Timing values
             storm::utility::Stopwatch buildingTimer;
             storm::utility::Stopwatch explorationTimer;
             storm::utility::Stopwatch bisimulationTimer;
             storm::utility::Stopwatch modelCheckingTimer;
             storm::utility::Stopwatch totalTimer;
+            // Wall-clock time for checking modules in parallel and the time each thread spent on it
+            storm::utility::Stopwatch parallelModulesTimer;
+            std::vector<storm::utility::Stopwatch> threadTimers;
 
             /*!
              * Internal helper for model checking a DFT.
@@ -106,6 +114,33 @@ namespace storm {
                                     double approximationError = 0.0, storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH,
                                     bool eliminateChains = false, storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels);
 
+            /*!
+             * Internal helper for model checking a single module of a DFT.
+             *
+             * @param module The module.
+             * @param properties Probability properties to check for.
+             * @param symred Flag indicating if symmetry reduction should be used.
+             * @param relevantEvents Relevant events which should be observed.
+             * @param allowDCForRelevant Whether to allow Don't Care propagation for relevant events
+             * @return Model checking results for each property.
+             */
+            std::vector<ValueType> checkModule(storm::storage::DFT<ValueType> const& module, property_vector const& properties, bool symred,
+                                               storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant);
+
+            /*!
+             * Internal helper for model checking independent modules of a DFT concurrently.
+             * Each thread builds and checks the models of its modules with its own model builder.
+             *
+             * @param modules The modules.
+             * @param properties Probability properties to check for.
+             * @param symred Flag indicating if symmetry reduction should be used.
+             * @param relevantEvents Relevant events which should be observed.
+             * @param allowDCForRelevant Whether to allow Don't Care propagation for relevant events
+             * @param moduleResults For each module, the model checking results for each property.
+             */
+            void checkModulesInParallel(std::vector<storm::storage::DFT<ValueType>> const& modules, property_vector const& properties, bool symred,
+                                        storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant, std::vector<std::vector<ValueType>>& moduleResults);
+
             /*!
              * Internal helper for building a CTMC from a DFT via parallel composition.
              *
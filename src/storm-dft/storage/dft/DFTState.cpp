@@ -95,6 +95,21 @@ namespace storm {
             return std::make_shared<storm::storage::DFTState<ValueType>>(*this);
         }
 
+        template<typename ValueType>
+        void DFTState<ValueType>::copyFrom(DFTState<ValueType> const& other) {
+            STORM_LOG_ASSERT(&mDft == &other.mDft, "States belong to different DFTs.");
+            // The status and the currently failable BEs have the same size in both states, so their memory is reused.
+            // The vectors and lists of the failable dependencies and used representants only allocate if they grow beyond their capacity (or length).
+            mStatus = other.mStatus;
+            mId = other.mId;
+            failableElements = other.failableElements;
+            mUsedRepresentants = other.mUsedRepresentants;
+            indexRelevant = other.indexRelevant;
+            mPseudoState = other.mPseudoState;
+            mValid = other.mValid;
+            mTransient = other.mTransient;
+        }
+
         template<typename ValueType>
         DFTElementState DFTState<ValueType>::getElementState(size_t id) const {
             return static_cast<DFTElementState>(getElementStateInt(id));
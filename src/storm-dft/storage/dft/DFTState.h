@@ -65,6 +65,16 @@ namespace storm {
 
             std::shared_ptr<DFTState<ValueType>> copy() const;
 
+            /*!
+             * Overwrites this state with the given state of the same DFT.
+             * In contrast to copy(), the memory already allocated by this state is reused as far as possible.
+             * The bit vectors have a fixed size within one DFT, only the lists of failable dependencies and the used
+             * representants might allocate if the given state has more of them.
+             *
+             * @param other State to copy.
+             */
+            void copyFrom(DFTState<ValueType> const& other);
+
             DFTElementState getElementState(size_t id) const;
 
             static DFTElementState getElementState(storm::storage::BitVector const& state, DFTStateGenerationInfo const& stateGenerationInfo, size_t id);
@@ -95,6 +95,19 @@ namespace storm {
                 dontcarePropagation.pop_back();
                 return next;
             }
+
+            /*!
+             * Removes all pending elements while keeping the allocated memory.
+             */
+            void clear() {
+                while (!failurePropagation.empty()) {
+                    failurePropagation.pop();
+                }
+                failsafePropagation.clear();
+                dontcarePropagation.clear();
+                activatePropagation.clear();
+                restrictionChecks.clear();
+            }
         };
 
     }
@@ -54,7 +54,7 @@ namespace storm {
 
         template <typename ValueType>
         struct SampleInformation {
-            SampleInformation(bool graphPreserving = false, bool exact = false) : graphPreserving(graphPreserving), exact(exact) {
+            SampleInformation(bool graphPreserving = false, bool exact = false) : graphPreserving(graphPreserving), exact(exact), batchSize(1) {
                 // Intentionally left empty.
             }
 
@@ -65,6 +65,7 @@ namespace storm {
             std::vector<std::map<typename utility::parametric::VariableType<ValueType>::type, std::vector<typename utility::parametric::CoefficientType<ValueType>::type>>> cartesianProducts;
             bool graphPreserving;
             bool exact;
+            uint64_t batchSize;
         };
 
         struct PreprocessResult {
@@ -438,6 +439,31 @@ namespace storm {
                 modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
 
                 storm::utility::parametric::Valuation<ValueType> valuation;
+                std::vector<storm::utility::parametric::Valuation<ValueType>> batch;
+                auto checkBatch = [&] () {
+                    if (batch.empty()) {
+                        return;
+                    }
+                    storm::utility::Stopwatch batchWatch(true);
+                    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+                    if (batch.size() == 1) {
+                        results.push_back(modelchecker.check(Environment(), batch.front()));
+                    } else {
+                        results = modelchecker.checkBatch(Environment(), batch);
+                    }
+                    batchWatch.stop();
+
+                    for (uint64_t i = 0; i < batch.size(); ++i) {
+                        if (results[i]) {
+                            results[i]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                        }
+                        printInitialStatesResult<ValueType>(results[i], property, batch.size() == 1 ? &batchWatch : nullptr, &batch[i]);
+                    }
+                    if (batch.size() > 1) {
+                        STORM_PRINT_AND_LOG("Time for checking " << batch.size() << " instances: " << batchWatch << "." << std::endl << std::endl);
+                    }
+                    batch.clear();
+                };
 
                 std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
                 std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
@@ -462,14 +488,10 @@ namespace storm {
                             valuation[parameters[i]] = *iterators[i];
                         }
 
-                        storm::utility::Stopwatch valuationWatch(true);
-                        std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                        valuationWatch.stop();
-
-                        if (result) {
-                            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                        batch.push_back(valuation);
+                        if (batch.size() >= samples.batchSize) {
+                            checkBatch();
                         }
-                        printInitialStatesResult<ValueType>(result, property, &valuationWatch, &valuation);
 
                         for (uint64_t i = 0; i < parameters.size(); ++i) {
                             ++iterators[i];
@@ -489,6 +511,7 @@ namespace storm {
 
                     }
                 }
+                checkBatch();
 
                 watch.stop();
                 STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << std::endl << std::endl);
@@ -840,6 +863,7 @@ namespace storm {
                 samples = parseSamples<ValueType>(model, samplesAsString,
                                                   parSettings.isSamplesAreGraphPreservingSet());
                 samples.exact = parSettings.isSampleExactSet();
+                samples.batchSize = parSettings.getSampleBatchSize();
             }
 
             if (model) {
@@ -1,10 +1,19 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <algorithm>
+
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -35,6 +44,18 @@ namespace storm {
             }
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            // The joint value iteration requires that all valuations preserve the graph structure. It replaces the native solver, so it is not used if another solver has been selected explicitly.
+            auto const& solverEnv = env.solver();
+            bool nativeSolver = solverEnv.getLinearEquationSolverType() == storm::solver::EquationSolverType::Native || solverEnv.isLinearEquationSolverTypeSetFromDefaultValue();
+            if (valuations.size() > 1 && !storm::NumberTraits<ConstantType>::IsExact && nativeSolver && this->getInstantiationsAreGraphPreserving() && this->currentCheckTask->getFormula().isInFragment(storm::logic::reachability())) {
+                return checkReachabilityProbabilityFormulaBatch(env, valuations);
+            }
+            return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(env, valuations);
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
             
@@ -80,6 +101,157 @@ namespace storm {
             return result;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormulaBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            storm::logic::ProbabilityOperatorFormula const& operatorFormula = this->currentCheckTask->getFormula().asProbabilityOperatorFormula();
+            storm::logic::Formula const& pathFormula = operatorFormula.getSubformula();
+            uint64_t numberOfValuations = valuations.size();
+            
+            // The qualitative analysis is performed once on the first instantiation.
+            auto const& instantiatedModel = modelInstantiator.instantiate(valuations.front());
+            storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
+            storm::storage::BitVector phiStates(instantiatedModel.getNumberOfStates(), true);
+            storm::storage::BitVector psiStates;
+            if (pathFormula.isUntilFormula()) {
+                phiStates = modelChecker.check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                psiStates = modelChecker.check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                psiStates = modelChecker.check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            }
+            auto prob01 = storm::utility::graph::performProb01(instantiatedModel, phiStates, psiStates);
+            storm::storage::BitVector maybeStates = ~(prob01.first | prob01.second);
+            
+            // Evaluate the functions for all valuations. The values of one entry are stored next to each other.
+            std::vector<ConstantType> matrixValues = modelInstantiator.instantiateTransitionMatrixValues(valuations);
+            auto const& matrix = instantiatedModel.getTransitionMatrix();
+            storm::utility::ConstantsComparator<ConstantType> comparator;
+            std::vector<ConstantType> rowSums(numberOfValuations);
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                std::fill(rowSums.begin(), rowSums.end(), storm::utility::zero<ConstantType>());
+                for (auto entryIt = matrix.begin(row), entryIte = matrix.end(row); entryIt != entryIte; ++entryIt) {
+                    ConstantType const* values = &matrixValues[std::distance(matrix.begin(), entryIt) * numberOfValuations];
+                    for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                        rowSums[valuation] += values[valuation];
+                    }
+                }
+                STORM_LOG_THROW(std::all_of(rowSums.begin(), rowSums.end(), [&comparator] (ConstantType const& sum) { return comparator.isOne(sum); }), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+            }
+            
+            // Build the equation system x = A x + b restricted to the maybe states, where A refers to the interleaved values.
+            std::vector<uint64_t> maybeStateToIndex(matrix.getColumnCount(), 0);
+            uint64_t numberOfMaybeStates = 0;
+            for (auto state : maybeStates) {
+                maybeStateToIndex[state] = numberOfMaybeStates++;
+            }
+            std::vector<uint64_t> rowIndications;
+            std::vector<uint64_t> columns;
+            std::vector<uint64_t> entryIndices;
+            std::vector<ConstantType> b(numberOfMaybeStates * numberOfValuations, storm::utility::zero<ConstantType>());
+            rowIndications.reserve(numberOfMaybeStates + 1);
+            rowIndications.push_back(0);
+            for (auto state : maybeStates) {
+                ConstantType* bValues = &b[maybeStateToIndex[state] * numberOfValuations];
+                for (auto entryIt = matrix.begin(state), entryIte = matrix.end(state); entryIt != entryIte; ++entryIt) {
+                    uint64_t entryIndex = std::distance(matrix.begin(), entryIt);
+                    if (maybeStates.get(entryIt->getColumn())) {
+                        columns.push_back(maybeStateToIndex[entryIt->getColumn()]);
+                        entryIndices.push_back(entryIndex);
+                    } else if (prob01.second.get(entryIt->getColumn())) {
+                        ConstantType const* values = &matrixValues[entryIndex * numberOfValuations];
+                        for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                            bValues[valuation] += values[valuation];
+                        }
+                    }
+                }
+                rowIndications.push_back(columns.size());
+            }
+            
+            // Performs one Gauss-Seidel sweep for all valuations and returns true iff no value changed by more than the precision.
+            auto const& nativeEnv = env.solver().native();
+            ConstantType precision = storm::utility::convertNumber<ConstantType>(nativeEnv.getPrecision());
+            bool relative = nativeEnv.getRelativeTerminationCriterion();
+            std::vector<ConstantType> newValues(numberOfValuations);
+            auto sweep = [&] (std::vector<ConstantType>& x) {
+                bool smallChange = true;
+                for (uint64_t row = 0; row < numberOfMaybeStates; ++row) {
+                    std::copy(b.begin() + row * numberOfValuations, b.begin() + (row + 1) * numberOfValuations, newValues.begin());
+                    for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                        ConstantType const* values = &matrixValues[entryIndices[entry] * numberOfValuations];
+                        ConstantType const* columnValues = &x[columns[entry] * numberOfValuations];
+                        for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                            newValues[valuation] += values[valuation] * columnValues[valuation];
+                        }
+                    }
+                    ConstantType* rowValues = &x[row * numberOfValuations];
+                    for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                        if (smallChange) {
+                            ConstantType difference = storm::utility::abs<ConstantType>(newValues[valuation] - rowValues[valuation]);
+                            if (relative && !storm::utility::isZero(newValues[valuation])) {
+                                difference /= newValues[valuation];
+                            }
+                            smallChange = difference <= precision;
+                        }
+                        rowValues[valuation] = newValues[valuation];
+                    }
+                }
+                return smallChange;
+            };
+            
+            // A single value iteration updates the values of all valuations in each sweep over the matrix.
+            // The lower values start at zero. If soundness is required, upper values starting at one are iterated as well
+            // (interval iteration) and the iteration stops once the two are close enough.
+            bool sound = env.solver().isForceSoundness();
+            std::vector<ConstantType> lowerValues(numberOfMaybeStates * numberOfValuations, storm::utility::zero<ConstantType>());
+            std::vector<ConstantType> upperValues;
+            if (sound) {
+                upperValues.assign(numberOfMaybeStates * numberOfValuations, storm::utility::one<ConstantType>());
+            }
+            uint64_t iterations = 0;
+            bool converged = numberOfMaybeStates == 0;
+            while (!converged && iterations < nativeEnv.getMaximalNumberOfIterations() && !storm::utility::resources::isTerminate()) {
+                converged = sweep(lowerValues);
+                if (sound) {
+                    sweep(upperValues);
+                    converged = true;
+                    for (uint64_t index = 0; converged && index < lowerValues.size(); ++index) {
+                        ConstantType bound = storm::utility::convertNumber<ConstantType>(2.0) * precision;
+                        if (relative) {
+                            bound *= lowerValues[index];
+                        }
+                        converged = upperValues[index] - lowerValues[index] <= bound;
+                    }
+                }
+                ++iterations;
+            }
+            STORM_LOG_WARN_COND(converged, "Value iteration for " << numberOfValuations << " instantiations did not converge within " << iterations << " iterations.");
+            STORM_LOG_INFO("Value iteration for " << numberOfValuations << " instantiations converged after " << iterations << " iterations.");
+            if (sound) {
+                for (uint64_t index = 0; index < lowerValues.size(); ++index) {
+                    lowerValues[index] = (lowerValues[index] + upperValues[index]) / storm::utility::convertNumber<ConstantType>(2.0);
+                }
+            }
+            
+            // Collect the results of the individual valuations.
+            std::vector<std::unique_ptr<CheckResult>> results;
+            results.reserve(numberOfValuations);
+            for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                std::vector<ConstantType> values(instantiatedModel.getNumberOfStates(), storm::utility::zero<ConstantType>());
+                storm::utility::vector::setVectorValues(values, prob01.second, storm::utility::one<ConstantType>());
+                uint64_t maybeStateIndex = 0;
+                for (auto state : maybeStates) {
+                    values[state] = lowerValues[maybeStateIndex * numberOfValuations + valuation];
+                    ++maybeStateIndex;
+                }
+                ExplicitQuantitativeCheckResult<ConstantType> quantitativeResult(std::move(values));
+                if (operatorFormula.hasQuantitativeResult()) {
+                    results.push_back(std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(quantitativeResult)));
+                } else {
+                    results.push_back(quantitativeResult.compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>()));
+                }
+            }
+            return results;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
             
@@ -21,6 +21,16 @@ namespace storm {
             SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel);
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
+            
+            /*!
+             * Checks the specified formula for each of the given valuations.
+             * If the instantiations are graph preserving and the formula is a reachability probability, the functions are
+             * evaluated for all valuations at once, the qualitative analysis is shared and a single value iteration computes
+             * the results of all valuations, where each matrix entry holds the values of all valuations next to each other.
+             * The iteration uses the precision and iteration bound of the native solver and performs interval iteration if
+             * soundness is required. Exact values or an explicitly selected non-native solver check the valuations one after another.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) override;
 
         protected:
             
@@ -28,6 +38,7 @@ namespace storm {
             std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkBoundedUntilFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
+            std::vector<std::unique_ptr<CheckResult>> checkReachabilityProbabilityFormulaBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
             
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
         };
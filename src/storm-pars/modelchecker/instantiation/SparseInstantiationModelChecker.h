@@ -25,6 +25,12 @@ namespace storm {
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
             
+            /*!
+             * Checks the specified formula for each of the given valuations.
+             * By default, the valuations are checked one after another.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+            
             // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
             // This bypasses the graph analysis for the different instantiations.
             void setInstantiationsAreGraphPreserving(bool value);
@@ -1,5 +1,6 @@
 #include <sstream>
 #include <queue>
+#include <atomic>
 
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
@@ -11,6 +12,9 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm-pars/settings/modules/RegionSettings.h"
+
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -20,8 +24,44 @@
 namespace storm {
     namespace modelchecker {
 
+            namespace detail {
+                /*!
+                 * Creates a copy of the given region that does not share any coefficients with the given region.
+                 * Copying a region only increases reference counters of the coefficients which is not safe if the copies are used by different threads.
+                 */
+                template <typename ParametricType>
+                storm::storage::ParameterRegion<ParametricType> isolateRegion(storm::storage::ParameterRegion<ParametricType> const& region) {
+                    typedef typename storm::storage::ParameterRegion<ParametricType>::CoefficientType CoefficientType;
+                    typename storm::storage::ParameterRegion<ParametricType>::Valuation lowerBoundaries, upperBoundaries;
+                    for (auto const& variable : region.getVariables()) {
+                        lowerBoundaries.emplace(variable, storm::utility::convertNumber<CoefficientType>(storm::utility::to_string(region.getLowerBoundary(variable))));
+                        upperBoundaries.emplace(variable, storm::utility::convertNumber<CoefficientType>(storm::utility::to_string(region.getUpperBoundary(variable))));
+                    }
+                    storm::storage::ParameterRegion<ParametricType> result(std::move(lowerBoundaries), std::move(upperBoundaries));
+                    result.setSplitThreshold(region.getSplitThreshold());
+                    return result;
+                }
+            }
+
+            template <typename ParametricType>
+            RegionModelChecker<ParametricType>::RegionModelChecker() : numberOfRefinementThreads(1) {
+                if (storm::settings::hasModule<storm::settings::modules::RegionSettings>()) {
+                    numberOfRefinementThreads = storm::settings::getModule<storm::settings::modules::RegionSettings>().getNumberOfRefinementThreads();
+                }
+            }
+
+            template <typename ParametricType>
+            std::unique_ptr<RegionModelChecker<ParametricType>> RegionModelChecker<ParametricType>::createCopy(Environment const&) const {
+                return nullptr;
+            }
+
             template <typename ParametricType>
-            RegionModelChecker<ParametricType>::RegionModelChecker() {
+            RegionWarmStartInformation RegionModelChecker<ParametricType>::getWarmStartInformation() const {
+                return RegionWarmStartInformation();
+            }
+
+            template <typename ParametricType>
+            void RegionModelChecker<ParametricType>::setWarmStartInformation(RegionWarmStartInformation const&) {
                 // Intentionally left empty
             }
         
@@ -65,8 +105,12 @@ namespace storm {
                 std::queue<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
 
                 std::queue<uint64_t> refinementDepths;
+                // The warm start information of the parent region (or nullptr) for each unprocessed region.
+                // Every region is warm started from its parent, independent of the number of threads.
+                std::queue<std::shared_ptr<RegionWarmStartInformation const>> warmStarts;
                 unprocessedRegions.emplace(region, RegionResult::Unknown);
                 refinementDepths.push(0);
+                warmStarts.push(nullptr);
 
                 uint_fast64_t numOfAnalyzedRegions = 0;
                 CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
@@ -84,15 +128,125 @@ namespace storm {
                     displayedProgress = storm::utility::zero<CoefficientType>();
                 }
 
+                // Copies of this model checker for the additional threads
+                std::vector<std::unique_ptr<RegionModelChecker<ParametricType>>> checkerCopies;
+                uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(numberOfRefinementThreads);
+                if (numberOfThreads > 1) {
+                    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                        auto copy = createCopy(env);
+                        if (!copy) {
+                            STORM_LOG_WARN("The region model checker does not support the analysis of regions in parallel. Region refinement is performed with a single thread.");
+                            checkerCopies.clear();
+                            break;
+                        }
+                        checkerCopies.push_back(std::move(copy));
+                    }
+                }
+
+                // PARALLEL WHILE LOOP
+                // Regions are analyzed in batches taken from the front of the queue. The threads claim the regions of a batch one after another.
+                // The results are then processed in the order of the queue, i.e., the outcome is the same as for the sequential refinement.
+                if (!checkerCopies.empty()) {
+                    std::vector<RegionModelChecker<ParametricType>*> checkers = {this};
+                    for (auto& copy : checkerCopies) {
+                        checkers.push_back(copy.get());
+                    }
+                    uint64_t const batchSize = 4 * checkers.size();
+                    bool thresholdReached = false;
+                    while (!thresholdReached && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty() && (!useMonotonicity || refinementDepths.front() < monThresh)) {
+                        assert(unprocessedRegions.size() == refinementDepths.size() && unprocessedRegions.size() == warmStarts.size());
+                        std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> batch;
+                        std::vector<uint64_t> batchDepths;
+                        std::vector<std::shared_ptr<RegionWarmStartInformation const>> batchWarmStarts;
+                        std::vector<storm::storage::ParameterRegion<ParametricType>> isolatedRegions;
+                        while (batch.size() < batchSize && !unprocessedRegions.empty() && (!useMonotonicity || refinementDepths.front() < monThresh)) {
+                            isolatedRegions.push_back(detail::isolateRegion(unprocessedRegions.front().first));
+                            batch.push_back(std::move(unprocessedRegions.front()));
+                            batchDepths.push_back(refinementDepths.front());
+                            batchWarmStarts.push_back(std::move(warmStarts.front()));
+                            unprocessedRegions.pop();
+                            refinementDepths.pop();
+                            warmStarts.pop();
+                        }
+
+                        std::vector<RegionResult> batchResults(batch.size());
+                        std::vector<std::shared_ptr<RegionWarmStartInformation const>> batchResultWarmStarts(batch.size());
+                        std::atomic<uint64_t> nextRegion(0);
+                        storm::utility::parallel::runOnThreads(checkers.size(), [&](uint64_t thread) {
+                            RegionModelChecker<ParametricType>& checker = *checkers[thread];
+                            for (uint64_t index = nextRegion++; index < batch.size(); index = nextRegion++) {
+                                checker.setWarmStartInformation(batchWarmStarts[index] ? *batchWarmStarts[index] : RegionWarmStartInformation());
+                                batchResults[index] = checker.analyzeRegion(env, isolatedRegions[index], hypothesis, batch[index].second, false);
+                                batchResultWarmStarts[index] = std::make_shared<RegionWarmStartInformation const>(checker.getWarmStartInformation());
+                            }
+                        });
+                        isolatedRegions.clear();
+
+                        for (uint64_t index = 0; index < batch.size(); ++index) {
+                            if (fractionOfUndiscoveredArea <= thresholdAsCoefficient) {
+                                // The remaining regions of the batch would not have been analyzed by the sequential refinement.
+                                // They are added to the result in front of the regions that are still in the queue.
+                                for (; index < batch.size(); ++index) {
+                                    result.push_back(std::move(batch[index]));
+                                }
+                                thresholdReached = true;
+                                break;
+                            }
+                            auto& currentRegion = batch[index].first;
+                            auto& res = batch[index].second;
+                            res = batchResults[index];
+                            STORM_LOG_INFO("Analyzed region #" << numOfAnalyzedRegions << " (Refinement depth " << batchDepths[index] << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                            switch (res) {
+                                case RegionResult::AllSat:
+                                    fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                    fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
+                                    result.push_back(std::move(batch[index]));
+                                    break;
+                                case RegionResult::AllViolated:
+                                    fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                    fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
+                                    result.push_back(std::move(batch[index]));
+                                    break;
+                                default:
+                                    // Split the region as long as the desired refinement depth is not reached.
+                                    if (!depthThreshold || batchDepths[index] < depthThreshold.get()) {
+                                        std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                        RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                            ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                             RegionResult::Unknown);
+                                        currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+                                        for (auto& newRegion : newRegions) {
+                                            unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
+                                            refinementDepths.push(batchDepths[index] + 1);
+                                            warmStarts.push(batchResultWarmStarts[index]);
+                                        }
+                                    } else {
+                                        // If the region is not further refined, it is still added to the result
+                                        result.push_back(std::move(batch[index]));
+                                    }
+                                    break;
+                            }
+                            ++numOfAnalyzedRegions;
+                            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                                while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                                    STORM_PRINT_AND_LOG("#");
+                                    displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                                }
+                            }
+                        }
+                    }
+                }
+
                 // NORMAL WHILE LOOP
-                uint64_t currentDepth = refinementDepths.front();
+                uint64_t currentDepth = refinementDepths.empty() ? 0 : refinementDepths.front();
                 while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
-                    assert(unprocessedRegions.size() == refinementDepths.size());
+                    assert(unprocessedRegions.size() == refinementDepths.size() && unprocessedRegions.size() == warmStarts.size());
                     STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
                     auto& currentRegion = unprocessedRegions.front().first;
                     auto& res = unprocessedRegions.front().second;
                     std::shared_ptr<storm::analysis::Order> order;
                     std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
+                    setWarmStartInformation(warmStarts.front() ? *warmStarts.front() : RegionWarmStartInformation());
                     res = analyzeRegion(env, currentRegion, hypothesis, res, false);
 
                     switch (res) {
@@ -116,10 +270,11 @@ namespace storm {
 
                                 currentRegion.split(currentRegion.getCenterPoint(), newRegions);
 
-                                bool first = true;
+                                auto warmStart = std::make_shared<RegionWarmStartInformation const>(getWarmStartInformation());
                                 for (auto& newRegion : newRegions) {
                                     unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
                                     refinementDepths.push(currentDepth + 1);
+                                    warmStarts.push(warmStart);
                                 }
 
                             } else {
@@ -131,6 +286,7 @@ namespace storm {
                     ++numOfAnalyzedRegions;
                     unprocessedRegions.pop();
                     refinementDepths.pop();
+                    warmStarts.pop();
                     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
                         while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
                             STORM_PRINT_AND_LOG("#");
@@ -400,6 +556,26 @@ namespace storm {
             this->useOnlyGlobal = global;
         }
 
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::copySettingsTo(RegionModelChecker<ParametricType>& other) const {
+            other.useMonotonicity = useMonotonicity;
+            other.useOnlyGlobal = useOnlyGlobal;
+            other.useBounds = useBounds;
+            other.numberOfRefinementThreads = numberOfRefinementThreads;
+            other.monotoneIncrParameters = monotoneIncrParameters;
+            other.monotoneDecrParameters = monotoneDecrParameters;
+        }
+
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::setNumberOfRefinementThreads(uint64_t numberOfThreads) {
+            this->numberOfRefinementThreads = numberOfThreads;
+        }
+
+        template <typename ParametricType>
+        uint64_t RegionModelChecker<ParametricType>::getNumberOfRefinementThreads() const {
+            return numberOfRefinementThreads;
+        }
+
         template <typename ParametricType>
         void RegionModelChecker<ParametricType>::splitSmart(storm::storage::ParameterRegion<ParametricType> & currentRegion, std::vector<storm::storage::ParameterRegion<ParametricType>> &regionVector, std::shared_ptr<storm::analysis::Order> order, storm::analysis::MonotonicityResult<VariableType> & monRes, bool splitForExtremum) const {
             STORM_LOG_WARN("Smart splitting for this model checker not implemented");
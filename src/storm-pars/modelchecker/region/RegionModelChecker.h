@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/analysis/OrderExtender.h"
@@ -19,6 +20,17 @@ namespace storm {
     class Environment;
     
     namespace modelchecker{
+
+        /*!
+         * Information obtained while analyzing a region that can be used to speed up the analysis of its subregions.
+         */
+        struct RegionWarmStartInformation {
+            // The scheduler choices that were optimal when minimizing (maximizing) over the parameters.
+            boost::optional<std::vector<uint_fast64_t>> minSchedulerChoices;
+            boost::optional<std::vector<uint_fast64_t>> maxSchedulerChoices;
+            // For models with nondeterminism, the choices of the player that resolves the nondeterminism of the model.
+            boost::optional<std::vector<uint_fast64_t>> player1SchedulerChoices;
+        };
         
         template<typename ParametricType>
         class RegionModelChecker {
@@ -33,6 +45,23 @@ namespace storm {
             virtual bool canHandle(std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask) const = 0;
             virtual void specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask, bool generateRegionSplitEstimates, bool allowModelSimplifications = true) = 0;
 
+            /*!
+             * Creates a region model checker for the same (already specified) model and check task that can analyze regions independently of this one,
+             * e.g., in a different thread. The parametric model is shared with this model checker.
+             * @return the copy or nullptr if this model checker does not support copies.
+             */
+            virtual std::unique_ptr<RegionModelChecker<ParametricType>> createCopy(Environment const& env) const;
+
+            /*!
+             * Retrieves information from the last analyzed region that can be used to warm start the analysis of its subregions.
+             */
+            virtual RegionWarmStartInformation getWarmStartInformation() const;
+
+            /*!
+             * Sets the information that is used to warm start the analysis of the next region.
+             */
+            virtual void setWarmStartInformation(RegionWarmStartInformation const& warmStartInformation);
+
             
             /*!
              * Analyzes the given region.
@@ -94,12 +123,20 @@ namespace storm {
             void setUseBounds(bool bounds = true);
             void setUseOnlyGlobal(bool global = true);
 
+            /*!
+             * Sets the number of threads that analyze regions during region refinement, where 0 means the number of available cores.
+             * Regions are only analyzed in parallel if copies of this model checker can be created and monotonicity is not used.
+             */
+            void setNumberOfRefinementThreads(uint64_t numberOfThreads);
+            uint64_t getNumberOfRefinementThreads() const;
+
             void setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>, std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneParameters);
 
         private:
             bool useMonotonicity = false;
             bool useOnlyGlobal = false;
             bool useBounds = false;
+            uint64_t numberOfRefinementThreads;
 
         protected:
 
@@ -109,6 +146,12 @@ namespace storm {
 
             virtual void extendLocalMonotonicityResult(storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult);
 
+            /*!
+             * Transfers the settings of this region model checker (e.g. whether monotonicity is used) to the given one.
+             * This is intended for the creation of copies and has to be called before the copy is specified.
+             */
+            void copySettingsTo(RegionModelChecker<ParametricType>& other) const;
+
             virtual void splitSmart(storm::storage::ParameterRegion<ParametricType> & region, std::vector<storm::storage::ParameterRegion<ParametricType>> &regionVector, std::shared_ptr<storm::analysis::Order> order, storm::analysis::MonotonicityResult<VariableType> & monRes, bool splitForExtremum) const;
 
         };
@@ -79,6 +79,36 @@ namespace storm {
             }
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::createCopy(Environment const& env) const {
+            if (storm::NumberTraits<ConstantType>::IsExact || !this->parametricModel) {
+                return nullptr;
+            }
+            auto result = std::make_unique<SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>>();
+            this->copySettingsTo(*result);
+            // The model has already been simplified, so the copy can directly work on it.
+            result->specify(env, this->parametricModel, this->currentCheckTask->template convertValueType<ValueType>(), regionSplitEstimationsEnabled, false);
+            // The instantiation checker copies the functions of the shared model, so we create it before the copy is handed to another thread.
+            result->getInstantiationChecker();
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        RegionWarmStartInformation SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getWarmStartInformation() const {
+            RegionWarmStartInformation result;
+            result.minSchedulerChoices = minSchedChoices;
+            result.maxSchedulerChoices = maxSchedChoices;
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::setWarmStartInformation(RegionWarmStartInformation const& warmStartInformation) {
+            minSchedChoices = warmStartInformation.minSchedulerChoices;
+            maxSchedChoices = warmStartInformation.maxSchedulerChoices;
+            // The values of the previously analyzed region are not reused as they would make the result depend on the order in which regions are analyzed.
+            x.clear();
+        }
+
 
 
         template <typename SparseModelType, typename ConstantType>
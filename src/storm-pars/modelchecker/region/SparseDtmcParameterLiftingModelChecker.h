@@ -33,6 +33,15 @@ namespace storm {
             virtual void specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ValueType> const& checkTask, bool generateRegionSplitEstimates = false, bool allowModelSimplification = true) override;
             void specify_internal(Environment const& env, std::shared_ptr<SparseModelType> parametricModel, CheckTask<storm::logic::Formula, ValueType> const& checkTask, bool generateRegionSplitEstimates, bool skipModelSimplification);
 
+            /*!
+             * Creates a copy that is specified for the same (simplified) model and check task. The parametric model is shared.
+             * The copy uses the default solver factory. Copies are only supported if the constants are not exact, as the exact
+             * arithmetic on the shared model is not thread-safe.
+             */
+            virtual std::unique_ptr<RegionModelChecker<ValueType>> createCopy(Environment const& env) const override;
+            virtual RegionWarmStartInformation getWarmStartInformation() const override;
+            virtual void setWarmStartInformation(RegionWarmStartInformation const& warmStartInformation) override;
+
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMinScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
 
@@ -21,6 +21,7 @@ namespace storm {
             const std::string ParametricSettings::samplesOptionName = "samples";
             const std::string ParametricSettings::samplesGraphPreservingOptionName = "samples-graph-preserving";
             const std::string ParametricSettings::sampleExactOptionName = "sample-exact";
+            const std::string ParametricSettings::sampleBatchSizeOptionName = "sample-batchsize";
             const std::string ParametricSettings::useMonotonicityName = "use-monotonicity";
 //            const std::string ParametricSettings::onlyGlobalName = "onlyGlobal";
 
@@ -34,6 +35,8 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("samples", "The samples are semicolon-separated entries of the form 'Var1=Val1:Val2:...:Valk,Var2=... that span the sample spaces.").setDefaultValueString("").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, samplesGraphPreservingOptionName, false, "Sets whether it can be assumed that the samples are graph-preserving.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, sampleExactOptionName, false, "Sets whether to sample using exact arithmetic.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, sampleBatchSizeOptionName, false, "Sets the number of graph-preserving samples that are checked together.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of samples per batch.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useMonotonicityName, false, "If set, monotonicity will be used.").build());
 //                this->addOption(storm::settings::OptionBuilder(moduleName, onlyGlobalName, false, "If set, only global monotonicity will be used.").build());
             }
@@ -70,6 +73,10 @@ namespace storm {
                 return this->getOption(sampleExactOptionName).getHasOptionBeenSet();
             }
 
+            uint64_t ParametricSettings::getSampleBatchSize() const {
+                return this->getOption(sampleBatchSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
+
             bool ParametricSettings::isUseMonotonicitySet() const {
                 return this->getOption(useMonotonicityName).getHasOptionBeenSet();
             }
@@ -64,6 +64,12 @@ namespace storm {
                  */
                 bool isSampleExactSet() const;
 
+                /*!
+                 * Retrieves the number of samples that are checked together. Graph-preserving samples of DTMCs are
+                 * checked in batches of this size with a single value iteration.
+                 */
+                uint64_t getSampleBatchSize() const;
+
                 /*!
                  * Retrieves whether monotonicity should be used
                  */
@@ -82,6 +88,7 @@ namespace storm {
                 const static std::string samplesOptionName;
                 const static std::string samplesGraphPreservingOptionName;
                 const static std::string sampleExactOptionName;
+                const static std::string sampleBatchSizeOptionName;
                 const static std::string useMonotonicityName;
 //                const static std::string onlyGlobalName;
 
@@ -25,6 +25,7 @@ namespace storm {
             const std::string RegionSettings::extremumOptionName = "extremum";
             const std::string RegionSettings::extremumSuggestionOptionName = "extremum-init";
             const std::string RegionSettings::splittingThresholdName = "splitting-threshold";
+            const std::string RegionSettings::refinementThreadsOptionName = "refinement-threads";
             const std::string RegionSettings::checkEngineOptionName = "engine";
             const std::string RegionSettings::printNoIllustrationOptionName = "noillustration";
             const std::string RegionSettings::printFullResultOptionName = "printfullresult";
@@ -55,6 +56,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, splittingThresholdName, false, "Sets the threshold for number of parameters in which to split regions.")
                                         .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument("splitting-threshold", "The threshold for splitting, should be an integer > 0").build()).build());
 
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementThreadsOptionName, true, "Sets the number of threads that analyze regions during region refinement.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means the number of available cores.").setDefaultValueUnsignedInteger(1).build()).build());
+
                 std::vector<std::string> engines = {"pl", "exactpl", "validatingpl"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, checkEngineOptionName, true, "Sets which engine is used for analyzing regions.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the engine to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(engines)).setDefaultValueString("pl").build()).build());
@@ -197,6 +201,10 @@ namespace storm {
                 return this->getOption(splittingThresholdName).getHasOptionBeenSet();
             }
 
+            uint64_t RegionSettings::getNumberOfRefinementThreads() const {
+                return this->getOption(refinementThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
 
         } // namespace modules
     } // namespace settings
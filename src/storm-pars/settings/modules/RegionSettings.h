@@ -94,6 +94,11 @@ namespace storm {
 
                 int getSplittingThreshold() const;
 
+                /*!
+                 * Retrieves the number of threads that analyze regions during region refinement (0 means the number of available cores).
+                 */
+                uint64_t getNumberOfRefinementThreads() const;
+
 				/*!
 				 * Retrieves which type of region check should be performed
 				 */
@@ -121,6 +126,7 @@ namespace storm {
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
 				const static std::string splittingThresholdName;
+				const static std::string refinementThreadsOptionName;
 				const static std::string extremumOptionName;
 				const static std::string extremumSuggestionOptionName;
 				const static std::string checkEngineOptionName;
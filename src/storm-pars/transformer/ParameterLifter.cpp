@@ -332,11 +332,32 @@ namespace storm {
             // insert the function and the valuation
             //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
             auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+            if (insertionRes.second && std::is_same<ConstantType, double>::value) {
+                // Compile the function such that its evaluation does not require arbitrary-precision arithmetic.
+                CompiledFunctionValuation compiledFunction;
+                compiledFunction.functionIndex = functionEvaluator.addFunction(insertionRes.first->first.first);
+                AbstractValuation const& insertedValuation = insertionRes.first->first.second;
+                for (auto const& par : insertedValuation.getLowerParameters()) {
+                    compiledFunction.lowerParameters.push_back(functionEvaluator.getVariableIndex(par));
+                }
+                for (auto const& par : insertedValuation.getUpperParameters()) {
+                    compiledFunction.upperParameters.push_back(functionEvaluator.getVariableIndex(par));
+                }
+                for (auto const& par : insertedValuation.getUnspecifiedParameters()) {
+                    compiledFunction.unspecifiedParameters.push_back(functionEvaluator.getVariableIndex(par));
+                }
+                compiledFunction.placeholder = &insertionRes.first->second;
+                compiledFunctions.push_back(std::move(compiledFunction));
+            }
             return insertionRes.first->second;
         }
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            if (!compiledFunctions.empty()) {
+                evaluateCompiledFunctions(region, dirForUnspecifiedParameters);
+                return;
+            }
             for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
                 ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
                 AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
@@ -355,6 +376,41 @@ namespace storm {
             }
         }
         
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            std::vector<double> lowerBoundaries, upperBoundaries;
+            for (auto const& par : functionEvaluator.getVariables()) {
+                lowerBoundaries.push_back(storm::utility::convertNumber<double>(region.getLowerBoundary(par)));
+                upperBoundaries.push_back(storm::utility::convertNumber<double>(region.getUpperBoundary(par)));
+            }
+            bool minimize = storm::solver::minimize(dirForUnspecifiedParameters);
+            
+            for (auto const& compiledFunction : compiledFunctions) {
+                for (auto const& par : compiledFunction.lowerParameters) {
+                    functionEvaluator.setVariableValue(par, lowerBoundaries[par]);
+                }
+                for (auto const& par : compiledFunction.upperParameters) {
+                    functionEvaluator.setVariableValue(par, upperBoundaries[par]);
+                }
+                // Consider all vertices spanned by the unspecified parameters, where the i-th bit of the vertex index decides the boundary of the i-th parameter.
+                uint64_t numberOfVertices = 1ull << compiledFunction.unspecifiedParameters.size();
+                double result = 0.0;
+                for (uint64_t vertex = 0; vertex < numberOfVertices; ++vertex) {
+                    for (uint64_t parIndex = 0; parIndex < compiledFunction.unspecifiedParameters.size(); ++parIndex) {
+                        uint64_t par = compiledFunction.unspecifiedParameters[parIndex];
+                        functionEvaluator.setVariableValue(par, ((vertex >> parIndex) & 1) ? upperBoundaries[par] : lowerBoundaries[par]);
+                    }
+                    double currentResult = functionEvaluator.evaluate(compiledFunction.functionIndex);
+                    if (vertex == 0) {
+                        result = currentResult;
+                    } else {
+                        result = minimize ? std::min(result, currentResult) : std::max(result, currentResult);
+                    }
+                }
+                *compiledFunction.placeholder = storm::utility::convertNumber<ConstantType>(result);
+            }
+        }
+        
         template class ParameterLifter<storm::RationalFunction, double>;
         template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
     }
@@ -8,6 +8,7 @@
 
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/solver/OptimizationDirection.h"
@@ -136,6 +137,20 @@ namespace storm {
                 void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
                 
             private:
+                /*!
+                 * A collected function that has been compiled for evaluation with double precision.
+                 * The parameters of the abstract valuation are given by their indices in the function evaluator.
+                 */
+                struct CompiledFunctionValuation {
+                    uint64_t functionIndex;
+                    std::vector<uint64_t> lowerParameters;
+                    std::vector<uint64_t> upperParameters;
+                    std::vector<uint64_t> unspecifiedParameters;
+                    ConstantType* placeholder;
+                };
+                
+                void evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+
                 // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
                 typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
 
@@ -151,6 +166,10 @@ namespace storm {
 
                 // Stores the collected functions with the valuations together with a placeholder for the result.
                 std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+                
+                // If the functions are evaluated with double precision, they are compiled once and evaluated by this evaluator.
+                storm::utility::parametric::CompiledFunctionEvaluator<ParametricType> functionEvaluator;
+                std::vector<CompiledFunctionValuation> compiledFunctions;
             };
             
             FunctionValuationCollector functionValuationCollector;
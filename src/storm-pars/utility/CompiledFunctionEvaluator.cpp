@@ -0,0 +1,262 @@
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            template<typename FunctionType>
+            const uint64_t CompiledFunctionEvaluator<FunctionType>::noNode = std::numeric_limits<uint64_t>::max();
+
+            template<typename FunctionType>
+            uint64_t CompiledFunctionEvaluator<FunctionType>::addFunction(FunctionType const& function) {
+                auto functionIt = functionToIndex.find(function);
+                if (functionIt != functionToIndex.end()) {
+                    return functionIt->second;
+                }
+
+                Program program;
+                if (function.isConstant()) {
+                    uint64_t beginInstruction = instructions.size();
+                    program.resultRegister = newRegister();
+                    addInstruction(OpCode::Load, program.resultRegister, 0, 0, storm::utility::convertNumber<double>(function.constantPart()));
+                    addNode(beginInstruction, program.resultRegister, {});
+                } else {
+                    auto denominator = function.denominator();
+                    if (denominator.isConstant()) {
+                        // Dividing by a constant is done by scaling the coefficients of the nominator.
+                        program.resultRegister = compilePolynomial(convertPolynomial(function.nominator(), storm::utility::convertNumber<double>(denominator.constantPart())));
+                    } else {
+                        uint64_t nominatorRegister = compilePolynomial(convertPolynomial(function.nominator(), 1.0));
+                        uint64_t denominatorRegister = compilePolynomial(convertPolynomial(denominator, 1.0));
+                        uint64_t beginInstruction = instructions.size();
+                        program.resultRegister = newRegister();
+                        addInstruction(OpCode::Divide, program.resultRegister, nominatorRegister, denominatorRegister, 0.0);
+                        addNode(beginInstruction, program.resultRegister, {nominatorRegister, denominatorRegister});
+                    }
+                }
+
+                uint64_t functionIndex = programs.size();
+                includeNode(registerToNode[program.resultRegister], functionIndex, program);
+                programs.push_back(std::move(program));
+                functionToIndex.emplace(function, functionIndex);
+                return functionIndex;
+            }
+
+            template<typename FunctionType>
+            uint64_t CompiledFunctionEvaluator<FunctionType>::getNumberOfFunctions() const {
+                return programs.size();
+            }
+
+            template<typename FunctionType>
+            std::vector<typename CompiledFunctionEvaluator<FunctionType>::Variable> const& CompiledFunctionEvaluator<FunctionType>::getVariables() const {
+                return variables;
+            }
+
+            template<typename FunctionType>
+            uint64_t CompiledFunctionEvaluator<FunctionType>::getVariableIndex(Variable const& variable) const {
+                auto variableIt = variableToIndex.find(variable);
+                STORM_LOG_ASSERT(variableIt != variableToIndex.end(), "The variable " << variable << " does not occur in the compiled functions.");
+                return variableIt->second;
+            }
+
+            template<typename FunctionType>
+            void CompiledFunctionEvaluator<FunctionType>::setVariableValue(uint64_t variableIndex, double value) {
+                double& variableRegister = registers[variableRegisters[variableIndex]];
+                if (variableRegister != value) {
+                    variableRegister = value;
+                    ++currentValuation;
+                }
+            }
+
+            template<typename FunctionType>
+            void CompiledFunctionEvaluator<FunctionType>::setValuation(Valuation<FunctionType> const& valuation) {
+                for (auto const& variableValue : valuation) {
+                    auto variableIt = variableToIndex.find(variableValue.first);
+                    if (variableIt != variableToIndex.end()) {
+                        setVariableValue(variableIt->second, storm::utility::convertNumber<double>(variableValue.second));
+                    }
+                }
+            }
+
+            template<typename FunctionType>
+            double CompiledFunctionEvaluator<FunctionType>::evaluate(uint64_t functionIndex) {
+                Program const& program = programs[functionIndex];
+                double* reg = registers.data();
+                for (auto const& nodeIndex : program.nodes) {
+                    Node& node = nodes[nodeIndex];
+                    if (node.evaluatedValuation == currentValuation) {
+                        // The subexpression has already been computed for another function.
+                        continue;
+                    }
+                    for (auto instructionIt = instructions.begin() + node.beginInstruction, instructionIte = instructions.begin() + node.endInstruction; instructionIt != instructionIte; ++instructionIt) {
+                        switch (instructionIt->opCode) {
+                            case OpCode::Load:
+                                reg[instructionIt->target] = instructionIt->constant;
+                                break;
+                            case OpCode::Multiply:
+                                reg[instructionIt->target] = reg[instructionIt->first] * reg[instructionIt->second];
+                                break;
+                            case OpCode::MultiplyAdd:
+                                reg[instructionIt->target] += instructionIt->constant * reg[instructionIt->first];
+                                break;
+                            case OpCode::Divide:
+                                reg[instructionIt->target] = reg[instructionIt->first] / reg[instructionIt->second];
+                                break;
+                        }
+                    }
+                    node.evaluatedValuation = currentValuation;
+                }
+                return reg[program.resultRegister];
+            }
+
+            template<typename FunctionType>
+            template<typename PolynomialType>
+            typename CompiledFunctionEvaluator<FunctionType>::Polynomial CompiledFunctionEvaluator<FunctionType>::convertPolynomial(PolynomialType const& polynomial, double divisor) {
+                Polynomial result;
+                for (auto const& term : polynomial) {
+                    Monomial monomial;
+                    if (term.monomial()) {
+                        for (auto const& variableExponent : *term.monomial()) {
+                            auto variableIt = variableToIndex.find(variableExponent.first);
+                            if (variableIt == variableToIndex.end()) {
+                                variableIt = variableToIndex.emplace(variableExponent.first, variables.size()).first;
+                                variables.push_back(variableExponent.first);
+                                variableRegisters.push_back(newRegister());
+                            }
+                            monomial.emplace_back(variableIt->second, variableExponent.second);
+                        }
+                        std::sort(monomial.begin(), monomial.end());
+                    }
+                    result.emplace_back(storm::utility::convertNumber<double>(term.coeff()) / divisor, std::move(monomial));
+                }
+                return result;
+            }
+
+            template<typename FunctionType>
+            uint64_t CompiledFunctionEvaluator<FunctionType>::compilePower(uint64_t variableIndex, uint64_t exponent) {
+                STORM_LOG_ASSERT(exponent > 0, "Unexpected exponent.");
+                if (exponent == 1) {
+                    return variableRegisters[variableIndex];
+                }
+                auto powerIt = powerRegisters.find(std::make_pair(variableIndex, exponent));
+                if (powerIt != powerRegisters.end()) {
+                    return powerIt->second;
+                }
+                // Square-and-multiply, where the intermediate powers are shared with other monomials.
+                uint64_t halfRegister = compilePower(variableIndex, exponent / 2);
+                uint64_t beginInstruction = instructions.size();
+                uint64_t result = newRegister();
+                addInstruction(OpCode::Multiply, result, halfRegister, halfRegister, 0.0);
+                if (exponent % 2 == 1) {
+                    addInstruction(OpCode::Multiply, result, result, variableRegisters[variableIndex], 0.0);
+                }
+                addNode(beginInstruction, result, {halfRegister, variableRegisters[variableIndex]});
+                powerRegisters.emplace(std::make_pair(variableIndex, exponent), result);
+                return result;
+            }
+
+            template<typename FunctionType>
+            uint64_t CompiledFunctionEvaluator<FunctionType>::compileMonomial(Monomial const& monomial) {
+                STORM_LOG_ASSERT(!monomial.empty(), "Unexpected constant monomial.");
+                if (monomial.size() == 1) {
+                    return compilePower(monomial.front().first, monomial.front().second);
+                }
+                auto monomialIt = monomialRegisters.find(monomial);
+                if (monomialIt != monomialRegisters.end()) {
+                    return monomialIt->second;
+                }
+                // The monomial is the product of the monomial without the last variable and the power of the last variable.
+                uint64_t prefixRegister = compileMonomial(Monomial(monomial.begin(), monomial.end() - 1));
+                uint64_t powerRegister = compilePower(monomial.back().first, monomial.back().second);
+                uint64_t beginInstruction = instructions.size();
+                uint64_t result = newRegister();
+                addInstruction(OpCode::Multiply, result, prefixRegister, powerRegister, 0.0);
+                addNode(beginInstruction, result, {prefixRegister, powerRegister});
+                monomialRegisters.emplace(monomial, result);
+                return result;
+            }
+
+            template<typename FunctionType>
+            uint64_t CompiledFunctionEvaluator<FunctionType>::compilePolynomial(Polynomial const& polynomial) {
+                auto polynomialIt = polynomialRegisters.find(polynomial);
+                if (polynomialIt != polynomialRegisters.end()) {
+                    return polynomialIt->second;
+                }
+                // Compile the monomials first as their instructions must not be executed between the instructions of the sum.
+                double constantTerm = 0.0;
+                std::vector<std::pair<double, uint64_t>> terms;
+                for (auto const& term : polynomial) {
+                    if (term.second.empty()) {
+                        constantTerm += term.first;
+                    } else {
+                        terms.emplace_back(term.first, compileMonomial(term.second));
+                    }
+                }
+                uint64_t beginInstruction = instructions.size();
+                uint64_t result = newRegister();
+                addInstruction(OpCode::Load, result, 0, 0, constantTerm);
+                std::vector<uint64_t> termRegisters;
+                termRegisters.reserve(terms.size());
+                for (auto const& term : terms) {
+                    addInstruction(OpCode::MultiplyAdd, result, term.second, 0, term.first);
+                    termRegisters.push_back(term.second);
+                }
+                addNode(beginInstruction, result, termRegisters);
+                polynomialRegisters.emplace(polynomial, result);
+                return result;
+            }
+
+            template<typename FunctionType>
+            uint64_t CompiledFunctionEvaluator<FunctionType>::newRegister() {
+                registers.push_back(0.0);
+                registerToNode.push_back(noNode);
+                return registers.size() - 1;
+            }
+
+            template<typename FunctionType>
+            void CompiledFunctionEvaluator<FunctionType>::addInstruction(OpCode opCode, uint64_t target, uint64_t first, uint64_t second, double constant) {
+                instructions.push_back({opCode, target, first, second, constant});
+            }
+
+            template<typename FunctionType>
+            void CompiledFunctionEvaluator<FunctionType>::addNode(uint64_t beginInstruction, uint64_t resultRegister, std::vector<uint64_t> const& readRegisters) {
+                Node node;
+                node.beginInstruction = beginInstruction;
+                node.endInstruction = instructions.size();
+                for (auto const& reg : readRegisters) {
+                    if (registerToNode[reg] != noNode) {
+                        node.dependencies.push_back(registerToNode[reg]);
+                    }
+                }
+                node.evaluatedValuation = 0;
+                node.includedFunction = noNode;
+                registerToNode[resultRegister] = nodes.size();
+                nodes.push_back(std::move(node));
+            }
+
+            template<typename FunctionType>
+            void CompiledFunctionEvaluator<FunctionType>::includeNode(uint64_t nodeIndex, uint64_t functionIndex, Program& program) {
+                Node& node = nodes[nodeIndex];
+                if (node.includedFunction == functionIndex) {
+                    return;
+                }
+                node.includedFunction = functionIndex;
+                // The nodes that are read have to be computed first.
+                for (auto const& dependency : node.dependencies) {
+                    includeNode(dependency, functionIndex, program);
+                }
+                program.nodes.push_back(nodeIndex);
+            }
+
+#ifdef STORM_HAVE_CARL
+            template class CompiledFunctionEvaluator<storm::RationalFunction>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            /*!
+             * Evaluates rational functions with double precision.
+             * Each added function is compiled once into instructions that operate on a register file shared by all
+             * functions. Powers of variables, monomials and polynomials are compiled only once for all added functions
+             * (e.g. all entries of a matrix), where monomials are obtained by multiplying a shorter monomial with a single
+             * power. Each of them is computed at most once per valuation of the variables, even if it occurs in several
+             * functions. Evaluating a function thus only runs the instructions of its subexpressions that have not been
+             * computed for the current valuation yet instead of evaluating the function with arbitrary-precision arithmetic.
+             *
+             * @note The values of the variables are stored in the evaluator, i.e., a single evaluator may not be used by multiple threads.
+             */
+            template<typename FunctionType>
+            class CompiledFunctionEvaluator {
+            public:
+                typedef typename VariableType<FunctionType>::type Variable;
+
+                CompiledFunctionEvaluator() = default;
+
+                /*!
+                 * Compiles the given function. Functions that have been added before are not compiled again.
+                 * @return The index of the function
+                 */
+                uint64_t addFunction(FunctionType const& function);
+
+                uint64_t getNumberOfFunctions() const;
+
+                /*!
+                 * Retrieves the variables occurring in the added functions. The position of a variable is its index.
+                 */
+                std::vector<Variable> const& getVariables() const;
+
+                /*!
+                 * Retrieves the index of the given variable, which has to occur in one of the added functions.
+                 */
+                uint64_t getVariableIndex(Variable const& variable) const;
+
+                /*!
+                 * Sets the value of the variable with the given index.
+                 */
+                void setVariableValue(uint64_t variableIndex, double value);
+
+                /*!
+                 * Sets the values of the variables according to the given valuation.
+                 * Variables that do not occur in the added functions are ignored.
+                 */
+                void setValuation(Valuation<FunctionType> const& valuation);
+
+                /*!
+                 * Evaluates the function with the given index w.r.t. the current values of the variables.
+                 */
+                double evaluate(uint64_t functionIndex);
+
+            private:
+                // A monomial is given by pairs of variable index and exponent, sorted by the variable index.
+                typedef std::vector<std::pair<uint64_t, uint64_t>> Monomial;
+                // A polynomial is given by its terms. The constant term has an empty monomial.
+                typedef std::vector<std::pair<double, Monomial>> Polynomial;
+
+                static const uint64_t noNode;
+
+                enum class OpCode : uint8_t {
+                    Load,          // target = constant
+                    Multiply,      // target = first * second
+                    MultiplyAdd,   // target = target + constant * first
+                    Divide         // target = first / second
+                };
+
+                struct Instruction {
+                    OpCode opCode;
+                    uint64_t target;
+                    uint64_t first;
+                    uint64_t second;
+                    double constant;
+                };
+
+                /*!
+                 * A subexpression (e.g. a monomial), whose instructions are stored consecutively and write its value to a
+                 * single register.
+                 */
+                struct Node {
+                    uint64_t beginInstruction;
+                    uint64_t endInstruction;
+                    // The nodes whose values are read by the instructions.
+                    std::vector<uint64_t> dependencies;
+                    // The valuation for which the value was computed last.
+                    uint64_t evaluatedValuation;
+                    // The function that included the node last (used while compiling).
+                    uint64_t includedFunction;
+                };
+
+                /*!
+                 * The nodes a function depends on (in the order in which they have to be computed) and the register that
+                 * holds its value.
+                 */
+                struct Program {
+                    std::vector<uint64_t> nodes;
+                    uint64_t resultRegister;
+                };
+
+                /*!
+                 * Converts the given polynomial into the internal representation, where the coefficients are divided by the given divisor.
+                 */
+                template<typename PolynomialType>
+                Polynomial convertPolynomial(PolynomialType const& polynomial, double divisor);
+
+                // The methods below emit instructions for the function that is currently compiled and return the register that holds the result.
+                uint64_t compilePower(uint64_t variableIndex, uint64_t exponent);
+                uint64_t compileMonomial(Monomial const& monomial);
+                uint64_t compilePolynomial(Polynomial const& polynomial);
+                uint64_t newRegister();
+                void addInstruction(OpCode opCode, uint64_t target, uint64_t first, uint64_t second, double constant);
+
+                /*!
+                 * Declares the instructions emitted since the given instruction as the node computing the given register.
+                 * The instructions may only read the given registers (besides the result register).
+                 */
+                void addNode(uint64_t beginInstruction, uint64_t resultRegister, std::vector<uint64_t> const& readRegisters);
+
+                /*!
+                 * Adds the given node and the nodes it depends on to the given program, unless they have been added before.
+                 */
+                void includeNode(uint64_t nodeIndex, uint64_t functionIndex, Program& program);
+
+                std::vector<Variable> variables;
+                std::map<Variable, uint64_t> variableToIndex;
+                std::vector<uint64_t> variableRegisters;
+
+                std::unordered_map<FunctionType, uint64_t> functionToIndex;
+                std::vector<Program> programs;
+                std::vector<Instruction> instructions;
+
+                std::vector<double> registers;
+                // For every register, the node that computes it or noNode for the registers of the variables.
+                std::vector<uint64_t> registerToNode;
+                std::vector<Node> nodes;
+                // Identifies the current valuation. It changes whenever the value of a variable changes.
+                uint64_t currentValuation = 1;
+
+                // The registers holding the subexpressions that have been compiled for any of the functions.
+                std::map<std::pair<uint64_t, uint64_t>, uint64_t> powerRegisters;
+                std::map<Monomial, uint64_t> monomialRegisters;
+                std::map<Polynomial, uint64_t> polynomialRegisters;
+            };
+
+        }
+    }
+}
@@ -1,4 +1,7 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+
+#include <iterator>
+
 #include "storm/models/sparse/StandardRewardModel.h"
 
 namespace storm {
@@ -9,6 +12,7 @@ namespace storm {
                 //Now pre-compute the information for the equation system.
                 initializeModelSpecificData(parametricModel);
                 initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->functions, this->matrixMapping, parametricModel.getTransitionMatrix());
+                transitionMatrixMappingSize = this->matrixMapping.size();
                 
                 for(auto& rewModel : this->instantiatedModel->getRewardModels()) {
                     if(rewModel.second.hasStateRewards()){
@@ -21,6 +25,13 @@ namespace storm {
                         initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->functions, this->matrixMapping, parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
                     }
                 }
+                
+                // Functions that are evaluated with double precision are compiled, which avoids arbitrary-precision arithmetic upon instantiation.
+                if (std::is_same<ConstantType, double>::value) {
+                    for (auto& functionResult : this->functions) {
+                        this->compiledFunctions.emplace_back(this->functionEvaluator.addFunction(functionResult.first), &functionResult.second);
+                    }
+                }
             }
             
             template<typename ParametricSparseModelType, typename ConstantType>
@@ -150,6 +161,33 @@ namespace storm {
                 return *this->instantiatedModel;
             }
         
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            std::vector<typename ConstantSparseModelType::ValueType> ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateTransitionMatrixValues(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) {
+                auto& matrix = this->instantiatedModel->getTransitionMatrix();
+                uint64_t numberOfValuations = valuations.size();
+                
+                // Entries that are not connected to a function keep their constant value.
+                std::vector<ConstantType> result;
+                result.reserve(matrix.getEntryCount() * numberOfValuations);
+                for (auto const& entry : matrix) {
+                    result.insert(result.end(), numberOfValuations, entry.getValue());
+                }
+                
+                // Each occurring function is evaluated once per valuation.
+                std::vector<uint64_t> entryIndices;
+                entryIndices.reserve(transitionMatrixMappingSize);
+                for (uint64_t mappingIndex = 0; mappingIndex < transitionMatrixMappingSize; ++mappingIndex) {
+                    entryIndices.push_back(std::distance(matrix.begin(), this->matrixMapping[mappingIndex].first));
+                }
+                for (uint64_t valuationIndex = 0; valuationIndex < numberOfValuations; ++valuationIndex) {
+                    instantiate_helper(valuations[valuationIndex]);
+                    for (uint64_t mappingIndex = 0; mappingIndex < transitionMatrixMappingSize; ++mappingIndex) {
+                        result[entryIndices[mappingIndex] * numberOfValuations + valuationIndex] = *(this->matrixMapping[mappingIndex].second);
+                    }
+                }
+                return result;
+            }
+        
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
         void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::checkValid() const {
             // TODO write some checks
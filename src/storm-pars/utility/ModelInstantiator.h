@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -48,6 +49,16 @@ namespace storm {
                  */
                 ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
                 
+                /*!
+                 * Evaluates the functions occurring in the transition matrix for each of the given valuations.
+                 * The values are interleaved, i.e., the value of the i-th matrix entry under the j-th valuation is at
+                 * position i * valuations.size() + j. This way, all valuations can be considered in a single pass over the matrix.
+                 * The positions of the entries are the ones of the transition matrix of the instantiated model.
+                 * @param valuations The valuations, each of which maps the occurring variables to the values with which they should be substituted
+                 * @return The interleaved values of the transition matrix entries
+                 */
+                std::vector<ConstantType> instantiateTransitionMatrixValues(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations);
+                
                 /*!
                  *  Check validity
                  */
@@ -134,9 +145,16 @@ namespace storm {
                         !std::is_same<PMT,ConstantSparseModelType>::value
                 >::type
                 instantiate_helper(storm::utility::parametric::Valuation<ParametricType> const& valuation) {
-                    for(auto& functionResult : this->functions){
-                        functionResult.second=storm::utility::convertNumber<ConstantType>(
-                                storm::utility::parametric::evaluate(functionResult.first, valuation));
+                    if (this->compiledFunctions.empty()) {
+                        for(auto& functionResult : this->functions){
+                            functionResult.second=storm::utility::convertNumber<ConstantType>(
+                                    storm::utility::parametric::evaluate(functionResult.first, valuation));
+                        }
+                    } else {
+                        this->functionEvaluator.setValuation(valuation);
+                        for (auto const& functionPlaceholder : this->compiledFunctions) {
+                            *functionPlaceholder.second = storm::utility::convertNumber<ConstantType>(this->functionEvaluator.evaluate(functionPlaceholder.first));
+                        }
                     }
                 }
 
@@ -187,8 +205,14 @@ namespace storm {
                 std::unordered_map<ParametricType, ConstantType> functions; 
                 /// Connection of matrix entries with placeholders
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
+                /// The number of connections in matrixMapping that belong to the transition matrix (they are stored first)
+                uint64_t transitionMatrixMappingSize;
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// If the functions are evaluated with double precision, they are compiled once and evaluated by this evaluator
+                storm::utility::parametric::CompiledFunctionEvaluator<ParametricType> functionEvaluator;
+                /// The indices of the compiled functions in the evaluator together with the corresponding placeholders
+                std::vector<std::pair<uint64_t, ConstantType*>> compiledFunctions;
                 
                 
             };
@@ -0,0 +1,269 @@
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "storm-parsers/parser/MappedFile.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/ModelType.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        namespace {
+            typedef storm::exporter::BinaryEncodingHeader Header;
+
+            /*!
+             * Reads plain data from a memory region and checks that the region is not left.
+             */
+            class BinaryReader {
+            public:
+                BinaryReader(char const* begin, char const* end) : begin(begin), current(begin), end(end) {
+                    // Intentionally left empty.
+                }
+
+                template<typename T>
+                T read() {
+                    T value;
+                    readArray(&value, 1);
+                    return value;
+                }
+
+                /*!
+                 * Checks that the remaining input contains (at least) the given number of objects of type T. This has to
+                 * be done before allocating memory for sizes that are read from the file.
+                 */
+                template<typename T>
+                void checkRemaining(uint64_t count) const {
+                    STORM_LOG_THROW(count <= static_cast<uint64_t>(end - current) / sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of the binary model file.");
+                }
+
+                template<typename T>
+                void readArray(T* data, uint64_t count) {
+                    checkRemaining<T>(count);
+                    if (count > 0) {
+                        std::memcpy(static_cast<void*>(data), current, count * sizeof(T));
+                    }
+                    current += count * sizeof(T);
+                }
+
+                template<typename T>
+                std::vector<T> readVector(uint64_t count) {
+                    checkRemaining<T>(count);
+                    std::vector<T> result(count);
+                    readArray(result.data(), count);
+                    return result;
+                }
+
+                /*!
+                 * Reads the count + 1 start indices of the given number of rows (or row groups).
+                 */
+                std::vector<uint64_t> readIndications(uint64_t count) {
+                    STORM_LOG_THROW(count < std::numeric_limits<uint64_t>::max(), storm::exceptions::WrongFormatException, "Invalid number of rows in binary model file.");
+                    return readVector<uint64_t>(count + 1);
+                }
+
+                std::string readString() {
+                    std::vector<char> characters = readVector<char>(read<uint64_t>());
+                    align();
+                    return std::string(characters.begin(), characters.end());
+                }
+
+                storm::storage::BitVector readBitVector(uint64_t expectedSize) {
+                    uint64_t size = read<uint64_t>();
+                    STORM_LOG_THROW(size == expectedSize, storm::exceptions::WrongFormatException, "Unexpected size of a bit vector in binary model file.");
+                    checkRemaining<uint64_t>(size / 64 + (size % 64 == 0 ? 0 : 1));
+                    storm::storage::BitVector result(size);
+                    for (uint64_t index = 0; index < size; index += 64) {
+                        result.setFromInt(index, std::min<uint64_t>(64, size - index), read<uint64_t>());
+                    }
+                    return result;
+                }
+
+                void align() {
+                    uint64_t position = current - begin;
+                    if (position % 8 != 0) {
+                        current += std::min<uint64_t>(8 - position % 8, end - current);
+                    }
+                }
+
+                bool isAtEnd() const {
+                    return current == end;
+                }
+
+            private:
+                char const* begin;
+                char const* current;
+                char const* end;
+            };
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> readMatrix(BinaryReader& reader, uint64_t rowCount, uint64_t columnCount, boost::optional<std::vector<uint64_t>> const& rowGroupIndices) {
+                typedef storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType> EntryType;
+                static_assert(sizeof(EntryType) == sizeof(typename storm::storage::SparseMatrix<ValueType>::index_type) + sizeof(ValueType), "Unexpected layout of the matrix entries.");
+
+                std::vector<uint64_t> rowIndications = reader.readIndications(rowCount);
+                STORM_LOG_THROW(rowIndications.front() == 0, storm::exceptions::WrongFormatException, "Invalid row indications in binary model file.");
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    STORM_LOG_THROW(rowIndications[row] <= rowIndications[row + 1], storm::exceptions::WrongFormatException, "Invalid row indications in binary model file.");
+                }
+                std::vector<EntryType> columnsAndValues = reader.readVector<EntryType>(rowIndications.back());
+                STORM_LOG_THROW(std::all_of(columnsAndValues.begin(), columnsAndValues.end(), [columnCount] (EntryType const& entry) { return entry.getColumn() < columnCount; }), storm::exceptions::WrongFormatException, "Invalid column in binary model file.");
+                return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), boost::optional<std::vector<uint64_t>>(rowGroupIndices));
+            }
+
+            storm::storage::sparse::StateValuations readValuations(BinaryReader& reader, uint64_t stateCount) {
+                auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+                storm::storage::sparse::StateValuationsBuilder builder;
+                uint64_t numberOfVariables = reader.read<uint64_t>();
+                std::vector<uint64_t> variableTypes;
+                for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                    variableTypes.push_back(reader.read<uint64_t>());
+                    std::string name = reader.readString();
+                    switch (variableTypes.back()) {
+                        case 0: builder.addVariable(manager->declareBooleanVariable(name)); break;
+                        case 1: builder.addVariable(manager->declareIntegerVariable(name)); break;
+                        case 2: builder.addVariable(manager->declareRationalVariable(name)); break;
+                        case 3: builder.addObservationLabel(name); break;
+                        default: STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown variable type in binary model file.");
+                    }
+                }
+
+                uint64_t numberOfStates = reader.read<uint64_t>();
+                STORM_LOG_THROW(numberOfStates == stateCount, storm::exceptions::WrongFormatException, "Unexpected number of state valuations in binary model file.");
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (reader.read<uint64_t>() == 0) {
+                        continue;
+                    }
+                    std::vector<bool> booleanValues;
+                    std::vector<int64_t> integerValues;
+                    std::vector<storm::RationalNumber> rationalValues;
+                    std::vector<int64_t> labelValues;
+                    for (auto const& type : variableTypes) {
+                        switch (type) {
+                            case 0: booleanValues.push_back(reader.read<int64_t>() != 0); break;
+                            case 1: integerValues.push_back(reader.read<int64_t>()); break;
+                            case 2: rationalValues.push_back(storm::utility::convertNumber<storm::RationalNumber>(reader.readString())); break;
+                            default: labelValues.push_back(reader.read<int64_t>()); break;
+                        }
+                    }
+                    builder.addState(state, std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(labelValues));
+                }
+                return builder.build(numberOfStates);
+            }
+
+            template<typename ValueType, typename RewardModelType>
+            std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(BinaryReader&) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary format only supports models with double values.");
+            }
+
+            template<>
+            std::shared_ptr<storm::models::sparse::Model<double>> parseModel<double, storm::models::sparse::StandardRewardModel<double>>(BinaryReader& reader) {
+                Header header = reader.read<Header>();
+                STORM_LOG_THROW(std::equal(header.magic, header.magic + 8, Header::Magic), storm::exceptions::WrongFormatException, "The file is not a model in the binary format.");
+                STORM_LOG_THROW(header.byteOrderMark == Header::ByteOrderMark, storm::exceptions::WrongFormatException, "The binary model file was written on a machine with a different byte order.");
+                STORM_LOG_THROW(header.version == Header::Version, storm::exceptions::WrongFormatException, "The binary model file has version " << header.version << ", but version " << Header::Version << " is expected.");
+                STORM_LOG_THROW(header.valueSize == sizeof(double), storm::exceptions::WrongFormatException, "The binary model file does not contain double values.");
+                storm::models::ModelType type = static_cast<storm::models::ModelType>(header.modelType);
+                STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp,
+                                storm::exceptions::WrongFormatException, "Unexpected model type in binary model file.");
+
+                storm::storage::sparse::ModelComponents<double> components;
+
+                // Transition matrix.
+                boost::optional<std::vector<uint64_t>> rowGroupIndices;
+                if (header.flags & Header::HasRowGroups) {
+                    rowGroupIndices = reader.readIndications(header.stateCount);
+                    STORM_LOG_THROW(rowGroupIndices->front() == 0 && rowGroupIndices->back() == header.choiceCount, storm::exceptions::WrongFormatException, "Invalid row groups in binary model file.");
+                    // Together with the bounds checked above, this ensures that all row groups are within the rows.
+                    STORM_LOG_THROW(std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()), storm::exceptions::WrongFormatException, "Invalid row groups in binary model file.");
+                } else {
+                    STORM_LOG_THROW(header.stateCount == header.choiceCount, storm::exceptions::WrongFormatException, "Missing row groups in binary model file.");
+                }
+                components.transitionMatrix = readMatrix<double>(reader, header.choiceCount, header.stateCount, rowGroupIndices);
+                STORM_LOG_THROW(components.transitionMatrix.getEntryCount() == header.entryCount, storm::exceptions::WrongFormatException, "Unexpected number of transitions in binary model file.");
+
+                // Model type specific components.
+                if (header.flags & Header::HasExitRates) {
+                    components.exitRates = reader.readVector<double>(header.stateCount);
+                    // CTMCs are stored with their rate matrix.
+                    components.rateTransitions = type == storm::models::ModelType::Ctmc;
+                }
+                if (header.flags & Header::HasMarkovianStates) {
+                    components.markovianStates = reader.readBitVector(header.stateCount);
+                }
+                if (header.flags & Header::HasObservations) {
+                    components.observabilityClasses = reader.readVector<uint32_t>(header.stateCount);
+                    reader.align();
+                }
+
+                // Labelings.
+                auto readLabeling = [&reader] (storm::models::sparse::ItemLabeling& labeling, uint64_t numberOfItems) {
+                    uint64_t numberOfLabels = reader.read<uint64_t>();
+                    for (uint64_t label = 0; label < numberOfLabels; ++label) {
+                        std::string name = reader.readString();
+                        labeling.addLabel(name, reader.readBitVector(numberOfItems));
+                    }
+                };
+                components.stateLabeling = storm::models::sparse::StateLabeling(header.stateCount);
+                readLabeling(components.stateLabeling, header.stateCount);
+                if (header.flags & Header::HasChoiceLabeling) {
+                    components.choiceLabeling = storm::models::sparse::ChoiceLabeling(header.choiceCount);
+                    readLabeling(components.choiceLabeling.get(), header.choiceCount);
+                }
+
+                // Reward models.
+                for (uint64_t rewardModel = 0; rewardModel < header.rewardModelCount; ++rewardModel) {
+                    std::string name = reader.readString();
+                    bool hasStateRewards = reader.read<uint64_t>() != 0;
+                    bool hasStateActionRewards = reader.read<uint64_t>() != 0;
+                    bool hasTransitionRewards = reader.read<uint64_t>() != 0;
+                    boost::optional<std::vector<double>> stateRewards, stateActionRewards;
+                    boost::optional<storm::storage::SparseMatrix<double>> transitionRewards;
+                    if (hasStateRewards) {
+                        stateRewards = reader.readVector<double>(header.stateCount);
+                    }
+                    if (hasStateActionRewards) {
+                        stateActionRewards = reader.readVector<double>(header.choiceCount);
+                    }
+                    if (hasTransitionRewards) {
+                        transitionRewards = readMatrix<double>(reader, header.choiceCount, header.stateCount, rowGroupIndices);
+                    }
+                    components.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+                }
+
+                if (header.flags & Header::HasStateValuations) {
+                    components.stateValuations = readValuations(reader, header.stateCount);
+                }
+                STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of the binary model file.");
+
+                return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(std::string const& filename) {
+            STORM_LOG_INFO("Reading from file " << filename);
+            MappedFile file(filename.c_str());
+            BinaryReader reader(file.getData(), file.getDataEnd());
+            return storm::parser::parseModel<ValueType, RewardModelType>(reader);
+        }
+
+        // Template instantiations.
+        template class BinaryEncodingParser<double>;
+        template class BinaryEncodingParser<storm::RationalNumber>;
+        template class BinaryEncodingParser<storm::RationalFunction>;
+    } // namespace parser
+} // namespace storm
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         * Parser for models in the binary format written by storm::exporter::explicitExportSparseModelAsBinary.
+         * The file is mapped to memory and the arrays of the model are copied as a whole, i.e., no numbers are parsed.
+         */
+        template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+        class BinaryEncodingParser {
+        public:
+
+            /*!
+             * Load a model in the binary format from a file and create the model.
+             * Only models with double values are supported.
+             *
+             * @param filename The binary file to be parsed.
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& filename);
+        };
+
+    } // namespace parser
+} // namespace storm
@@ -21,6 +21,10 @@ namespace storm {
             
             const std::string refineOption = "refine";
             const std::string explorationTimeLimitOption = "exploration-time";
+            const std::string explorationThreadsOption = "exploration-threads";
+            const std::string timeBudgetOption = "time-budget";
+            const std::string memoryBudgetOption = "memory-budget";
+            const std::string reportBoundsOption = "report-bounds";
             const std::string resolutionOption = "resolution";
             const std::string sizeThresholdOption = "size-threshold";
             const std::string gapThresholdOption = "gap-threshold";
@@ -35,6 +39,14 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationTimeLimitOption, false, "Sets after which time no further states shall be explored.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time","In seconds.").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOption, false, "Sets the number of threads used to compute successor beliefs during the exploration. The results do not depend on this number. Only has an effect for floating point numbers.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count","The number of threads. Zero refers to the number of hardware threads.").setDefaultValueUnsignedInteger(1).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, timeBudgetOption, false, "Stops the analysis after the given time and returns the best bounds found so far.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time","In seconds.").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, memoryBudgetOption, false, "Stops the analysis once the peak memory usage exceeds the given bound and returns the best bounds found so far.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("memory","In megabytes.").addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, reportBoundsOption, false, "Periodically writes the current lower and upper bounds to the given file (one JSON object per line).").addArgument(storm::settings::ArgumentBuilder::createStringArgument("file","The file to write to.").build()).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("interval","The time between two reports in milliseconds.").setDefaultValueUnsignedInteger(1000).makeOptional().addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
                 this->addOption(storm::settings::OptionBuilder(moduleName, resolutionOption, false,"Sets the resolution of the discretization and how it is increased in case of refinement").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("init","the initial resolution (higher means more precise)").setDefaultValueUnsignedInteger(3).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("factor","Multiplied to the resolution of refined observations (higher means more precise).").setDefaultValueDouble(2).makeOptional().addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterValidator(1)).build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, observationThresholdOption, false,"Only observations whose score is below this threshold will be refined.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("init","initial threshold (higher means more precise").setDefaultValueDouble(0.1).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0,1)).build()).addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("factor","Controlls how fast the threshold is increased in each refinement step (higher means more precise).").setDefaultValueDouble(0.1).makeOptional().addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0,1)).build()).build());
@@ -77,6 +89,38 @@ namespace storm {
                 return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
             }
             
+            uint64_t BeliefExplorationSettings::getNumberOfExplorationThreads() const {
+                return this->getOption(explorationThreadsOption).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool BeliefExplorationSettings::isTimeBudgetSet() const {
+                return this->getOption(timeBudgetOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t BeliefExplorationSettings::getTimeBudget() const {
+                return this->getOption(timeBudgetOption).getArgumentByName("time").getValueAsUnsignedInteger();
+            }
+            
+            bool BeliefExplorationSettings::isMemoryBudgetSet() const {
+                return this->getOption(memoryBudgetOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t BeliefExplorationSettings::getMemoryBudget() const {
+                return this->getOption(memoryBudgetOption).getArgumentByName("memory").getValueAsUnsignedInteger();
+            }
+            
+            bool BeliefExplorationSettings::isReportBoundsSet() const {
+                return this->getOption(reportBoundsOption).getHasOptionBeenSet();
+            }
+            
+            std::string BeliefExplorationSettings::getReportBoundsFilename() const {
+                return this->getOption(reportBoundsOption).getArgumentByName("file").getValueAsString();
+            }
+            
+            uint64_t BeliefExplorationSettings::getReportBoundsInterval() const {
+                return this->getOption(reportBoundsOption).getArgumentByName("interval").getValueAsUnsignedInteger();
+            }
+            
             uint64_t BeliefExplorationSettings::getResolutionInit() const {
                 return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
             }
@@ -147,6 +191,17 @@ namespace storm {
                 } else {
                     options.explorationTimeLimit = boost::none;
                 }
+                options.explorationThreads = getNumberOfExplorationThreads();
+                if (isTimeBudgetSet()) {
+                    options.timeBudget = getTimeBudget();
+                } else {
+                    options.timeBudget = boost::none;
+                }
+                if (isMemoryBudgetSet()) {
+                    options.memoryBudget = getMemoryBudget();
+                } else {
+                    options.memoryBudget = boost::none;
+                }
                 options.resolutionInit = getResolutionInit();
                 options.resolutionFactor = storm::utility::convertNumber<ValueType>(getResolutionFactor());
                 options.sizeThresholdInit = getSizeThresholdInit();
@@ -35,6 +35,20 @@ namespace storm {
                 bool isExplorationTimeLimitSet() const;
                 uint64_t getExplorationTimeLimit() const;
                 
+                /// The number of threads used to compute successor beliefs
+                uint64_t getNumberOfExplorationThreads() const;
+                
+                /// Budgets after which the analysis is stopped (returning the best bounds found so far)
+                bool isTimeBudgetSet() const;
+                uint64_t getTimeBudget() const;
+                bool isMemoryBudgetSet() const;
+                uint64_t getMemoryBudget() const;
+                
+                /// Whether and where the current bounds are reported during the analysis
+                bool isReportBoundsSet() const;
+                std::string getReportBoundsFilename() const;
+                uint64_t getReportBoundsInterval() const;
+                
                 /// Discretization Resolution
                 uint64_t getResolutionInit() const;
                 double getResolutionFactor() const;
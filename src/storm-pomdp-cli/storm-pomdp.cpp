@@ -28,6 +28,8 @@
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
 
 #include "storm/api/storm.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/io/file.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/utility/NumberTraits.h"
@@ -229,7 +231,22 @@ namespace storm {
                     auto const& beliefExplorationSettings = storm::settings::getModule<storm::settings::modules::BeliefExplorationSettings>();
                     beliefExplorationSettings.setValuesInOptionsStruct(options);
                     storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(pomdp, options);
+                    std::ofstream boundsStream;
+                    if (beliefExplorationSettings.isReportBoundsSet()) {
+                        storm::utility::openFile(beliefExplorationSettings.getReportBoundsFilename(), boundsStream);
+                        // Write one JSON object per line so that the file can be processed while the analysis is running.
+                        checker.setBoundsReporter([&boundsStream](typename storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>>::Result const& bounds, double time) {
+                            storm::json<double> entry;
+                            entry["time"] = time;
+                            entry["lower"] = storm::utility::convertNumber<double>(bounds.lowerBound);
+                            entry["upper"] = storm::utility::convertNumber<double>(bounds.upperBound);
+                            boundsStream << entry.dump() << std::endl;
+                        }, beliefExplorationSettings.getReportBoundsInterval());
+                    }
                     auto result = checker.check(formula);
+                    if (beliefExplorationSettings.isReportBoundsSet()) {
+                        storm::utility::closeFile(boundsStream);
+                    }
                     checker.printStatisticsToStream(std::cout);
                     if (storm::utility::resources::isTerminate()) {
                         STORM_PRINT_AND_LOG("\nResult till abort: ")
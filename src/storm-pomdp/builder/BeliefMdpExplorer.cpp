@@ -151,6 +151,29 @@ namespace storm {
             return mdpStateToBeliefIdMap[currentMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        uint64_t BeliefMdpExplorer<PomdpType, BeliefValueType>::prepareExpansionsOfNextStates(uint64_t maxNumberOfStates, uint64_t numberOfThreads, std::set<uint32_t> const &targetObservations,
+                                                                                             boost::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            // The exploration queue is only extended at its back, so its front contains the states that are explored next.
+            uint64_t numberOfStates = std::min<uint64_t>(maxNumberOfStates, mdpStatesToExplore.size());
+            std::vector<BeliefId> beliefIds;
+            beliefIds.reserve(numberOfStates);
+            for (uint64_t queueIndex = 0; queueIndex < numberOfStates; ++queueIndex) {
+                MdpStateType mdpState = mdpStatesToExplore[queueIndex];
+                if (exploredMdp && mdpState < exploredMdp->getNumberOfStates() && !exploredMdp->getStateLabeling().getStateHasLabel("truncated", mdpState)) {
+                    // The behavior of this state is usually restored.
+                    continue;
+                }
+                BeliefId beliefId = getBeliefId(mdpState);
+                if (targetObservations.count(beliefManager->getBeliefObservation(beliefId)) == 0) {
+                    beliefIds.push_back(beliefId);
+                }
+            }
+            beliefManager->prepareExpansions(beliefIds, numberOfThreads, observationResolutions);
+            return numberOfStates;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                         ValueType const &bottomStateValue) {
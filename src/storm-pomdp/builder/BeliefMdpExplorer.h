@@ -4,6 +4,7 @@
 #include <vector>
 #include <deque>
 #include <map>
+#include <set>
 #include <boost/optional.hpp>
 
 
@@ -58,6 +59,19 @@ namespace storm {
 
             BeliefId exploreNextState();
 
+            /*!
+             * Computes the successor beliefs of the states at the front of the exploration queue in parallel (see BeliefManager::prepareExpansions).
+             * States with one of the given target observations and states whose behavior is restored from the previous exploration are skipped.
+             *
+             * @param maxNumberOfStates The maximal number of states to consider.
+             * @param numberOfThreads The number of threads to use.
+             * @param targetObservations The observations of states that are not expanded.
+             * @param observationResolutions If given, the successor beliefs are triangulated using these resolutions.
+             * @return The number of states from the front of the exploration queue that were considered.
+             */
+            uint64_t prepareExpansionsOfNextStates(uint64_t maxNumberOfStates, uint64_t numberOfThreads, std::set<uint32_t> const &targetObservations,
+                                                   boost::optional<std::vector<BeliefValueType>> const &observationResolutions = boost::none);
+
             void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
                                              ValueType const &bottomStateValue = storm::utility::zero<ValueType>());
 
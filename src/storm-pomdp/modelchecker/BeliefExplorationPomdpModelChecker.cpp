@@ -1,6 +1,9 @@
 #include "BeliefExplorationPomdpModelChecker.h"
 
+#include <condition_variable>
+#include <thread>
 #include <tuple>
+#include <sys/resource.h>
 
 #include <boost/algorithm/string.hpp>
 
@@ -23,12 +26,68 @@
 #include "storm-pomdp/modelchecker/TrivialPomdpValueBoundsModelChecker.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace pomdp {
         namespace modelchecker {
+
+            // The number of states per thread whose successor beliefs are computed in one parallel step of the exploration.
+            static const uint64_t explorationBatchSizePerThread = 256;
+
+            // The maximal time between two checks of the time and memory budgets.
+            static const std::chrono::milliseconds budgetCheckInterval(100);
+
+            namespace {
+                /*!
+                 * Repeatedly executes the given task on a separate thread (waiting for the given interval in between) until the object is destroyed.
+                 */
+                class PeriodicTask {
+                public:
+                    PeriodicTask(std::chrono::milliseconds const& interval, std::function<void ()> const& task) : stopRequested(false) {
+                        thread = std::thread([this, interval, task] () {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            while (!stopCondition.wait_for(lock, interval, [this] () { return stopRequested; })) {
+                                lock.unlock();
+                                task();
+                                lock.lock();
+                            }
+                        });
+                    }
+
+                    ~PeriodicTask() {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            stopRequested = true;
+                        }
+                        stopCondition.notify_one();
+                        thread.join();
+                    }
+
+                private:
+                    std::mutex mutex;
+                    std::condition_variable stopCondition;
+                    bool stopRequested;
+                    std::thread thread;
+                };
+
+                /*!
+                 * Retrieves the peak resident memory of this process in megabytes.
+                 */
+                uint64_t getPeakMemoryInMegabytes() {
+                    struct rusage ru;
+                    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+                    // For Mac OS, this is returned in bytes.
+                    return ru.ru_maxrss / 1024 / 1024;
+#else
+                    // For Linux, this is returned in kilobytes.
+                    return ru.ru_maxrss / 1024;
+#endif
+                }
+            }
             
             template<typename PomdpModelType, typename BeliefValueType>
             BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::Result::Result(ValueType lower, ValueType upper) : lowerBound(lower), upperBound(upper) {
@@ -68,16 +127,28 @@ namespace storm {
             }
             
             template<typename PomdpModelType, typename BeliefValueType>
-            BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::Statistics::Statistics() :  beliefMdpDetectedToBeFinite(false), refinementFixpointDetected(false), overApproximationBuildAborted(false), underApproximationBuildAborted(false), aborted(false) {
+            BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::Statistics::Statistics() :  beliefMdpDetectedToBeFinite(false), refinementFixpointDetected(false), overApproximationBuildAborted(false), underApproximationBuildAborted(false), aborted(false), budgetExceeded(false) {
                 // intentionally left empty;
             }
             
             template<typename PomdpModelType, typename BeliefValueType>
-            BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::BeliefExplorationPomdpModelChecker(std::shared_ptr<PomdpModelType> pomdp, Options options) : inputPomdp(pomdp), options(options) {
+            BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::BeliefExplorationPomdpModelChecker(std::shared_ptr<PomdpModelType> pomdp, Options options) : inputPomdp(pomdp), options(options), boundsReportInterval(0), budgetExceeded(false) {
                 STORM_LOG_ASSERT(inputPomdp, "The given POMDP is not initialized.");
                 STORM_LOG_ERROR_COND(inputPomdp->isCanonic(), "Input Pomdp is not known to be canonic. This might lead to unexpected verification results.");
 
                 cc = storm::utility::ConstantsComparator<ValueType>(storm::utility::convertNumber<ValueType>(this->options.numericPrecision), false);
+                if (storm::NumberTraits<ValueType>::IsExact || storm::NumberTraits<BeliefValueType>::IsExact) {
+                    STORM_LOG_WARN_COND(this->options.explorationThreads == 1, "Successor beliefs are computed sequentially as exact arithmetic is used.");
+                    this->options.explorationThreads = 1;
+                } else {
+                    this->options.explorationThreads = storm::utility::parallel::getNumberOfThreads(this->options.explorationThreads);
+                }
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::setBoundsReporter(std::function<void (Result const&, double)> const& reporter, uint64_t intervalInMilliseconds) {
+                boundsReporter = reporter;
+                boundsReportInterval = intervalInMilliseconds;
             }
 
             template<typename PomdpModelType, typename BeliefValueType>
@@ -90,6 +161,18 @@ namespace storm {
                 // Reset all collected statistics
                 statistics = Statistics();
                 statistics.totalTime.start();
+                
+                // Start a thread that reports the current bounds and watches the budgets
+                publishedBounds = boost::none;
+                budgetExceeded = false;
+                std::unique_ptr<PeriodicTask> monitor;
+                if (boundsReporter || options.timeBudget || options.memoryBudget) {
+                    auto start = std::chrono::steady_clock::now();
+                    auto nextReport = start + std::chrono::milliseconds(boundsReportInterval);
+                    auto interval = boundsReporter ? std::min(budgetCheckInterval, std::chrono::milliseconds(std::max<uint64_t>(boundsReportInterval, 1))) : budgetCheckInterval;
+                    monitor = std::make_unique<PeriodicTask>(interval, [this, start, nextReport] () mutable { this->monitorCheck(start, nextReport); });
+                }
+                
                 // Extract the relevant information from the formula
                 auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(pomdp(), formula);
                 
@@ -98,6 +181,7 @@ namespace storm {
                 uint64_t initialPomdpState = pomdp().getInitialStates().getNextSetIndex(0);
                 Result result(initialPomdpValueBounds.getHighestLowerBound(initialPomdpState), initialPomdpValueBounds.getSmallestUpperBound(initialPomdpState));
                 STORM_LOG_INFO("Initial value bounds are [" << result.lowerBound << ", " <<  result.upperBound << "]");
+                publishBounds(result, formulaInfo.minimize());
 
                 boost::optional<std::string> rewardModelName;
                 std::set<uint32_t> targetObservations;
@@ -132,21 +216,73 @@ namespace storm {
                 } else {
                     computeReachabilityOTF(targetObservations, formulaInfo.minimize(), rewardModelName, initialPomdpValueBounds, result);
                 }
-                // "clear" results in case they were actually not requested (this will make the output a bit more clear)
-                if ((formulaInfo.minimize() && !options.discretize) || (formulaInfo.maximize() && !options.unfold)) {
-                    result.lowerBound = -storm::utility::infinity<ValueType>();
-                }
-                if ((formulaInfo.maximize() && !options.discretize) || (formulaInfo.minimize() && !options.unfold)) {
-                    result.upperBound = storm::utility::infinity<ValueType>();
-                }
+                clearUnrequestedBounds(result, formulaInfo.minimize());
                 
+                monitor.reset();
                 if (storm::utility::resources::isTerminate()) {
                     statistics.aborted = true;
                 }
+                if (budgetExceeded) {
+                    statistics.budgetExceeded = true;
+                }
                 statistics.totalTime.stop();
+                if (boundsReporter) {
+                    boundsReporter(result, statistics.totalTime.getTimeInMilliseconds() / 1000.0);
+                }
                 return result;
             }
             
+            template<typename PomdpModelType, typename BeliefValueType>
+            void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::clearUnrequestedBounds(Result& result, bool min) const {
+                // "clear" results in case they were actually not requested (this will make the output a bit more clear)
+                if ((min && !options.discretize) || (!min && !options.unfold)) {
+                    result.lowerBound = -storm::utility::infinity<ValueType>();
+                }
+                if ((!min && !options.discretize) || (min && !options.unfold)) {
+                    result.upperBound = storm::utility::infinity<ValueType>();
+                }
+            }
+            
+            template<typename PomdpModelType, typename BeliefValueType>
+            void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::publishBounds(Result const& result, bool min) {
+                if (boundsReporter) {
+                    Result bounds = result;
+                    clearUnrequestedBounds(bounds, min);
+                    std::lock_guard<std::mutex> lock(publishedBoundsMutex);
+                    publishedBounds = bounds;
+                }
+            }
+            
+            template<typename PomdpModelType, typename BeliefValueType>
+            bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::isExplorationStopped() const {
+                return budgetExceeded || storm::utility::resources::isTerminate();
+            }
+            
+            template<typename PomdpModelType, typename BeliefValueType>
+            void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::monitorCheck(std::chrono::steady_clock::time_point const& start, std::chrono::steady_clock::time_point& nextReport) {
+                auto now = std::chrono::steady_clock::now();
+                if (boundsReporter && now >= nextReport) {
+                    boost::optional<Result> bounds;
+                    {
+                        std::lock_guard<std::mutex> lock(publishedBoundsMutex);
+                        bounds = publishedBounds;
+                    }
+                    if (bounds) {
+                        boundsReporter(bounds.get(), std::chrono::duration<double>(now - start).count());
+                    }
+                    nextReport = now + std::chrono::milliseconds(boundsReportInterval);
+                }
+                if (!budgetExceeded && !storm::utility::resources::isTerminate()) {
+                    if (options.timeBudget && now - start >= std::chrono::seconds(options.timeBudget.get())) {
+                        STORM_LOG_WARN("Time budget of " << options.timeBudget.get() << "s exceeded. Returning the best bounds found so far.");
+                        budgetExceeded = true;
+                    } else if (options.memoryBudget && getPeakMemoryInMegabytes() >= options.memoryBudget.get()) {
+                        STORM_LOG_WARN("Memory budget of " << options.memoryBudget.get() << "MB exceeded. Returning the best bounds found so far.");
+                        budgetExceeded = true;
+                    }
+                }
+            }
+            
             template<typename PomdpModelType, typename BeliefValueType>
             void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::printStatisticsToStream(std::ostream& stream) const {
                 stream << "##### Grid Approximation Statistics ######" << std::endl;
@@ -160,6 +296,9 @@ namespace storm {
                 if (statistics.aborted) {
                     stream << "# Computation aborted early" << std::endl;
                 }
+                if (statistics.budgetExceeded) {
+                    stream << "# Computation stopped as the time or memory budget was exceeded" << std::endl;
+                }
                 
                 stream << "# Total check time: " << statistics.totalTime << std::endl;
                 
@@ -235,6 +374,7 @@ namespace storm {
                         STORM_LOG_INFO(printInfo());
                         ValueType& resultValue = min ? result.lowerBound : result.upperBound;
                         resultValue = approx->getComputedValueAtInitialState();
+                        publishBounds(result, min);
                     }
                 }
                 if (options.unfold) { // Underapproximation (uses a fresh Belief manager)
@@ -266,6 +406,7 @@ namespace storm {
                         STORM_LOG_INFO(printInfo());
                         ValueType& resultValue = min ? result.upperBound : result.lowerBound;
                         resultValue = approx->getComputedValueAtInitialState();
+                        publishBounds(result, min);
                     }
                 }
             }
@@ -298,6 +439,7 @@ namespace storm {
                     bool betterBound = min ? result.updateLowerBound(newValue) : result.updateUpperBound(newValue);
                     if (betterBound) {
                         STORM_LOG_INFO("Over-approx result for refinement improved after " << statistics.totalTime << " seconds in refinement step #" << statistics.refinementSteps.get() << ". New value is '" << newValue << "'." << std::endl);
+                        publishBounds(result, min);
                     }
                 }
                 
@@ -325,6 +467,7 @@ namespace storm {
                     bool betterBound = min ? result.updateUpperBound(newValue) : result.updateLowerBound(newValue);
                     if (betterBound) {
                         STORM_LOG_INFO("Under-approx result for refinement improved after " << statistics.totalTime << " seconds in refinement step #" << statistics.refinementSteps.get() << ". New value is '" << newValue << "'." << std::endl);
+                        publishBounds(result, min);
                     }
                 }
                 
@@ -371,6 +514,7 @@ namespace storm {
                             bool betterBound = min ? result.updateLowerBound(newValue) : result.updateUpperBound(newValue);
                             if (betterBound) {
                                 STORM_LOG_INFO("Over-approx result for refinement improved after " << statistics.totalTime << " in refinement step #" << (statistics.refinementSteps.get() + 1) << ". New value is '" << newValue << "'.");
+                                publishBounds(result, min);
                             }
                         } else {
                             break;
@@ -388,13 +532,14 @@ namespace storm {
                             bool betterBound = min ? result.updateUpperBound(newValue) : result.updateLowerBound(newValue);
                             if (betterBound) {
                                 STORM_LOG_INFO("Under-approx result for refinement improved after " << statistics.totalTime << " in refinement step #" << (statistics.refinementSteps.get() + 1) << ". New value is '" << newValue << "'.");
+                                publishBounds(result, min);
                             }
                         } else {
                             break;
                         }
                     }
                     
-                    if (storm::utility::resources::isTerminate()) {
+                    if (isExplorationStopped()) {
                         break;
                     } else {
                         ++statistics.refinementSteps.get();
@@ -558,6 +703,7 @@ namespace storm {
                 bool timeLimitExceeded = false;
                 std::map<uint32_t, typename ExplorerType::SuccessorObservationInformation> gatheredSuccessorObservations; // Declare here to avoid reallocations
                 uint64_t numRewiredOrExploredStates = 0;
+                uint64_t numPreparedStates = 0;
                 while (overApproximation->hasUnexploredState()) {
                     if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
                         STORM_LOG_INFO("Exploration time limit exceeded.");
@@ -566,7 +712,14 @@ namespace storm {
                         fixPoint = false;
                     }
 
+                    if (options.explorationThreads > 1 && numPreparedStates == 0) {
+                        // Compute the successors of the next states in parallel
+                        numPreparedStates = overApproximation->prepareExpansionsOfNextStates(options.explorationThreads * explorationBatchSizePerThread, options.explorationThreads, targetObservations, observationResolutionVector);
+                    }
                     uint64_t currId = overApproximation->exploreNextState();
+                    if (numPreparedStates > 0) {
+                        --numPreparedStates;
+                    }
                     bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
                     if (!hasOldBehavior) {
                         STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because a new state is explored");
@@ -712,12 +865,12 @@ namespace storm {
                         }
                     }
                     
-                    if (storm::utility::resources::isTerminate()) {
+                    if (isExplorationStopped()) {
                         break;
                     }
                 }
                 
-                if (storm::utility::resources::isTerminate()) {
+                if (isExplorationStopped()) {
                     // don't overwrite statistics of a previous, successful computation
                     if (!statistics.overApproximationStates) {
                         statistics.overApproximationBuildAborted = true;
@@ -766,12 +919,20 @@ namespace storm {
                     explorationTime.start();
                 }
                 bool timeLimitExceeded = false;
+                uint64_t numPreparedStates = 0;
                 while (underApproximation->hasUnexploredState()) {
                     if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
                         STORM_LOG_INFO("Exploration time limit exceeded.");
                         timeLimitExceeded = true;
                     }
+                    if (options.explorationThreads > 1 && numPreparedStates == 0) {
+                        // Compute the successors of the next states in parallel
+                        numPreparedStates = underApproximation->prepareExpansionsOfNextStates(options.explorationThreads * explorationBatchSizePerThread, options.explorationThreads, targetObservations);
+                    }
                     uint64_t currId = underApproximation->exploreNextState();
+                    if (numPreparedStates > 0) {
+                        --numPreparedStates;
+                    }
                     
                     uint32_t currObservation = beliefManager->getBeliefObservation(currId);
                     bool stateAlreadyExplored = refine && underApproximation->currentStateHasOldBehavior() && !underApproximation->getCurrentStateWasTruncated();
@@ -831,12 +992,12 @@ namespace storm {
                             }
                         }
                     }
-                    if (storm::utility::resources::isTerminate()) {
+                    if (isExplorationStopped()) {
                         break;
                     }
                 }
                 
-                if (storm::utility::resources::isTerminate()) {
+                if (isExplorationStopped()) {
                     // don't overwrite statistics of a previous, successful computation
                     if (!statistics.underApproximationStates) {
                         statistics.underApproximationBuildAborted = true;
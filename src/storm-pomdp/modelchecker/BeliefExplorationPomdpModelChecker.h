@@ -1,3 +1,8 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+
 #include "storm/api/storm.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/utility/logging.h"
@@ -41,6 +46,15 @@ namespace storm {
                 
                 Result check(storm::logic::Formula const& formula);
 
+                /*!
+                 * Sets a function that is called periodically during check with the currently known bounds and the number of seconds since the check started.
+                 * It is also called once with the final bounds. The function is called from a separate thread, but never concurrently with itself.
+                 *
+                 * @param reporter The function to call.
+                 * @param intervalInMilliseconds The time between two calls.
+                 */
+                void setBoundsReporter(std::function<void (Result const&, double)> const& reporter, uint64_t intervalInMilliseconds);
+
                 void printStatisticsToStream(std::ostream& stream) const;
                 
             private:
@@ -95,6 +109,29 @@ namespace storm {
                 BeliefValueType rateObservation(typename ExplorerType::SuccessorObservationInformation const& info, BeliefValueType const& observationResolution, BeliefValueType const& maxResolution);
                 
                 std::vector<BeliefValueType> getObservationRatings(std::shared_ptr<ExplorerType> const& overApproximation, std::vector<BeliefValueType> const& observationResolutionVector);
+
+                /*!
+                 * Sets the bounds that were not requested (i.e., that are not computed by the enabled approximations) to -/+ infinity.
+                 */
+                void clearUnrequestedBounds(Result& result, bool min) const;
+
+                /*!
+                 * Makes the given bounds available to the bounds reporter.
+                 */
+                void publishBounds(Result const& result, bool min);
+
+                /*!
+                 * Retrieves whether the exploration of the belief MDPs has to stop, either because termination was requested
+                 * (e.g. by a signal) or because the time or memory budget is exceeded. An exceeded budget does not interrupt
+                 * the computation of values on an MDP whose exploration is already finished.
+                 */
+                bool isExplorationStopped() const;
+
+                /*!
+                 * Reports the published bounds (if there is a reporter) and marks the budget as exceeded if the time or memory
+                 * budget is exceeded. This is called periodically from a separate thread during check.
+                 */
+                void monitorCheck(std::chrono::steady_clock::time_point const& start, std::chrono::steady_clock::time_point& nextReport);
                 
                 struct Statistics {
                     Statistics();
@@ -117,6 +154,7 @@ namespace storm {
                     boost::optional<uint64_t> underApproximationStateLimit;
                     
                     bool aborted;
+                    bool budgetExceeded;
                 };
                 Statistics statistics;
                 
@@ -125,6 +163,13 @@ namespace storm {
                 
                 Options options;
                 storm::utility::ConstantsComparator<ValueType> cc;
+
+                std::function<void (Result const&, double)> boundsReporter;
+                uint64_t boundsReportInterval;
+                // The most recent bounds (accessed by the thread that monitors the check)
+                std::mutex publishedBoundsMutex;
+                boost::optional<Result> publishedBounds;
+                std::atomic<bool> budgetExceeded;
             };
 
         }
@@ -19,6 +19,9 @@ namespace storm {
                 boost::optional<uint64_t> refineStepLimit;
                 ValueType refinePrecision = storm::utility::zero<ValueType>();
                 boost::optional<uint64_t> explorationTimeLimit;
+                boost::optional<uint64_t> timeBudget; // In seconds. When exceeded, the computation stops and the best bounds found so far are returned.
+                boost::optional<uint64_t> memoryBudget; // In megabytes (peak resident memory). When exceeded, the computation stops and the best bounds found so far are returned.
+                uint64_t explorationThreads = 1; // The number of threads used to compute successor beliefs (0 means the number of hardware threads). The results do not depend on this number.
                 
                 // Controlparameters for the refinement heuristic
                 // Discretization Resolution
@@ -1,9 +1,13 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace storage {
@@ -29,14 +33,23 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-            std::size_t seed = 0;
-            // Assumes that beliefs are ordered
-            for (auto const &entry : belief) {
-                boost::hash_combine(seed, entry.first);
-                boost::hash_combine(seed, entry.second);
-            }
-            return seed;
+        BeliefManager<PomdpType, BeliefValueType, StateType>::StoredBelief::StoredBelief(BeliefEntry const *first, BeliefEntry const *last) : first(first), last(last) {
+            // Intentionally left empty
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEntry const *BeliefManager<PomdpType, BeliefValueType, StateType>::StoredBelief::begin() const {
+            return first;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEntry const *BeliefManager<PomdpType, BeliefValueType, StateType>::StoredBelief::end() const {
+            return last;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::StoredBelief::size() const {
+            return last - first;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -44,6 +57,7 @@ namespace storm {
                 : pomdp(pomdp), triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
             beliefToIdMap.resize(pomdp.getNrObservations());
+            beliefOffsets.push_back(0);
             initialBeliefId = computeInitialBelief();
         }
 
@@ -93,7 +107,8 @@ namespace storm {
         BeliefManager<PomdpType, BeliefValueType, StateType>::getWeightedSum(BeliefId const &beliefId, std::vector<ValueType> const &summands) {
             ValueType result = storm::utility::zero<ValueType>();
             for (auto const &entry : getBelief(beliefId)) {
-                result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands.at(entry.first));
+                STORM_LOG_ASSERT(entry.first < summands.size(), "Belief refers to state " << entry.first << " but only " << summands.size() << " summands are given.");
+                result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands[entry.first]);
             }
             return result;
         }
@@ -133,12 +148,13 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
         BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefId beliefId, BeliefValueType resolution) {
-            return triangulateBelief(getBelief(beliefId), resolution);
+            StoredBelief storedBelief = getBelief(beliefId);
+            return triangulateBelief(BeliefType(boost::container::ordered_unique_range, storedBelief.begin(), storedBelief.end()), resolution);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         template<typename DistributionType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const {
             auto insertionRes = distr.emplace(state, value);
             if (!insertionRes.second) {
                 insertionRes.first->second += value;
@@ -155,7 +171,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-            return beliefs.size();
+            return beliefOffsets.size() - 1;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -172,23 +188,24 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::StoredBelief BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
             STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
             STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+            return StoredBelief(beliefEntries.data() + beliefOffsets[id], beliefEntries.data() + beliefOffsets[id + 1]);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
             uint32_t obs = getBeliefObservation(belief);
             STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+            BeliefId id = findBeliefId(belief, obs, computeHash(belief));
+            STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+            return id;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+        template<typename BeliefRangeType>
+        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefRangeType const &belief) const {
             std::stringstream str;
             str << "{ ";
             bool first = true;
@@ -205,7 +222,8 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+        template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const {
             if (first.size() != second.size()) {
                 return false;
             }
@@ -223,7 +241,8 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+        template<typename BeliefRangeType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefRangeType const &belief) const {
             BeliefValueType sum = storm::utility::zero<ValueType>();
             boost::optional<uint32_t> observation;
             for (auto const &entry : belief) {
@@ -264,12 +283,12 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, GridPointTriangulation const &triangulation) const {
             if (triangulation.weights.size() != triangulation.gridPoints.size()) {
                 STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
                 return false;
             }
-            if (triangulation.size() == 0) {
+            if (triangulation.weights.empty()) {
                 STORM_LOG_ERROR("Empty triangulation.");
                 return false;
             }
@@ -288,7 +307,7 @@ namespace storm {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
                 weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
+                BeliefType const &gridPoint = triangulation.gridPoints[i];
                 for (auto const &pointEntry : gridPoint) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
                     triangulatedValue += triangulation.weights[i] * pointEntry.second;
@@ -309,14 +328,15 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        template<typename BeliefRangeType>
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefRangeType const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -365,14 +385,14 @@ namespace storm {
                             gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    result.gridPoints.push_back(std::move(gridPoint));
                 }
                 previousSortedDiff = currentSortedDiff++;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -409,14 +429,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::GridPointTriangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
+            GridPointTriangulation result;
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
                 result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                result.gridPoints.push_back(belief);
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
@@ -430,17 +450,30 @@ namespace storm {
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation of belief " << toString(belief) << ".");
             return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+            GridPointTriangulation gridPointTriangulation = computeTriangulation(belief, resolution);
+            Triangulation result;
+            result.weights = std::move(gridPointTriangulation.weights);
+            result.gridPoints.reserve(gridPointTriangulation.gridPoints.size());
+            for (auto const &gridPoint : gridPointTriangulation.gridPoints) {
+                result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            }
+            return result;
+        }
 
-            BeliefType belief = getBelief(beliefId);
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::SuccessorBeliefs
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                                      boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            SuccessorBeliefs destinations;
+
+            StoredBelief belief = getBelief(beliefId);
 
             // Find the probability we go to each observation
             BeliefType successorObs; // This is actually not a belief but has the same type
@@ -470,20 +503,84 @@ namespace storm {
 
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
+                    GridPointTriangulation triangulation = computeTriangulation(successorBelief, observationTriangulationResolutions.get()[successor.first]);
+                    for (size_t j = 0; j < triangulation.weights.size(); ++j) {
                         // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                        destinations.emplace_back(std::move(triangulation.gridPoints[j]), triangulation.weights[j] * successor.second);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    destinations.emplace_back(std::move(successorBelief), successor.second);
                 }
             }
 
             return destinations;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
+            // Use the prepared successors (if available). Otherwise, compute them now.
+            SuccessorBeliefs successors;
+            bool successorsPrepared = false;
+            auto preparedIt = preparedExpansions.find(beliefId);
+            if (preparedIt != preparedExpansions.end() && preparedIt->second[actionIndex] && preparedExpansionsResolutions.is_initialized() == observationTriangulationResolutions.is_initialized()) {
+                STORM_LOG_ASSERT(!observationTriangulationResolutions || preparedExpansionsResolutions.get() == observationTriangulationResolutions.get(), "Expansion was prepared for different resolutions.");
+                successors = std::move(preparedIt->second[actionIndex].get());
+                preparedIt->second[actionIndex] = boost::none;
+                successorsPrepared = true;
+            }
+            if (!successorsPrepared) {
+                successors = computeSuccessorBeliefs(beliefId, actionIndex, observationTriangulationResolutions);
+            }
+
+            // Assigning the ids happens sequentially (and in a fixed order), which makes the ids independent of how the successors were computed.
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            destinations.reserve(successors.size());
+            for (auto const &successor : successors) {
+                destinations.emplace_back(getOrAddBeliefId(successor.first), successor.second);
+            }
+            return destinations;
+        }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansions(std::vector<BeliefId> const &beliefIds, uint64_t numberOfThreads,
+                                                                                     boost::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+            preparedExpansions.clear();
+            preparedExpansionsResolutions = observationResolutions;
+            if (beliefIds.empty()) {
+                return;
+            }
+
+            // Create the slots for the results first so that the threads do not modify the map.
+            std::vector<std::vector<boost::optional<SuccessorBeliefs>>*> results;
+            results.reserve(beliefIds.size());
+            for (auto const &beliefId : beliefIds) {
+                auto &beliefResults = preparedExpansions[beliefId];
+                if (beliefResults.empty()) {
+                    beliefResults.resize(getBeliefNumberOfChoices(beliefId));
+                    results.push_back(&beliefResults);
+                } else {
+                    // The belief occurs multiple times.
+                    results.push_back(nullptr);
+                }
+            }
+
+            // The belief store is only read while computing the successors.
+            std::atomic<uint64_t> nextBeliefIndex(0);
+            storm::utility::parallel::runOnThreads(std::min<uint64_t>(numberOfThreads, beliefIds.size()), [&] (uint64_t) {
+                for (uint64_t beliefIndex = nextBeliefIndex++; beliefIndex < beliefIds.size(); beliefIndex = nextBeliefIndex++) {
+                    if (results[beliefIndex] != nullptr) {
+                        auto &beliefResults = *results[beliefIndex];
+                        for (uint64_t action = 0; action < beliefResults.size(); ++action) {
+                            beliefResults[action] = computeSuccessorBeliefs(beliefIds[beliefIndex], action, observationResolutions);
+                        }
+                    }
+                }
+            });
         }
 
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::computeInitialBelief() {
             STORM_LOG_ASSERT(pomdp.getInitialStates().getNumberOfSetBits() < 2,
@@ -497,17 +594,47 @@ namespace storm {
             return getOrAddBeliefId(belief);
         }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::computeHash(BeliefType const &belief) {
+            std::size_t seed = 0;
+            // Assumes that beliefs are ordered
+            for (auto const &entry : belief) {
+                boost::hash_combine(seed, entry.first);
+                boost::hash_combine(seed, entry.second);
+            }
+            return seed;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId
+        BeliefManager<PomdpType, BeliefValueType, StateType>::findBeliefId(BeliefType const &belief, uint32_t observation, uint64_t hash) const {
+            auto candidates = beliefToIdMap[observation].equal_range(hash);
+            for (auto candidateIt = candidates.first; candidateIt != candidates.second; ++candidateIt) {
+                // Beliefs are only identified if they are exactly equal (as before, the precision of the comparator is not taken into account here).
+                StoredBelief candidate = getBelief(candidateIt->second);
+                if (candidate.size() == belief.size() && std::equal(candidate.begin(), candidate.end(), belief.begin(), [] (BeliefEntry const &storedEntry, typename BeliefType::value_type const &entry) {
+                    return storedEntry.first == entry.first && storedEntry.second == entry.second;
+                })) {
+                    return candidateIt->second;
+                }
+            }
+            return noId();
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
             uint32_t obs = getBeliefObservation(belief);
             STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
+            uint64_t hash = computeHash(belief);
+            BeliefId id = findBeliefId(belief, obs, hash);
+            if (id == noId()) {
+                // Add the new belief to the store
+                id = getNumberOfBeliefIds();
+                beliefEntries.insert(beliefEntries.end(), belief.begin(), belief.end());
+                beliefOffsets.push_back(beliefEntries.size());
+                beliefToIdMap[obs].emplace(hash, id);
             }
-            // Return the id
-            return insertioRes.first->second;
+            return id;
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
@@ -58,7 +58,7 @@ namespace storm {
             Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
             template<typename DistributionType>
-            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
             void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -69,12 +69,49 @@ namespace storm {
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+            /*!
+             * Computes the successor beliefs of all actions of the given beliefs using the given number of threads. Subsequent calls of expand
+             * (if no resolutions are given) or expandAndTriangulate (with the given resolutions) for these beliefs then only need to assign ids
+             * to the precomputed successors. As ids are only assigned in these subsequent calls, the ids do not depend on the number of threads.
+             * Previously prepared expansions that have not been used are discarded.
+             *
+             * @param beliefIds The beliefs whose expansions are prepared.
+             * @param numberOfThreads The number of threads to use.
+             * @param observationResolutions If given, the successor beliefs are triangulated using these resolutions.
+             */
+            void prepareExpansions(std::vector<BeliefId> const &beliefIds, uint64_t numberOfThreads, boost::optional<std::vector<BeliefValueType>> const &observationResolutions = boost::none);
+
         private:
 
-            struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
+            typedef std::pair<StateType, BeliefValueType> BeliefEntry;
+
+            /*!
+             * A belief whose entries are kept in the belief store. Iterating over it yields the (state, value) pairs ordered by state.
+             * The view is invalidated as soon as a new belief is added to the store.
+             */
+            class StoredBelief {
+            public:
+                StoredBelief(BeliefEntry const *first, BeliefEntry const *last);
+                BeliefEntry const *begin() const;
+                BeliefEntry const *end() const;
+                uint64_t size() const;
+
+            private:
+                BeliefEntry const *first;
+                BeliefEntry const *last;
+            };
+
+            /*!
+             * A triangulation whose grid points are not (yet) associated with belief ids.
+             */
+            struct GridPointTriangulation {
+                std::vector<BeliefType> gridPoints;
+                std::vector<BeliefValueType> weights;
             };
 
+            /// Successor beliefs (or grid points) together with the probability to reach them.
+            typedef std::vector<std::pair<BeliefType, ValueType>> SuccessorBeliefs;
+
             struct FreudenthalDiff {
                 FreudenthalDiff(StateType const &dimension, BeliefValueType &&diff);
 
@@ -83,43 +120,75 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            StoredBelief getBelief(BeliefId const &id) const;
 
             BeliefId getId(BeliefType const &belief) const;
 
-            std::string toString(BeliefType const &belief) const;
+            template<typename BeliefRangeType>
+            std::string toString(BeliefRangeType const &belief) const;
+
+            template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+            bool isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const;
 
-            bool isEqual(BeliefType const &first, BeliefType const &second) const;
+            template<typename BeliefRangeType>
+            bool assertBelief(BeliefRangeType const &belief) const;
 
-            bool assertBelief(BeliefType const &belief) const;
+            bool assertTriangulation(BeliefType const &belief, GridPointTriangulation const &triangulation) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            template<typename BeliefRangeType>
+            uint32_t getBeliefObservation(BeliefRangeType const &belief) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            /*!
+             * Triangulates the given belief without assigning ids to the grid points. This does not modify the belief manager.
+             */
+            GridPointTriangulation computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const;
 
             Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+            /*!
+             * Computes the (potentially triangulated) successor beliefs of the given belief and action without assigning ids to them.
+             * This does not modify the belief manager and can therefore be called concurrently.
+             */
+            SuccessorBeliefs computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
             std::vector<std::pair<BeliefId, ValueType>>
             expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
 
             BeliefId computeInitialBelief();
 
+            /*!
+             * Computes the hash of the given belief. As the entries of a belief are ordered, equal beliefs get the same hash.
+             */
+            static uint64_t computeHash(BeliefType const &belief);
+
+            /*!
+             * Retrieves the id of the given belief with the given hash or noId() if the belief is not in the store.
+             */
+            BeliefId findBeliefId(BeliefType const &belief, uint32_t observation, uint64_t hash) const;
+
             BeliefId getOrAddBeliefId(BeliefType const &belief);
 
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            // The entries of all beliefs. The entries of the belief with id i are at positions beliefOffsets[i], ..., beliefOffsets[i+1]-1.
+            std::vector<BeliefEntry> beliefEntries;
+            std::vector<uint64_t> beliefOffsets;
+            // For each observation, maps the hashes of the beliefs with that observation to their ids.
+            std::vector<std::unordered_multimap<uint64_t, BeliefId>> beliefToIdMap;
             BeliefId initialBeliefId;
             
             storm::utility::ConstantsComparator<ValueType> cc;
             
             TriangulationMode triangulationMode;
+
+            // Successor beliefs that were computed in advance (see prepareExpansions), indexed by belief id and action.
+            std::unordered_map<BeliefId, std::vector<boost::optional<SuccessorBeliefs>>> preparedExpansions;
+            boost::optional<std::vector<BeliefValueType>> preparedExpansionsResolutions;
             
         };
     }
@@ -2,6 +2,7 @@
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/BinaryEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -87,15 +88,12 @@ namespace storm {
          */
         template<typename ValueType>
         storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options) {
-            std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+            STORM_LOG_THROW(model.isPrismProgram() || model.isJaniModel(), storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
+            // Passing the model description (rather than a generator) allows the builder to create further generators.
             if (model.isPrismProgram()) {
-                generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options);
-            } else if (model.isJaniModel()) {
-                generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(model.asJaniModel(), options);
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
+                return storm::builder::ExplicitModelBuilder<ValueType>(model.asPrismProgram(), options);
             }
-            return storm::builder::ExplicitModelBuilder<ValueType>(generator);
+            return storm::builder::ExplicitModelBuilder<ValueType>(model.asJaniModel(), options);
         }
 
         template<typename ValueType>
@@ -163,6 +161,11 @@ namespace storm {
             return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
         }
         
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const& binaryFile) {
+            return storm::parser::BinaryEncodingParser<ValueType>::parseModel(binaryFile);
+        }
+        
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
@@ -17,6 +17,7 @@
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
 
@@ -299,6 +300,86 @@ namespace storm {
             Environment env;
             return verifyWithSparseEngine(env, model, task);
         }
+
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngineForTimeBounds(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& upperTimeBounds) {
+            storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+            return modelchecker.computeBoundedUntilProbabilitiesForTimeBounds(env, task, upperTimeBounds);
+        }
+
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type verifyWithSparseEngineForTimeBounds(storm::Environment const& env, std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& ma, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& upperTimeBounds) {
+            if (!ma->isClosed()) {
+                STORM_LOG_WARN("Closing Markov automaton. Consider closing the MA before verification.");
+                ma->close();
+            }
+            storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<ValueType>> modelchecker(*ma);
+            return modelchecker.computeBoundedUntilProbabilitiesForTimeBounds(env, task, upperTimeBounds);
+        }
+
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type verifyWithSparseEngineForTimeBounds(storm::Environment const&, std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&, std::vector<double> const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify MAs with this data type.");
+        }
+
+        /*!
+         * Verifies a time-bounded reachability property for each of the given upper time bounds, i.e., computes the
+         * curve of probabilities over time. The formula of the task is a probability operator formula whose time bound
+         * (if any) is replaced by the given ones. For CTMCs, all time bounds share one uniformization run.
+         *
+         * @return For each time bound, the result of the check.
+         */
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngineForTimeBounds(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& upperTimeBounds) {
+            STORM_LOG_THROW(task.getFormula().isProbabilityOperatorFormula(), storm::exceptions::NotSupportedException, "Only probability operator formulas can be checked for several time bounds.");
+            auto pathTask = task.substituteFormula(task.getFormula().asProbabilityOperatorFormula().getSubformula());
+            if (model->getType() == storm::models::ModelType::Ctmc) {
+                return verifyWithSparseEngineForTimeBounds(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), pathTask, upperTimeBounds);
+            } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
+                return verifyWithSparseEngineForTimeBounds(env, model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), pathTask, upperTimeBounds);
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checking several time bounds at once is not supported for models of type " << model->getType() << ".");
+            }
+        }
+
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngineForTimeBounds(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& upperTimeBounds) {
+            Environment env;
+            return verifyWithSparseEngineForTimeBounds(env, model, task, upperTimeBounds);
+        }
+
+        //
+        // Verifying with Statistical engine
+        //
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::storage::Scheduler<ValueType>> const& scheduler = nullptr) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result;
+            if (model->getType() == storm::models::ModelType::Dtmc) {
+                storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*model->template as<storm::models::sparse::Dtmc<ValueType>>());
+                if (modelchecker.canHandle(task)) {
+                    result = modelchecker.check(env, task);
+                }
+            } else if (model->getType() == storm::models::ModelType::Mdp) {
+                storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*model->template as<storm::models::sparse::Mdp<ValueType>>(), scheduler);
+                if (modelchecker.canHandle(task)) {
+                    result = modelchecker.check(env, task);
+                }
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type " << model->getType() << " is not supported by the statistical engine.");
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(storm::Environment const&, std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&, std::shared_ptr<storm::storage::Scheduler<ValueType>> const& = nullptr) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical engine does not support data type.");
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+            Environment env;
+            return verifyWithStatisticalEngine(env, model, task);
+        }
         
         template<typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> computeSteadyStateDistributionWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc) {
@@ -39,7 +39,7 @@ namespace storm {
         }
         
 
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), useBytecodeExpressions(false), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -171,6 +171,10 @@ namespace storm {
             return addOverlappingGuardsLabel;
         }
 
+        bool BuilderOptions::isUseBytecodeExpressionsSet() const {
+            return useBytecodeExpressions;
+        }
+
         BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
             buildAllRewardModels = newValue;
             return *this;
@@ -272,6 +276,11 @@ namespace storm {
             return *this;
         }
 
+        BuilderOptions& BuilderOptions::setUseBytecodeExpressions(bool newValue) {
+            useBytecodeExpressions = newValue;
+            return *this;
+        }
+
         BuilderOptions& BuilderOptions::substituteExpressions(std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
             for (auto& e : expressionLabels) {
                 e.second = substitutionFunction(e.second);
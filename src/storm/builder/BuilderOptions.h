@@ -117,6 +117,7 @@ namespace storm {
             bool isAddOutOfBoundsStateSet() const;
             uint64_t getReservedBitsForUnboundedVariables() const;
             bool isAddOverlappingGuardLabelSet() const;
+            bool isUseBytecodeExpressionsSet() const;
             uint64_t getShowProgressDelay() const;
 
             /**
@@ -210,6 +211,14 @@ namespace storm {
              * Sets the number of bits that will be reserved for unbounded integer variables.
              */
             BuilderOptions& setReservedBitsForUnboundedVariables(uint64_t value);
+
+            /**
+             * Should the expressions over the state variables be compiled to bytecode that operates on the packed states?
+             * This is ignored (with a warning) for models whose values are not floating point numbers.
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setUseBytecodeExpressions(bool newValue = true);
             
             /**
              * Substitutes all expressions occurring in these options.
@@ -271,6 +280,9 @@ namespace storm {
             /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
             uint64_t reservedBitsForUnboundedVariables;
 
+            /// A flag indicating whether expressions are evaluated by compiling them to bytecode.
+            bool useBytecodeExpressions;
+
             /// A flag that stores whether the progress of exploration is to be printed.
             bool showProgress;
 
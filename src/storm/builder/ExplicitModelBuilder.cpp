@@ -1,7 +1,8 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include <map>
-
+#include <atomic>
+#include <limits>
 
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
@@ -21,6 +22,8 @@
 
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Automaton.h"
@@ -33,6 +36,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 
 
 namespace storm {
@@ -46,7 +50,7 @@ namespace storm {
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), numberOfThreads(storm::utility::parallel::getNumberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfBuildThreads())) {
             // Intentionally left empty.
         }
 
@@ -56,12 +60,17 @@ namespace storm {
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(GeneratorFactory const& generatorFactory, Options const& options) : ExplicitModelBuilder(generatorFactory(), options) {
+            this->generatorFactory = generatorFactory;
+        }
+
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(GeneratorFactory([program, generatorOptions] () { return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions); }), builderOptions) {
             // Intentionally left empty.
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& generatorOptions, Options const& builderOptions) : ExplicitModelBuilder(GeneratorFactory([model, generatorOptions] () { return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions); }), builderOptions) {
             // Intentionally left empty.
         }
 
@@ -121,6 +130,10 @@ namespace storm {
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+            if (isParallelExplorationEnabled()) {
+                buildMatricesParallel(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                return;
+            }
 
             // Initialize building state valuations (if necessary)
             if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
@@ -172,101 +185,7 @@ namespace storm {
                     generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
                 }
                 storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        // This state shall be Markovian (to not introduce Zeno behavior)
-                        if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                            stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                        }
-                        // Other state-based information does not need to be treated, in particular:
-                        // * StateValuations have already been set above
-                        // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
-                    }
-
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
-                    }
-
-                    // Now add all choices.
-                    bool firstChoiceOfState = true;
-                    for (auto const& choice : behavior) {
-
-                        // add the generated choice information
-                        if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                            for (auto const& label : choice.getLabels()) {
-                                stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                            }
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                            stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                            STORM_LOG_ASSERT(firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup), "There is a state where different players have an enabled choice."); // Should have been detected in generator, already
-                            if (firstChoiceOfState) {
-                                stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                            }
-                        }
-                        if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() &&  choice.isMarkovian()) {
-                            stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                        }
-
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
-
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
-                        firstChoiceOfState = false;
-                    }
-
-                    ++currentRowGroup;
-                }
+                addStateBehavior(currentState, currentIndex, behavior, nullptr, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
 
                 ++numberOfExploredStates;
                 if (generator->getOptions().isShowProgressSet()) {
@@ -302,6 +221,7 @@ namespace storm {
                 // (b) the initial states
                 // (c) the hash map storing the mapping states -> ids
                 // (d) fix remapping for state-generation labels
+                // (e) the indices of deadlock states
 
                 // Fix (a).
                 transitionMatrixBuilder.replaceColumns(remapping, 0);
@@ -316,6 +236,302 @@ namespace storm {
                 this->stateStorage.stateToId.remap([&remapping] (StateType const& state) { return remapping[state]; } );
 
                 this->generator->remapStateIds([&remapping] (StateType const& state) { return remapping[state]; });
+
+                // Fix (e).
+                for (auto& deadlockStateIndex : this->stateStorage.deadlockStateIndices) {
+                    deadlockStateIndex = remapping[deadlockStateIndex];
+                }
+            }
+        }
+
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isParallelExplorationEnabled() const {
+            if (options.numberOfThreads <= 1) {
+                return false;
+            }
+            if (!generatorFactory) {
+                STORM_LOG_WARN("Multi-threaded state space exploration requires a builder that can create additional next-state generators. Falling back to a single thread.");
+                return false;
+            }
+            // Exact and parametric arithmetic relies on caches that must not be accessed concurrently.
+            if (!std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN("Multi-threaded state space exploration is only supported for floating point models. Falling back to a single thread.");
+                return false;
+            }
+            // The parallel exploration adds the states level by level, which is only possible for breadth-first order.
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                STORM_LOG_WARN("Multi-threaded state space exploration requires breadth-first exploration order. Falling back to a single thread.");
+                return false;
+            }
+            if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+                STORM_LOG_WARN("Multi-threaded state space exploration does not support labeling states with overlapping guards. Falling back to a single thread.");
+                return false;
+            }
+            return true;
+        }
+
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesParallel(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+            uint64_t const numberOfThreads = options.numberOfThreads;
+            STORM_LOG_DEBUG("Exploring the state space with " << numberOfThreads << " threads.");
+
+            // Initialize building state valuations (if necessary)
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
+            }
+
+            // Every thread gets its own generator and thereby its own expression evaluator. The first thread uses the
+            // generator of this builder, which is also used for all steps that are performed between the levels and after
+            // the exploration. All generators share the expression manager of the program (or model). This is safe as
+            // expanding a state only reads the manager: the evaluators are set up (and all variables are declared) when
+            // the generators are created, which happens here before any thread is started.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> generators(numberOfThreads);
+            generators[0] = generator;
+            for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+                generators[threadIndex] = generatorFactory();
+            }
+
+            // During the exploration of a level, states are assigned preliminary indices in the order in which they are
+            // inserted into the state map, which depends on the scheduling of the threads. For every state of the level,
+            // we store its behavior and the (preliminary) indices of all states requested while expanding it, in the
+            // order of the requests.
+            struct ExploredState {
+                CompressedState state;
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+                std::vector<StateType> requestedStates;
+            };
+
+            // The states are collected in a map that supports concurrent insertions. The final mapping from states to
+            // indices is filled level by level.
+            storm::storage::ConcurrentBitVectorHashMap<StateType> concurrentStateToId(this->stateStorage.bitsPerState, 100000);
+
+            // The final index of every state, i.e., the index it gets by the sequential (breadth-first) exploration.
+            // This is the number of states that the sequential exploration discovers before it.
+            StateType const unassignedIndex = std::numeric_limits<StateType>::max();
+            std::vector<StateType> remapping;
+            StateType numberOfDiscoveredStates = 0;
+            auto discoverState = [&] (StateType const& index, std::vector<StateType>& level) {
+                if (remapping[index] == unassignedIndex) {
+                    remapping[index] = numberOfDiscoveredStates++;
+                    level.push_back(index);
+                }
+            };
+
+            // Let the generator create all initial states. They form the first level.
+            this->stateStorage.initialStateIndices = generator->getInitialStates([&concurrentStateToId] (CompressedState const& state) {
+                return concurrentStateToId.findOrAdd(state).first;
+            });
+            STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+            std::vector<StateType> currentLevel;
+            remapping.resize(concurrentStateToId.size(), unassignedIndex);
+            for (auto const& index : this->stateStorage.initialStateIndices) {
+                discoverState(index, currentLevel);
+            }
+
+            uint_fast64_t currentRow = 0;
+            uint_fast64_t currentRowGroup = 0;
+
+            auto timeOfStart = std::chrono::high_resolution_clock::now();
+            auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            uint64_t numberOfExploredStates = 0;
+            uint64_t numberOfExploredStatesSinceLastMessage = 0;
+
+            // Explore the model level by level. The states of a level (given in the order of their final indices) are
+            // distributed dynamically among the threads.
+            while (!currentLevel.empty()) {
+                std::vector<ExploredState> exploredStates(currentLevel.size());
+                std::atomic<uint64_t> nextLevelIndex(0);
+                std::atomic<bool> terminate(false);
+
+                storm::utility::parallel::runOnThreads(numberOfThreads, [&] (uint64_t threadIndex) {
+                    storm::generator::NextStateGenerator<ValueType, StateType>& threadGenerator = *generators[threadIndex];
+                    std::vector<StateType>* requestedStates = nullptr;
+                    std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) {
+                        StateType index = concurrentStateToId.findOrAdd(state).first;
+                        requestedStates->push_back(index);
+                        return index;
+                    };
+
+                    for (uint64_t levelIndex = nextLevelIndex++; levelIndex < currentLevel.size() && !terminate; levelIndex = nextLevelIndex++) {
+                        ExploredState& exploredState = exploredStates[levelIndex];
+                        exploredState.state = concurrentStateToId.getKey(currentLevel[levelIndex]);
+                        requestedStates = &exploredState.requestedStates;
+
+                        threadGenerator.load(exploredState.state);
+                        exploredState.behavior = threadGenerator.expand(stateToIdCallback);
+
+                        if (storm::utility::resources::isTerminate()) {
+                            terminate = true;
+                        }
+                    }
+                });
+
+                // No thread accesses the map between two levels, so the tables replaced while growing can be freed.
+                concurrentStateToId.releaseRetiredTables();
+
+                numberOfExploredStates += currentLevel.size();
+                numberOfExploredStatesSinceLastMessage += currentLevel.size();
+                if (storm::utility::resources::isTerminate()) {
+                    auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+                    std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort." << std::endl;
+                    STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+                }
+
+                // Replay the sequential exploration of this level to assign the final indices to the states of the next
+                // level. Afterwards, all successors of the level have their final index, so the level can be added to the
+                // builders (in the order of the sequential exploration) and its behaviors can be released.
+                std::vector<StateType> nextLevel;
+                remapping.resize(concurrentStateToId.size(), unassignedIndex);
+                for (auto const& exploredState : exploredStates) {
+                    for (auto const& requestedIndex : exploredState.requestedStates) {
+                        discoverState(requestedIndex, nextLevel);
+                    }
+                }
+                for (uint64_t levelIndex = 0; levelIndex < currentLevel.size(); ++levelIndex) {
+                    ExploredState& exploredState = exploredStates[levelIndex];
+                    StateType currentIndex = remapping[currentLevel[levelIndex]];
+                    STORM_LOG_ASSERT(currentIndex == currentRowGroup, "The states of a level are not added in the order of their indices.");
+                    if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                        generator->load(exploredState.state);
+                        generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                    }
+                    addStateBehavior(exploredState.state, currentIndex, exploredState.behavior, &remapping, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                    this->stateStorage.stateToId.findOrAdd(exploredState.state, currentIndex);
+
+                    // Release the memory of the explored state as early as possible.
+                    exploredState = ExploredState();
+                }
+                currentLevel = std::move(nextLevel);
+
+                if (generator->getOptions().isShowProgressSet()) {
+                    auto now = std::chrono::high_resolution_clock::now();
+                    auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                    if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                        auto statesPerSecond = numberOfExploredStatesSinceLastMessage / std::max<decltype(durationSinceLastMessage)>(durationSinceLastMessage, 1);
+                        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                        std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond << " states per second)." << std::endl;
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                        numberOfExploredStatesSinceLastMessage = 0;
+                    }
+                }
+            }
+            generators.clear();
+            STORM_LOG_ASSERT(numberOfDiscoveredStates == concurrentStateToId.size(), "The exploration did not reach all states.");
+
+            // Finally, apply the renumbering to the initial states.
+            for (auto& initialStateIndex : this->stateStorage.initialStateIndices) {
+                initialStateIndex = remapping[initialStateIndex];
+            }
+        }
+
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(CompressedState const& currentState, StateType currentIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* stateIndexRemapping, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+                    // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                    if (behavior.wasExpanded()) {
+                        this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                    }
+
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
+
+                    transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
+
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    
+                    // This state shall be Markovian (to not introduce Zeno behavior)
+                    if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                        stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                    }
+                    // Other state-based information does not need to be treated, in particular:
+                    // * StateValuations have already been set by the caller
+                    // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+                    ++currentRow;
+                    ++currentRowGroup;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+                }
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+
+                // Now add all choices.
+                bool firstChoiceOfState = true;
+                for (auto const& choice : behavior) {
+
+                    // add the generated choice information
+                    if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                        for (auto const& label : choice.getLabels()) {
+                            stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                        }
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                        stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                        STORM_LOG_ASSERT(firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup), "There is a state where different players have an enabled choice."); // Should have been detected in generator, already
+                        if (firstChoiceOfState) {
+                            stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                        }
+                    }
+                    if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() &&  choice.isMarkovian()) {
+                        stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                    }
+
+                    // Add the probabilistic behavior to the matrix.
+                    if (stateIndexRemapping) {
+                        // The matrix builder requires the entries of a row to be sorted by column.
+                        std::vector<std::pair<StateType, ValueType>> remappedEntries;
+                        remappedEntries.reserve(choice.size());
+                        for (auto const& stateProbabilityPair : choice) {
+                            remappedEntries.emplace_back((*stateIndexRemapping)[stateProbabilityPair.first], stateProbabilityPair.second);
+                        }
+                        std::sort(remappedEntries.begin(), remappedEntries.end(), [] (std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                        for (auto const& stateProbabilityPair : remappedEntries) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    } else {
+                        for (auto const& stateProbabilityPair : choice) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    }
+
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                    firstChoiceOfState = false;
+                }
+
+                ++currentRowGroup;
             }
         }
 
@@ -6,6 +6,7 @@
 #include <vector>
 #include <deque>
 #include <cstdint>
+#include <functional>
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/variant.hpp>
@@ -60,7 +61,8 @@ namespace storm {
         template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>, typename StateType = uint32_t>
         class ExplicitModelBuilder {
         public:
-            
+            typedef std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> GeneratorFactory;
+
             struct Options {
                 /*!
                  * Creates an object representing the default building options.
@@ -69,6 +71,10 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+
+                // The number of threads that are used to explore the model. Values larger than one require that the
+                // builder can create additional next-state generators.
+                uint64_t numberOfThreads;
             };
             
             /*!
@@ -78,6 +84,15 @@ namespace storm {
              */
             ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options = Options());
 
+            /*!
+             * Creates an explicit model builder that uses generators obtained from the provided factory. Each call to
+             * the factory has to yield a fresh generator that behaves exactly like the previously created ones. This
+             * enables the builder to explore the state space with multiple threads.
+             *
+             * @param generatorFactory The factory used to create generators.
+             */
+            ExplicitModelBuilder(GeneratorFactory const& generatorFactory, Options const& options = Options());
+
             /*!
              * Creates an explicit model builder for the given PRISM program.
              *
@@ -128,6 +143,35 @@ namespace storm {
              */
             void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+            /*!
+             * Retrieves whether the state space can be explored with multiple threads.
+             */
+            bool isParallelExplorationEnabled() const;
+
+            /*!
+             * Builds the transition matrix and the transition reward matrix using multiple threads. The states are
+             * explored level by level (breadth-first), where each thread uses its own next-state generator. After each
+             * level, its states are numbered and added to the builders as by the sequential exploration, so the result
+             * coincides with the one obtained by the sequential exploration.
+             *
+             * @param transitionMatrixBuilder The builder of the transition matrix.
+             * @param rewardModelBuilders The builders for the selected reward models.
+             * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
+             */
+            void buildMatricesParallel(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+            /*!
+             * Adds the given behavior of the state with the given index to the matrix, reward and information builders.
+             *
+             * @param currentState The state whose behavior is added.
+             * @param currentIndex The index of the state.
+             * @param behavior The behavior of the state.
+             * @param stateIndexRemapping If given, the target states of all choices are renamed according to this mapping.
+             * @param currentRow The current row. Is increased according to the added rows.
+             * @param currentRowGroup The current row group. Is increased according to the added row groups.
+             */
+            void addStateBehavior(CompressedState const& currentState, StateType currentIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* stateIndexRemapping, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
              *
@@ -145,6 +189,9 @@ namespace storm {
             /// The generator to use for the building process.
             std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+            /// If set, this factory is used to create additional generators for a multi-threaded exploration.
+            GeneratorFactory generatorFactory;
+
             /// The options to be used for the building process.
             Options options;
 
@@ -18,6 +18,7 @@
 
 
 #include "storm/builder/RewardModelInformation.h"
+#include "storm/builder/jit/SharedLibraryCache.h"
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -137,6 +138,10 @@ namespace storm {
                 gmpIncludeDirectory = "";
 #endif
                 sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                if (settings.isCacheDirectorySet()) {
+                    cacheDirectory = settings.getCacheDirectory();
+                }
+                maximalCacheSize = settings.getMaximalCacheSize();
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -524,15 +529,8 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
-                
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                // (2)-(4) Compile the source code to a shared library (or retrieve it from the cache).
+                boost::filesystem::path dynamicLibraryPath = createSharedLibrary(source);
                 
                 // (5) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
@@ -2531,13 +2529,7 @@ namespace storm {
                 auto dynamicLibraryPath = sourceFile;
                 dynamicLibraryPath += DYLIB_EXTENSION;
                 std::string dynamicLibraryFilename = boost::filesystem::absolute(dynamicLibraryPath).string();
-                std::string includes = "";
-                for (std::string const& dir : {stormIncludeDirectory, sparseppIncludeDirectory, boostIncludeDirectory, carlIncludeDirectory, clnIncludeDirectory, gmpIncludeDirectory}) {
-                    if (dir != "") {
-                        includes += " -I" + dir;
-                    }
-                }
-                std::string command = compiler + " " + sourceFilename + " " + compilerFlags + includes + " -o " + dynamicLibraryFilename;
+                std::string command = compiler + " " + sourceFilename + " " + compilerFlags + getIncludeFlags() + " -o " + dynamicLibraryFilename;
                 boost::optional<std::string> error = execute(command);
                 
                 if (error) {
@@ -2548,6 +2540,61 @@ namespace storm {
                 return dynamicLibraryPath;
             }
             
+            template <typename ValueType, typename RewardModelType>
+            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::createSharedLibrary(std::string const& source) {
+                boost::optional<SharedLibraryCache> libraryCache;
+                std::string description;
+                if (cacheDirectory) {
+                    // The library depends on the source, the compiler invocation and the storm headers it was compiled against.
+                    description = source + "\n// " + compiler + " " + compilerFlags + getIncludeFlags() + "\n// storm " STORM_VERSION_STRING " " STORM_GIT_REVISION "\n";
+                    try {
+                        libraryCache.emplace(cacheDirectory.get(), maximalCacheSize, DYLIB_EXTENSION);
+                        boost::optional<boost::filesystem::path> cachedLibrary = libraryCache->find(description);
+                        if (cachedLibrary) {
+                            STORM_LOG_INFO("Using cached shared library " << cachedLibrary.get() << ".");
+                            // The library is copied, because the caller deletes it after use.
+                            boost::filesystem::path dynamicLibraryPath = boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%" + DYLIB_EXTENSION);
+                            boost::filesystem::copy_file(cachedLibrary.get(), dynamicLibraryPath);
+                            return dynamicLibraryPath;
+                        }
+                    } catch (boost::filesystem::filesystem_error const& e) {
+                        STORM_LOG_WARN("Unable to access the cache of shared libraries in '" << cacheDirectory.get() << "' (error: " << e.what() << ").");
+                        libraryCache = boost::none;
+                    }
+                }
+                
+                // Write the source code to a temporary file.
+                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                
+                // Compile the source code to a shared library.
+                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                STORM_LOG_TRACE("Successfully compiled shared library.");
+                
+                // Remove the source code of the shared library we just compiled.
+                boost::filesystem::remove(temporarySourceFile);
+                
+                if (libraryCache) {
+                    try {
+                        boost::filesystem::path cachedLibrary = libraryCache->insert(description, dynamicLibraryPath);
+                        STORM_LOG_INFO("Stored shared library in cache as " << cachedLibrary << ".");
+                    } catch (boost::filesystem::filesystem_error const& e) {
+                        STORM_LOG_WARN("Unable to store the shared library in the cache (error: " << e.what() << ").");
+                    }
+                }
+                return dynamicLibraryPath;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getIncludeFlags() const {
+                std::string includes = "";
+                for (std::string const& dir : {stormIncludeDirectory, sparseppIncludeDirectory, boostIncludeDirectory, carlIncludeDirectory, clnIncludeDirectory, gmpIncludeDirectory}) {
+                    if (dir != "") {
+                        includes += " -I" + dir;
+                    }
+                }
+                return includes;
+            }
+            
             template<typename RationalFunctionType, typename TP = typename RationalFunctionType::PolyType, carl::EnableIf<carl::needs_cache<TP>> = carl::dummy>
             RationalFunctionType convertVariableToPolynomial(storm::RationalFunctionVariable const& variable, std::shared_ptr<storm::RawPolynomialCache> cache) {
                 return RationalFunctionType(typename RationalFunctionType::PolyType(typename RationalFunctionType::PolyType::PolyType(variable), cache));
@@ -5,6 +5,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/dll/import.hpp>
 #include <boost/function.hpp>
+#include <boost/optional.hpp>
 
 #include "cpptempl.h"
 
@@ -153,6 +154,18 @@ namespace storm {
                  */
                 boost::filesystem::path compileToSharedLibrary(boost::filesystem::path const& sourceFile);
 
+                /*!
+                 * Retrieves a shared library obtained from the given source code. If a cache directory is set, the
+                 * library is taken from the cache (if present) and inserted into it otherwise. The returned file is
+                 * owned by the caller, i.e., it may be deleted after use.
+                 */
+                boost::filesystem::path createSharedLibrary(std::string const& source);
+
+                /*!
+                 * Retrieves the include flags that are passed to the compiler.
+                 */
+                std::string getIncludeFlags() const;
+
                 /*!
                  * Loads the given shared library and creates the builder from it.
                  */
@@ -212,6 +225,12 @@ namespace storm {
                 
                 /// The include directory for gmp
                 std::string gmpIncludeDirectory;
+
+                /// If set, compiled shared libraries are cached in this directory.
+                boost::optional<std::string> cacheDirectory;
+
+                /// The maximal size (in bytes) of the cache of shared libraries.
+                uint64_t maximalCacheSize;
                 
                 /// A cache that is used by carl.
                 std::shared_ptr<storm::RawPolynomialCache> cache;
@@ -0,0 +1,144 @@
+#include "storm/builder/jit/SharedLibraryCache.h"
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace builder {
+        namespace jit {
+
+            static const std::string DESCRIPTION_EXTENSION = ".key";
+
+            SharedLibraryCache::SharedLibraryCache(boost::filesystem::path const& directory, uint64_t maximalSize, std::string const& libraryExtension) : directory(directory), maximalSize(maximalSize), libraryExtension(libraryExtension) {
+                boost::filesystem::create_directories(directory);
+            }
+
+            std::string SharedLibraryCache::computeKey(std::string const& description) {
+                // 64-bit FNV-1a hash.
+                uint64_t hash = 14695981039346656037ull;
+                for (char character : description) {
+                    hash ^= static_cast<uint64_t>(static_cast<unsigned char>(character));
+                    hash *= 1099511628211ull;
+                }
+                std::stringstream stream;
+                stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+                return stream.str();
+            }
+
+            boost::optional<boost::filesystem::path> SharedLibraryCache::find(std::string const& description) const {
+                std::string key = computeKey(description);
+                boost::filesystem::path libraryPath = getLibraryPath(key);
+                boost::filesystem::path descriptionPath = getDescriptionPath(key);
+                if (!boost::filesystem::exists(libraryPath) || !boost::filesystem::exists(descriptionPath)) {
+                    return boost::none;
+                }
+
+                std::ifstream descriptionFile(descriptionPath.native(), std::ios::binary);
+                std::stringstream storedDescription;
+                storedDescription << descriptionFile.rdbuf();
+                if (!descriptionFile || storedDescription.str() != description) {
+                    STORM_LOG_DEBUG("Cached library " << libraryPath << " has the same key but a different description.");
+                    return boost::none;
+                }
+
+                // Mark the library as recently used.
+                boost::filesystem::last_write_time(libraryPath, std::time(nullptr));
+                return libraryPath;
+            }
+
+            boost::filesystem::path SharedLibraryCache::insert(std::string const& description, boost::filesystem::path const& library) const {
+                std::string key = computeKey(description);
+                boost::filesystem::path libraryPath = getLibraryPath(key);
+                boost::filesystem::path descriptionPath = getDescriptionPath(key);
+
+                // The library is renamed before the description is, so a matching description is never visible before its library.
+                boost::filesystem::path temporaryLibraryPath = directory / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+                boost::filesystem::copy_file(library, temporaryLibraryPath);
+                boost::filesystem::rename(temporaryLibraryPath, libraryPath);
+
+                boost::filesystem::path temporaryDescriptionPath = directory / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+                {
+                    std::ofstream descriptionFile(temporaryDescriptionPath.native(), std::ios::binary);
+                    descriptionFile << description;
+                }
+                boost::filesystem::rename(temporaryDescriptionPath, descriptionPath);
+
+                evict(libraryPath);
+                return libraryPath;
+            }
+
+            uint64_t SharedLibraryCache::getSize() const {
+                uint64_t size = 0;
+                for (boost::filesystem::directory_iterator entryIt(directory), entryIte; entryIt != entryIte; ++entryIt) {
+                    if (boost::filesystem::is_regular_file(entryIt->path())) {
+                        size += boost::filesystem::file_size(entryIt->path());
+                    }
+                }
+                return size;
+            }
+
+            boost::filesystem::path SharedLibraryCache::getLibraryPath(std::string const& key) const {
+                return directory / (key + libraryExtension);
+            }
+
+            boost::filesystem::path SharedLibraryCache::getDescriptionPath(std::string const& key) const {
+                return directory / (key + DESCRIPTION_EXTENSION);
+            }
+
+            void SharedLibraryCache::evict(boost::filesystem::path const& libraryToKeep) const {
+                struct Entry {
+                    std::time_t lastUse;
+                    uint64_t size;
+                    boost::filesystem::path libraryPath;
+                    boost::filesystem::path descriptionPath;
+                };
+
+                std::vector<Entry> entries;
+                uint64_t totalSize = 0;
+                for (boost::filesystem::directory_iterator entryIt(directory), entryIte; entryIt != entryIte; ++entryIt) {
+                    boost::filesystem::path const& path = entryIt->path();
+                    if (path.extension() != libraryExtension || !boost::filesystem::is_regular_file(path)) {
+                        continue;
+                    }
+                    boost::filesystem::path descriptionPath = path;
+                    descriptionPath.replace_extension(DESCRIPTION_EXTENSION);
+                    // Other processes may remove entries concurrently.
+                    boost::system::error_code errorCode;
+                    uint64_t size = boost::filesystem::file_size(path, errorCode);
+                    std::time_t lastUse = boost::filesystem::last_write_time(path, errorCode);
+                    if (errorCode) {
+                        continue;
+                    }
+                    uint64_t descriptionSize = boost::filesystem::file_size(descriptionPath, errorCode);
+                    if (!errorCode) {
+                        size += descriptionSize;
+                    }
+                    entries.push_back({lastUse, size, path, descriptionPath});
+                    totalSize += size;
+                }
+
+                std::sort(entries.begin(), entries.end(), [] (Entry const& first, Entry const& second) { return first.lastUse < second.lastUse; });
+                for (auto const& entry : entries) {
+                    if (totalSize <= maximalSize) {
+                        break;
+                    }
+                    if (entry.libraryPath.filename() == libraryToKeep.filename()) {
+                        continue;
+                    }
+                    STORM_LOG_DEBUG("Evicting " << entry.libraryPath << " from the cache of shared libraries.");
+                    boost::system::error_code errorCode;
+                    boost::filesystem::remove(entry.descriptionPath, errorCode);
+                    boost::filesystem::remove(entry.libraryPath, errorCode);
+                    totalSize -= entry.size;
+                }
+            }
+
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+
+namespace storm {
+    namespace builder {
+        namespace jit {
+
+            /*!
+             * A cache of shared libraries on the disk. A library is stored together with a description of how it was
+             * obtained (e.g., its source code and the compiler invocation) and is addressed by a hash of this
+             * description. As the descriptions are compared on lookup, a hash collision can not yield a wrong library.
+             * If the total size of the cached files exceeds the given bound, the least recently used libraries are removed.
+             *
+             * Entries are written to temporary files that are renamed afterwards, so the cache may be shared by
+             * several processes.
+             */
+            class SharedLibraryCache {
+            public:
+                /*!
+                 * Creates a cache that stores its entries in the given directory, which is created if necessary.
+                 *
+                 * @param directory The directory of the cache.
+                 * @param maximalSize The maximal total size (in bytes) of the cached files.
+                 * @param libraryExtension The file extension of shared libraries (including the dot).
+                 */
+                SharedLibraryCache(boost::filesystem::path const& directory, uint64_t maximalSize, std::string const& libraryExtension);
+
+                /*!
+                 * Computes the key under which the library with the given description is stored.
+                 */
+                static std::string computeKey(std::string const& description);
+
+                /*!
+                 * Retrieves the path of the cached library with the given description (if there is one). The library
+                 * is marked as recently used.
+                 */
+                boost::optional<boost::filesystem::path> find(std::string const& description) const;
+
+                /*!
+                 * Stores a copy of the given library under the given description and evicts the least recently used
+                 * libraries if the cache exceeds its maximal size.
+                 *
+                 * @return The path of the cached copy.
+                 */
+                boost::filesystem::path insert(std::string const& description, boost::filesystem::path const& library) const;
+
+                /*!
+                 * Retrieves the total size (in bytes) of the cached files.
+                 */
+                uint64_t getSize() const;
+
+            private:
+                boost::filesystem::path getLibraryPath(std::string const& key) const;
+                boost::filesystem::path getDescriptionPath(std::string const& key) const;
+
+                /*!
+                 * Removes the least recently used libraries (except for the given one) until the cache does not exceed
+                 * its maximal size.
+                 */
+                void evict(boost::filesystem::path const& libraryToKeep) const;
+
+                /// The directory in which the entries are stored.
+                boost::filesystem::path directory;
+
+                /// The maximal total size of the cached files.
+                uint64_t maximalSize;
+
+                /// The extension of the cached libraries.
+                std::string libraryExtension;
+            };
+
+        }
+    }
+}
@@ -49,6 +49,7 @@ namespace storm {
     template class SubEnvironment<InternalEnvironment>;
     
     template class SubEnvironment<MultiObjectiveModelCheckerEnvironment>;
+    template class SubEnvironment<StatisticalModelCheckerEnvironment>;
     template class SubEnvironment<ModelCheckerEnvironment>;
     
     template class SubEnvironment<SolverEnvironment>;
@@ -1,8 +1,10 @@
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -11,8 +13,12 @@
 
 namespace storm {
     
-    ModelCheckerEnvironment::ModelCheckerEnvironment() {
-        // Intentionally left empty
+    ModelCheckerEnvironment::ModelCheckerEnvironment() : analysisCacheSize(0), numberOfEpochThreads(1) {
+        if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()) {
+            auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+            analysisCacheSize = modelCheckerSettings.getAnalysisCacheSize() * 1024 * 1024;
+            numberOfEpochThreads = modelCheckerSettings.getNumberOfEpochThreads();
+        }
     }
     
     ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -26,6 +32,28 @@ namespace storm {
     MultiObjectiveModelCheckerEnvironment const& ModelCheckerEnvironment::multi() const {
         return multiObjectiveModelCheckerEnvironment.get();
     }
-}
     
-
+    StatisticalModelCheckerEnvironment& ModelCheckerEnvironment::statistical() {
+        return statisticalModelCheckerEnvironment.get();
+    }
+    
+    StatisticalModelCheckerEnvironment const& ModelCheckerEnvironment::statistical() const {
+        return statisticalModelCheckerEnvironment.get();
+    }
+    
+    uint64_t const& ModelCheckerEnvironment::getAnalysisCacheSize() const {
+        return analysisCacheSize;
+    }
+    
+    void ModelCheckerEnvironment::setAnalysisCacheSize(uint64_t value) {
+        analysisCacheSize = value;
+    }
+    
+    uint64_t const& ModelCheckerEnvironment::getNumberOfEpochThreads() const {
+        return numberOfEpochThreads;
+    }
+    
+    void ModelCheckerEnvironment::setNumberOfEpochThreads(uint64_t value) {
+        numberOfEpochThreads = value;
+    }
+}
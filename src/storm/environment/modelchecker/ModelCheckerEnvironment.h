@@ -10,6 +10,7 @@ namespace storm {
     
     // Forward declare subenvironments
     class MultiObjectiveModelCheckerEnvironment;
+    class StatisticalModelCheckerEnvironment;
     
     class ModelCheckerEnvironment {
     public:
@@ -19,10 +20,29 @@ namespace storm {
         
         MultiObjectiveModelCheckerEnvironment& multi();
         MultiObjectiveModelCheckerEnvironment const& multi() const;
-
+        
+        StatisticalModelCheckerEnvironment& statistical();
+        StatisticalModelCheckerEnvironment const& statistical() const;
+        
+        /*!
+         * The memory budget (in bytes) of the graph analysis cache that every sparse model keeps for its transition matrix.
+         * Zero means that the cache is not used.
+         */
+        uint64_t const& getAnalysisCacheSize() const;
+        void setAnalysisCacheSize(uint64_t value);
+        
+        /*!
+         * The number of threads that analyze independent epochs of reward-bounded properties concurrently.
+         * Zero refers to the number of hardware threads.
+         */
+        uint64_t const& getNumberOfEpochThreads() const;
+        void setNumberOfEpochThreads(uint64_t value);
     
     private:
         SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
+        SubEnvironment<StatisticalModelCheckerEnvironment> statisticalModelCheckerEnvironment;
+        uint64_t analysisCacheSize;
+        uint64_t numberOfEpochThreads;
     };
 }
 
@@ -0,0 +1,102 @@
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/StatisticalModelCheckerSettings.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/IllegalArgumentException.h"
+
+namespace storm {
+    
+    StatisticalModelCheckerEnvironment::StatisticalModelCheckerEnvironment() : numberOfThreads(1), errorProbability(0.01), precision(0.01), indifference(0.01), hypothesisTestMethod(storm::modelchecker::HypothesisTestMethod::Sprt), maximalPathLength(1000000), batchSize(1000) {
+        if (storm::settings::hasModule<storm::settings::modules::StatisticalModelCheckerSettings>()) {
+            auto const& statisticalSettings = storm::settings::getModule<storm::settings::modules::StatisticalModelCheckerSettings>();
+            numberOfThreads = statisticalSettings.getNumberOfThreads();
+            if (statisticalSettings.isSeedSet()) {
+                seed = statisticalSettings.getSeed();
+            }
+            errorProbability = statisticalSettings.getErrorProbability();
+            precision = statisticalSettings.getPrecision();
+            indifference = statisticalSettings.getIndifference();
+            hypothesisTestMethod = statisticalSettings.getHypothesisTestMethod();
+            maximalPathLength = statisticalSettings.getMaximalPathLength();
+            batchSize = statisticalSettings.getBatchSize();
+        }
+    }
+    
+    StatisticalModelCheckerEnvironment::~StatisticalModelCheckerEnvironment() {
+        // Intentionally left empty
+    }
+    
+    uint64_t const& StatisticalModelCheckerEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void StatisticalModelCheckerEnvironment::setNumberOfThreads(uint64_t value) {
+        numberOfThreads = value;
+    }
+    
+    boost::optional<uint64_t> const& StatisticalModelCheckerEnvironment::getSeed() const {
+        return seed;
+    }
+    
+    void StatisticalModelCheckerEnvironment::setSeed(uint64_t value) {
+        seed = value;
+    }
+    
+    void StatisticalModelCheckerEnvironment::unsetSeed() {
+        seed = boost::none;
+    }
+    
+    double const& StatisticalModelCheckerEnvironment::getErrorProbability() const {
+        return errorProbability;
+    }
+    
+    void StatisticalModelCheckerEnvironment::setErrorProbability(double value) {
+        STORM_LOG_THROW(value > 0.0 && value < 1.0, storm::exceptions::IllegalArgumentException, "The error probability has to be in (0,1).");
+        errorProbability = value;
+    }
+    
+    double const& StatisticalModelCheckerEnvironment::getPrecision() const {
+        return precision;
+    }
+    
+    void StatisticalModelCheckerEnvironment::setPrecision(double value) {
+        STORM_LOG_THROW(value > 0.0 && value < 1.0, storm::exceptions::IllegalArgumentException, "The precision has to be in (0,1).");
+        precision = value;
+    }
+    
+    double const& StatisticalModelCheckerEnvironment::getIndifference() const {
+        return indifference;
+    }
+    
+    void StatisticalModelCheckerEnvironment::setIndifference(double value) {
+        STORM_LOG_THROW(value > 0.0 && value < 0.5, storm::exceptions::IllegalArgumentException, "The indifference has to be in (0,0.5).");
+        indifference = value;
+    }
+    
+    storm::modelchecker::HypothesisTestMethod const& StatisticalModelCheckerEnvironment::getHypothesisTestMethod() const {
+        return hypothesisTestMethod;
+    }
+    
+    void StatisticalModelCheckerEnvironment::setHypothesisTestMethod(storm::modelchecker::HypothesisTestMethod value) {
+        hypothesisTestMethod = value;
+    }
+    
+    uint64_t const& StatisticalModelCheckerEnvironment::getMaximalPathLength() const {
+        return maximalPathLength;
+    }
+    
+    void StatisticalModelCheckerEnvironment::setMaximalPathLength(uint64_t value) {
+        maximalPathLength = value;
+    }
+    
+    uint64_t const& StatisticalModelCheckerEnvironment::getBatchSize() const {
+        return batchSize;
+    }
+    
+    void StatisticalModelCheckerEnvironment::setBatchSize(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The batch size has to be positive.");
+        batchSize = value;
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <boost/optional.hpp>
+
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/modelchecker/statistical/HypothesisTestMethod.h"
+
+namespace storm {
+    
+    class StatisticalModelCheckerEnvironment {
+    public:
+        
+        StatisticalModelCheckerEnvironment();
+        ~StatisticalModelCheckerEnvironment();
+        
+        /*!
+         * The number of threads that sample paths. Zero refers to the number of hardware threads.
+         */
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
+        
+        /*!
+         * The seed of the random number generators. If no seed is set, a random one is used.
+         */
+        boost::optional<uint64_t> const& getSeed() const;
+        void setSeed(uint64_t value);
+        void unsetSeed();
+        
+        /*!
+         * The admissible probability of an incorrect result.
+         */
+        double const& getErrorProbability() const;
+        void setErrorProbability(double value);
+        
+        /*!
+         * The absolute precision of estimated probabilities.
+         */
+        double const& getPrecision() const;
+        void setPrecision(double value);
+        
+        /*!
+         * The half-width of the region around the bound of a probability operator in which both outcomes are considered correct.
+         */
+        double const& getIndifference() const;
+        void setIndifference(double value);
+        
+        storm::modelchecker::HypothesisTestMethod const& getHypothesisTestMethod() const;
+        void setHypothesisTestMethod(storm::modelchecker::HypothesisTestMethod value);
+        
+        /*!
+         * The maximal number of steps of a sampled path. Longer paths are considered to not satisfy the property.
+         */
+        uint64_t const& getMaximalPathLength() const;
+        void setMaximalPathLength(uint64_t value);
+        
+        /*!
+         * The number of paths that are sampled with one random number stream.
+         */
+        uint64_t const& getBatchSize() const;
+        void setBatchSize(uint64_t value);
+        
+    private:
+        uint64_t numberOfThreads;
+        boost::optional<uint64_t> seed;
+        double errorProbability;
+        double precision;
+        double indifference;
+        storm::modelchecker::HypothesisTestMethod hypothesisTestMethod;
+        uint64_t maximalPathLength;
+        uint64_t batchSize;
+    };
+}
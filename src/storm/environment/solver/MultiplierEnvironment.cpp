@@ -11,6 +11,8 @@ namespace storm {
         auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
         type = multiplierSettings.getMultiplierType();
         typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+        numberOfThreads = multiplierSettings.getNumberOfThreads();
+        pinThreads = multiplierSettings.isPinThreadsSet();
     }
     
     MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +32,20 @@ namespace storm {
         typeSetFromDefault = isSetFromDefault;
     }
     
+    uint64_t const& MultiplierEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void MultiplierEnvironment::setNumberOfThreads(uint64_t value) {
+        numberOfThreads = value;
+    }
+    
+    bool const& MultiplierEnvironment::isPinThreadsSet() const {
+        return pinThreads;
+    }
+    
+    void MultiplierEnvironment::setPinThreads(bool value) {
+        pinThreads = value;
+    }
+    
 }
@@ -14,10 +14,16 @@ namespace storm {
         storm::solver::MultiplierType const& getType() const;
         bool const& isTypeSetFromDefault() const;
         void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
+        bool const& isPinThreadsSet() const;
+        void setPinThreads(bool value);
         
     private:
         storm::solver::MultiplierType type;
         bool typeSetFromDefault;
+        uint64_t numberOfThreads;
+        bool pinThreads;
     };
 }
 
@@ -14,6 +14,7 @@ namespace storm {
         precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
         relative = tbSettings.isRelativePrecision();
         unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+        adaptiveUniformization = tbSettings.isAdaptiveUniformizationSet();
     }
     
     TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -56,5 +57,13 @@ namespace storm {
     void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value) {
         unifPlusKappa = value;
     }
+    
+    bool const& TimeBoundedSolverEnvironment::getAdaptiveUniformization() const {
+        return adaptiveUniformization;
+    }
+    
+    void TimeBoundedSolverEnvironment::setAdaptiveUniformization(bool value) {
+        adaptiveUniformization = value;
+    }
 
 }
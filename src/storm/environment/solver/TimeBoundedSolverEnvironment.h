@@ -23,6 +23,9 @@ namespace storm {
         storm::RationalNumber const& getUnifPlusKappa() const;
         void setUnifPlusKappa(storm::RationalNumber value);
 
+        bool const& getAdaptiveUniformization() const;
+        void setAdaptiveUniformization(bool value);
+
     private:
         storm::solver::MaBoundedReachabilityMethod maMethod;
         bool maMethodSetFromDefault;
@@ -31,6 +34,8 @@ namespace storm {
         bool relative;
         
         storm::RationalNumber unifPlusKappa;
+        
+        bool adaptiveUniformization;
     };
 }
 
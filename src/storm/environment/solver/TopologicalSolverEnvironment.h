@@ -20,12 +20,20 @@ namespace storm {
         bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
         void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
         
+        /*!
+         * The number of threads that solve SCCs of the same depth concurrently (zero refers to the number of hardware threads).
+         */
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
+        
     private:
         storm::solver::EquationSolverType underlyingEquationSolverType;
         bool underlyingEquationSolverTypeSetFromDefault;
         
         storm::solver::MinMaxMethod underlyingMinMaxMethod;
         bool underlyingMinMaxMethodSetFromDefault;
+        
+        uint64_t numberOfThreads;
     };
 }
 
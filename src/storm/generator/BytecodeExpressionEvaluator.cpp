@@ -0,0 +1,452 @@
+#include "storm/generator/BytecodeExpressionEvaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        /*!
+         * Emits the instructions for an expression. Each visit returns the register that holds the value of the
+         * visited subexpression or an empty value, if the subexpression can not be compiled.
+         */
+        class BytecodeExpressionEvaluator::ExpressionCompiler : public storm::expressions::ExpressionVisitor {
+        public:
+            ExpressionCompiler(BytecodeExpressionEvaluator const& evaluator) : evaluator(evaluator) {
+                // Intentionally left empty.
+            }
+
+            /*!
+             * Compiles the given expression. If this is not possible, all emitted instructions are discarded.
+             * @return True iff the expression could be compiled.
+             */
+            bool compile(storm::expressions::BaseExpression const& expression, uint64_t& resultRegister) {
+                uint64_t numberOfInstructions = evaluator.instructions.size();
+                auto valueNumbersBefore = valueNumbers;
+                boost::any result = expression.accept(*this, boost::none);
+                if (result.empty()) {
+                    evaluator.instructions.resize(numberOfInstructions);
+                    valueNumbers = std::move(valueNumbersBefore);
+                    return false;
+                }
+                resultRegister = boost::any_cast<uint64_t>(result);
+                return true;
+            }
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+                boost::any condition = expression.getCondition()->accept(*this, data);
+                boost::any thenValue = expression.getThenExpression()->accept(*this, data);
+                boost::any elseValue = expression.getElseExpression()->accept(*this, data);
+                if (condition.empty() || thenValue.empty() || elseValue.empty()) {
+                    return boost::any();
+                }
+                uint64_t conditionRegister = boost::any_cast<uint64_t>(condition);
+                if (evaluator.constantRegisters[conditionRegister]) {
+                    return evaluator.registers[conditionRegister] != 0.0 ? thenValue : elseValue;
+                }
+                // Both branches are evaluated, which avoids jumps in the bytecode.
+                return emit(OpCode::IfThenElse, conditionRegister, boost::any_cast<uint64_t>(thenValue), boost::any_cast<uint64_t>(elseValue));
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                        return emitBinary(OpCode::And, expression, data, false);
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                        return emitBinary(OpCode::Or, expression, data, false);
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor:
+                        return emitBinary(OpCode::Xor, expression, data, false);
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies:
+                        return emitBinary(OpCode::Implies, expression, data, false);
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff:
+                        return emitBinary(OpCode::Equal, expression, data, false);
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus:
+                        return emitBinary(OpCode::Add, expression, data, false);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus:
+                        return emitBinary(OpCode::Subtract, expression, data, false);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times:
+                        return emitBinary(OpCode::Multiply, expression, data, false);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide:
+                        return emitBinary(OpCode::Divide, expression, data, false);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min:
+                        return emitBinary(OpCode::Minimum, expression, data, false);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max:
+                        return emitBinary(OpCode::Maximum, expression, data, false);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power:
+                        return emitBinary(OpCode::Power, expression, data, false);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Modulo:
+                        return emitBinary(OpCode::Modulo, expression, data, false);
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+                switch (expression.getRelationType()) {
+                    case storm::expressions::BinaryRelationExpression::RelationType::Equal:
+                        return emitBinary(OpCode::Equal, expression, data, false);
+                    case storm::expressions::BinaryRelationExpression::RelationType::NotEqual:
+                        return emitBinary(OpCode::NotEqual, expression, data, false);
+                    case storm::expressions::BinaryRelationExpression::RelationType::Less:
+                        return emitBinary(OpCode::Less, expression, data, false);
+                    case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual:
+                        return emitBinary(OpCode::LessOrEqual, expression, data, false);
+                    case storm::expressions::BinaryRelationExpression::RelationType::Greater:
+                        return emitBinary(OpCode::Less, expression, data, true);
+                    case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual:
+                        return emitBinary(OpCode::LessOrEqual, expression, data, true);
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+                auto variableIt = evaluator.variableToPackedVariable.find(expression.getVariable());
+                if (variableIt == evaluator.variableToPackedVariable.end()) {
+                    return boost::any();
+                }
+                PackedVariable const& variable = evaluator.packedVariables[variableIt->second];
+                if (variable.isBoolean) {
+                    return emitLoad(OpCode::LoadBoolean, variable.bitOffset, 0, 0);
+                } else if (variable.bitWidth == 0) {
+                    return getConstantRegister(static_cast<double>(variable.lowerBound));
+                }
+                return emitLoad(OpCode::LoadInteger, variable.bitOffset, variable.bitWidth, variable.lowerBound);
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                boost::any operand = expression.getOperand()->accept(*this, data);
+                if (operand.empty()) {
+                    return boost::any();
+                }
+                return emit(OpCode::Not, boost::any_cast<uint64_t>(operand), 0, 0);
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                boost::any operand = expression.getOperand()->accept(*this, data);
+                if (operand.empty()) {
+                    return boost::any();
+                }
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus:
+                        return emit(OpCode::Negate, boost::any_cast<uint64_t>(operand), 0, 0);
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor:
+                        return emit(OpCode::Floor, boost::any_cast<uint64_t>(operand), 0, 0);
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil:
+                        return emit(OpCode::Ceil, boost::any_cast<uint64_t>(operand), 0, 0);
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+                return getConstantRegister(expression.getValue() ? 1.0 : 0.0);
+            }
+
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+                return getConstantRegister(static_cast<double>(expression.getValue()));
+            }
+
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+                return getConstantRegister(expression.getValueAsDouble());
+            }
+
+        private:
+            typedef std::tuple<OpCode, uint64_t, uint64_t, uint64_t, int64_t> ValueNumberKey;
+
+            boost::any emitBinary(OpCode opCode, storm::expressions::BinaryExpression const& expression, boost::any const& data, bool swapOperands) {
+                boost::any first = expression.getFirstOperand()->accept(*this, data);
+                boost::any second = expression.getSecondOperand()->accept(*this, data);
+                if (first.empty() || second.empty()) {
+                    return boost::any();
+                }
+                if (swapOperands) {
+                    std::swap(first, second);
+                }
+                return emit(opCode, boost::any_cast<uint64_t>(first), boost::any_cast<uint64_t>(second), 0);
+            }
+
+            uint64_t emit(OpCode opCode, uint64_t first, uint64_t second, uint64_t third) {
+                // Unused operands refer to register 0, which holds a constant.
+                if (evaluator.constantRegisters[first] && evaluator.constantRegisters[second] && evaluator.constantRegisters[third]) {
+                    Instruction instruction = {opCode, evaluator.registers.size(), first, second, third, 0};
+                    evaluator.registers.push_back(0.0);
+                    execute(instruction, nullptr, evaluator.registers.data());
+                    double value = evaluator.registers.back();
+                    evaluator.registers.pop_back();
+                    return getConstantRegister(value);
+                }
+                return emitInstruction(opCode, first, second, third, 0);
+            }
+
+            uint64_t emitLoad(OpCode opCode, uint64_t bitOffset, uint64_t bitWidth, int64_t lowerBound) {
+                return emitInstruction(opCode, bitOffset, bitWidth, 0, lowerBound);
+            }
+
+            uint64_t emitInstruction(OpCode opCode, uint64_t first, uint64_t second, uint64_t third, int64_t lowerBound) {
+                // Within a block, instructions that compute the same value are only emitted once.
+                ValueNumberKey key(opCode, first, second, third, lowerBound);
+                auto valueNumberIt = valueNumbers.find(key);
+                if (valueNumberIt != valueNumbers.end()) {
+                    return valueNumberIt->second;
+                }
+                uint64_t target = newRegister(0.0, false);
+                evaluator.instructions.push_back({opCode, target, first, second, third, lowerBound});
+                valueNumbers.emplace(key, target);
+                return target;
+            }
+
+            uint64_t getConstantRegister(double value) {
+                // Constants are identified by their bit pattern such that, e.g., 0.0 and -0.0 are kept apart.
+                uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                auto constantIt = evaluator.bitsToConstantRegister.find(bits);
+                if (constantIt != evaluator.bitsToConstantRegister.end()) {
+                    return constantIt->second;
+                }
+                uint64_t result = newRegister(value, true);
+                evaluator.bitsToConstantRegister.emplace(bits, result);
+                return result;
+            }
+
+            uint64_t newRegister(double value, bool isConstant) {
+                evaluator.registers.push_back(value);
+                evaluator.constantRegisters.push_back(isConstant);
+                return evaluator.registers.size() - 1;
+            }
+
+            BytecodeExpressionEvaluator const& evaluator;
+            std::map<ValueNumberKey, uint64_t> valueNumbers;
+        };
+
+        BytecodeExpressionEvaluator::BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const& variableInformation) : storm::expressions::ExpressionEvaluator<double>(manager), registers(1, 0.0), constantRegisters(1, true), state(nullptr), stateCounter(0), stateUnpacked(false), valuesSetExplicitly(false) {
+            // Register 0 holds the constant zero.
+            bitsToConstantRegister.emplace(0, 0);
+
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                packedVariables.push_back({locationVariable.variable, false, locationVariable.bitOffset, locationVariable.bitWidth, 0});
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                packedVariables.push_back({booleanVariable.variable, true, booleanVariable.bitOffset, 1, 0});
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                packedVariables.push_back({integerVariable.variable, false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound});
+            }
+            for (uint64_t index = 0; index < packedVariables.size(); ++index) {
+                variableToPackedVariable.emplace(packedVariables[index].variable, index);
+            }
+        }
+
+        void BytecodeExpressionEvaluator::addExpressionBlock(std::vector<storm::expressions::Expression> const& expressions) {
+            compileBlock(expressions);
+        }
+
+        void BytecodeExpressionEvaluator::setState(CompressedState const& state) {
+            this->state = &state;
+            ++stateCounter;
+            stateUnpacked = false;
+            valuesSetExplicitly = false;
+        }
+
+        bool BytecodeExpressionEvaluator::asBool(storm::expressions::Expression const& expression) const {
+            double const* value = evaluate(expression);
+            if (value != nullptr) {
+                return *value == 1.0;
+            }
+            unpackCurrentState();
+            return BaseEvaluator::asBool(expression);
+        }
+
+        int_fast64_t BytecodeExpressionEvaluator::asInt(storm::expressions::Expression const& expression) const {
+            double const* value = evaluate(expression);
+            if (value != nullptr) {
+                return static_cast<int_fast64_t>(*value);
+            }
+            unpackCurrentState();
+            return BaseEvaluator::asInt(expression);
+        }
+
+        double BytecodeExpressionEvaluator::asRational(storm::expressions::Expression const& expression) const {
+            double const* value = evaluate(expression);
+            if (value != nullptr) {
+                return *value;
+            }
+            unpackCurrentState();
+            return BaseEvaluator::asRational(expression);
+        }
+
+        void BytecodeExpressionEvaluator::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
+            setValueExplicitly(variable);
+            BaseEvaluator::setBooleanValue(variable, value);
+        }
+
+        void BytecodeExpressionEvaluator::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
+            setValueExplicitly(variable);
+            BaseEvaluator::setIntegerValue(variable, value);
+        }
+
+        void BytecodeExpressionEvaluator::setRationalValue(storm::expressions::Variable const& variable, double value) {
+            setValueExplicitly(variable);
+            BaseEvaluator::setRationalValue(variable, value);
+        }
+
+        uint64_t BytecodeExpressionEvaluator::getNumberOfCompiledExpressions() const {
+            return std::count_if(compiledExpressions.begin(), compiledExpressions.end(), [] (auto const& entry) { return entry.second.isCompiled; });
+        }
+
+        void BytecodeExpressionEvaluator::compileBlock(std::vector<storm::expressions::Expression> const& expressions) const {
+            ExpressionCompiler compiler(*this);
+            Block block = {instructions.size(), 0, 0};
+            for (auto const& expression : expressions) {
+                auto const& baseExpression = expression.getBaseExpressionPointer();
+                if (!expression.isInitialized() || compiledExpressions.find(baseExpression.get()) != compiledExpressions.end()) {
+                    continue;
+                }
+                CompiledExpressionInformation information = {baseExpression, false, blocks.size(), 0};
+                information.isCompiled = compiler.compile(*baseExpression, information.resultRegister);
+                compiledExpressions.emplace(baseExpression.get(), std::move(information));
+            }
+            block.endInstruction = instructions.size();
+            blocks.push_back(block);
+        }
+
+        double const* BytecodeExpressionEvaluator::evaluate(storm::expressions::Expression const& expression) const {
+            if (state == nullptr || valuesSetExplicitly) {
+                return nullptr;
+            }
+            auto compiledIt = compiledExpressions.find(expression.getBaseExpressionPointer().get());
+            if (compiledIt == compiledExpressions.end()) {
+                compileBlock({expression});
+                compiledIt = compiledExpressions.find(expression.getBaseExpressionPointer().get());
+                if (compiledIt == compiledExpressions.end()) {
+                    return nullptr;
+                }
+            }
+            CompiledExpressionInformation const& information = compiledIt->second;
+            if (!information.isCompiled) {
+                return nullptr;
+            }
+
+            Block& block = blocks[information.block];
+            if (block.executedForState != stateCounter) {
+                double* registerFile = registers.data();
+                for (auto instructionIt = instructions.begin() + block.beginInstruction, instructionIte = instructions.begin() + block.endInstruction; instructionIt != instructionIte; ++instructionIt) {
+                    execute(*instructionIt, state, registerFile);
+                }
+                block.executedForState = stateCounter;
+            }
+            return &registers[information.resultRegister];
+        }
+
+        void BytecodeExpressionEvaluator::unpackCurrentState() const {
+            if (state == nullptr || stateUnpacked || valuesSetExplicitly) {
+                return;
+            }
+            // The values of the underlying evaluator are part of the mutable evaluation state, just like the registers.
+            BytecodeExpressionEvaluator& nonConstThis = const_cast<BytecodeExpressionEvaluator&>(*this);
+            for (auto const& variable : packedVariables) {
+                if (variable.isBoolean) {
+                    nonConstThis.BaseEvaluator::setBooleanValue(variable.variable, state->get(variable.bitOffset));
+                } else if (variable.bitWidth == 0) {
+                    nonConstThis.BaseEvaluator::setIntegerValue(variable.variable, variable.lowerBound);
+                } else {
+                    nonConstThis.BaseEvaluator::setIntegerValue(variable.variable, state->getAsInt(variable.bitOffset, variable.bitWidth) + variable.lowerBound);
+                }
+            }
+            stateUnpacked = true;
+        }
+
+        void BytecodeExpressionEvaluator::setValueExplicitly(storm::expressions::Variable const& variable) {
+            if (!valuesSetExplicitly && variableToPackedVariable.find(variable) != variableToPackedVariable.end()) {
+                // Make sure that the values of the other variables of the state are present.
+                unpackCurrentState();
+                valuesSetExplicitly = true;
+            }
+        }
+
+        void BytecodeExpressionEvaluator::execute(Instruction const& instruction, CompressedState const* state, double* registers) {
+            double* target = registers + instruction.target;
+            switch (instruction.opCode) {
+                case OpCode::LoadBoolean:
+                    *target = state->get(instruction.first) ? 1.0 : 0.0;
+                    break;
+                case OpCode::LoadInteger:
+                    *target = static_cast<double>(static_cast<int_fast64_t>(state->getAsInt(instruction.first, instruction.second)) + instruction.lowerBound);
+                    break;
+                case OpCode::Add:
+                    *target = registers[instruction.first] + registers[instruction.second];
+                    break;
+                case OpCode::Subtract:
+                    *target = registers[instruction.first] - registers[instruction.second];
+                    break;
+                case OpCode::Multiply:
+                    *target = registers[instruction.first] * registers[instruction.second];
+                    break;
+                case OpCode::Divide:
+                    *target = registers[instruction.first] / registers[instruction.second];
+                    break;
+                case OpCode::Power:
+                    *target = std::pow(registers[instruction.first], registers[instruction.second]);
+                    break;
+                case OpCode::Modulo:
+                    *target = std::fmod(registers[instruction.first], registers[instruction.second]);
+                    break;
+                case OpCode::Minimum:
+                    *target = std::min(registers[instruction.first], registers[instruction.second]);
+                    break;
+                case OpCode::Maximum:
+                    *target = std::max(registers[instruction.first], registers[instruction.second]);
+                    break;
+                case OpCode::Negate:
+                    *target = -registers[instruction.first];
+                    break;
+                case OpCode::Floor:
+                    *target = std::floor(registers[instruction.first]);
+                    break;
+                case OpCode::Ceil:
+                    *target = std::ceil(registers[instruction.first]);
+                    break;
+                case OpCode::Not:
+                    *target = registers[instruction.first] == 0.0 ? 1.0 : 0.0;
+                    break;
+                case OpCode::And:
+                    *target = (registers[instruction.first] != 0.0 && registers[instruction.second] != 0.0) ? 1.0 : 0.0;
+                    break;
+                case OpCode::Or:
+                    *target = (registers[instruction.first] != 0.0 || registers[instruction.second] != 0.0) ? 1.0 : 0.0;
+                    break;
+                case OpCode::Xor:
+                    *target = ((registers[instruction.first] != 0.0) != (registers[instruction.second] != 0.0)) ? 1.0 : 0.0;
+                    break;
+                case OpCode::Implies:
+                    *target = (registers[instruction.first] == 0.0 || registers[instruction.second] != 0.0) ? 1.0 : 0.0;
+                    break;
+                case OpCode::Equal:
+                    *target = registers[instruction.first] == registers[instruction.second] ? 1.0 : 0.0;
+                    break;
+                case OpCode::NotEqual:
+                    *target = registers[instruction.first] != registers[instruction.second] ? 1.0 : 0.0;
+                    break;
+                case OpCode::Less:
+                    *target = registers[instruction.first] < registers[instruction.second] ? 1.0 : 0.0;
+                    break;
+                case OpCode::LessOrEqual:
+                    *target = registers[instruction.first] <= registers[instruction.second] ? 1.0 : 0.0;
+                    break;
+                case OpCode::IfThenElse:
+                    *target = registers[instruction.first] != 0.0 ? registers[instruction.second] : registers[instruction.third];
+                    break;
+            }
+        }
+
+    }
+}
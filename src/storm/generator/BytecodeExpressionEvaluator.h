@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+
+namespace storm {
+    namespace expressions {
+        class BaseExpression;
+    }
+
+    namespace generator {
+
+        /*!
+         * An expression evaluator that evaluates expressions over the (non-transient) variables of a packed state
+         * without unpacking the state first. Expressions are compiled once into instructions of a small register
+         * machine whose load instructions read the values of the variables directly from the bits of the state.
+         * Constant subexpressions are folded and, within a block of expressions that are compiled jointly, every
+         * subexpression is evaluated only once per state. The results coincide with the ones of the exprtk-based
+         * evaluator, i.e., all values are represented as doubles. Hence, the evaluator is only available for models
+         * with floating point values.
+         *
+         * Expressions that refer to variables that are not part of the packed state (e.g., transient variables) are
+         * handled by the underlying evaluator. For these, the values of the state are unpacked on demand.
+         *
+         * @note The evaluator stores a pointer to the current state, i.e., the state has to be alive as long as
+         * expressions are evaluated w.r.t. it.
+         */
+        class BytecodeExpressionEvaluator : public storm::expressions::ExpressionEvaluator<double> {
+        public:
+            BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const& variableInformation);
+
+            /*!
+             * Compiles the given expressions jointly. Evaluating one of them evaluates all of them (once per state), so
+             * this is meant for expressions that are typically evaluated together, such as the guards of a module.
+             * Expressions that have been compiled before are not compiled again.
+             */
+            void addExpressionBlock(std::vector<storm::expressions::Expression> const& expressions);
+
+            /*!
+             * Sets the state w.r.t. which the expressions are evaluated. Values that were set for the variables of the
+             * state before are discarded.
+             */
+            void setState(CompressedState const& state);
+
+            bool asBool(storm::expressions::Expression const& expression) const override;
+            int_fast64_t asInt(storm::expressions::Expression const& expression) const override;
+            double asRational(storm::expressions::Expression const& expression) const override;
+
+            using storm::expressions::ExpressionEvaluator<double>::setRationalValue;
+            void setBooleanValue(storm::expressions::Variable const& variable, bool value) override;
+            void setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) override;
+            void setRationalValue(storm::expressions::Variable const& variable, double value) override;
+
+            /*!
+             * Retrieves the number of expressions that could be compiled so far.
+             */
+            uint64_t getNumberOfCompiledExpressions() const;
+
+        private:
+            typedef storm::expressions::ExpressionEvaluator<double> BaseEvaluator;
+
+            class ExpressionCompiler;
+
+            enum class OpCode : uint8_t {
+                LoadBoolean,   // target = state[first]
+                LoadInteger,   // target = state[first, first + second) + lowerBound
+                Add,           // target = first + second
+                Subtract,      // target = first - second
+                Multiply,      // target = first * second
+                Divide,        // target = first / second
+                Power,         // target = first ^ second
+                Modulo,        // target = fmod(first, second)
+                Minimum,       // target = min(first, second)
+                Maximum,       // target = max(first, second)
+                Negate,        // target = -first
+                Floor,         // target = floor(first)
+                Ceil,          // target = ceil(first)
+                Not,           // target = !first
+                And,           // target = first && second
+                Or,            // target = first || second
+                Xor,           // target = first != second (as booleans)
+                Implies,       // target = !first || second
+                Equal,         // target = first == second
+                NotEqual,      // target = first != second
+                Less,          // target = first < second
+                LessOrEqual,   // target = first <= second
+                IfThenElse     // target = first ? second : third
+            };
+
+            struct Instruction {
+                OpCode opCode;
+                uint64_t target;
+                // For loads, these are the bit offset and the bit width of the variable, respectively.
+                uint64_t first;
+                uint64_t second;
+                uint64_t third;
+                int64_t lowerBound;
+            };
+
+            /*!
+             * The instructions of a block are stored consecutively. The block is executed at most once per state.
+             */
+            struct Block {
+                uint64_t beginInstruction;
+                uint64_t endInstruction;
+                uint64_t executedForState;
+            };
+
+            struct CompiledExpressionInformation {
+                // Keeps the expression alive such that its address is not reused for another expression.
+                std::shared_ptr<storm::expressions::BaseExpression const> expression;
+                bool isCompiled;
+                uint64_t block;
+                uint64_t resultRegister;
+            };
+
+            struct PackedVariable {
+                storm::expressions::Variable variable;
+                bool isBoolean;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int64_t lowerBound;
+            };
+
+            /*!
+             * Compiles the given expressions into a new block.
+             */
+            void compileBlock(std::vector<storm::expressions::Expression> const& expressions) const;
+
+            /*!
+             * Retrieves the register holding the value of the given expression w.r.t. the current state or nullptr,
+             * if the expression can not be evaluated by executing bytecode.
+             */
+            double const* evaluate(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Sets the values of the variables of the current state in the underlying evaluator, unless this already
+             * happened or values were set explicitly.
+             */
+            void unpackCurrentState() const;
+
+            /*!
+             * Notifies the evaluator that the value of the given variable is set explicitly.
+             */
+            void setValueExplicitly(storm::expressions::Variable const& variable);
+
+            static void execute(Instruction const& instruction, CompressedState const* state, double* registers);
+
+            // The variables that are stored in the packed states.
+            std::vector<PackedVariable> packedVariables;
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToPackedVariable;
+
+            // The compiled code.
+            mutable std::unordered_map<storm::expressions::BaseExpression const*, CompiledExpressionInformation> compiledExpressions;
+            mutable std::vector<Block> blocks;
+            mutable std::vector<Instruction> instructions;
+            mutable std::vector<double> registers;
+            mutable std::vector<bool> constantRegisters;
+            mutable std::map<uint64_t, uint64_t> bitsToConstantRegister;
+
+            // The current state and a counter that identifies it.
+            CompressedState const* state;
+            uint64_t stateCounter;
+
+            // Flags indicating whether the values of the current state have been set in the underlying evaluator and
+            // whether values of the variables of the state have been set explicitly, respectively.
+            mutable bool stateUnpacked;
+            bool valuesSetExplicitly;
+        };
+
+    }
+}
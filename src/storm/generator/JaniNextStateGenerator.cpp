@@ -1,4 +1,5 @@
 #include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/BytecodeExpressionEvaluator.h"
 
 #include "storm/models/sparse/StateLabeling.h"
 
@@ -87,7 +88,17 @@ namespace storm {
             this->transientVariableInformation.registerArrayVariableReplacements(arrayEliminatorData);
             
             // Create a proper evaluator.
-            this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(this->model.getManager());
+            this->createEvaluator(this->model.getManager());
+            if (this->bytecodeEvaluator) {
+                // The guards of the edges of an automaton are evaluated for every state, so they are compiled jointly.
+                for (auto const& automaton : this->parallelAutomata) {
+                    std::vector<storm::expressions::Expression> guards;
+                    for (auto const& edge : automaton.get().getEdges()) {
+                        guards.push_back(edge.getGuard());
+                    }
+                    this->bytecodeEvaluator->addExpressionBlock(guards);
+                }
+            }
             this->transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
             
             
@@ -1,6 +1,7 @@
 #include <storm/exceptions/WrongFormatException.h>
 #include <storm/exceptions/NotImplementedException.h>
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/BytecodeExpressionEvaluator.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -18,7 +19,7 @@ namespace storm {
     namespace generator {
                     
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), bytecodeEvaluator(nullptr), state(nullptr) {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -28,7 +29,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), bytecodeEvaluator(nullptr), state(nullptr) {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -84,12 +85,54 @@ namespace storm {
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
             // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+            loadStateIntoEvaluator(state);
             
             // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
             this->state = &state;
         }
         
+        namespace detail {
+            /*!
+             * Creates the evaluator for the expressions of the given manager. As the bytecode evaluator computes with
+             * doubles, it is only used for floating point models.
+             *
+             * @return The created evaluator if it is a bytecode evaluator and null otherwise.
+             */
+            template<typename ValueType>
+            BytecodeExpressionEvaluator* createEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const&, bool useBytecodeExpressions, std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>>& evaluator) {
+                STORM_LOG_WARN_COND(!useBytecodeExpressions, "Bytecode expressions are only supported for floating point models. Falling back to the default evaluator.");
+                evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(manager);
+                return nullptr;
+            }
+
+            template<>
+            BytecodeExpressionEvaluator* createEvaluator<double>(storm::expressions::ExpressionManager const& manager, VariableInformation const& variableInformation, bool useBytecodeExpressions, std::unique_ptr<storm::expressions::ExpressionEvaluator<double>>& evaluator) {
+                if (useBytecodeExpressions) {
+                    auto bytecodeEvaluator = std::make_unique<BytecodeExpressionEvaluator>(manager, variableInformation);
+                    BytecodeExpressionEvaluator* result = bytecodeEvaluator.get();
+                    evaluator = std::move(bytecodeEvaluator);
+                    return result;
+                }
+                evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<double>>(manager);
+                return nullptr;
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::createEvaluator(storm::expressions::ExpressionManager const& manager) {
+            bytecodeEvaluator = detail::createEvaluator<ValueType>(manager, variableInformation, options.isUseBytecodeExpressionsSet(), evaluator);
+        }
+
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::loadStateIntoEvaluator(CompressedState const& state) {
+            if (bytecodeEvaluator) {
+                // The values are read from the state when they are needed.
+                bytecodeEvaluator->setState(state);
+            } else {
+                unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+            }
+        }
+
         template<typename ValueType, typename StateType>
         bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Expression const& expression) const {
             if (expression.isTrue()) {
@@ -168,7 +211,7 @@ namespace storm {
             
             auto const& states = stateStorage.stateToId;
             for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+                loadStateIntoEvaluator(stateIndexPair.first);
                 unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
                 
                 for (auto const& label : labelsAndExpressions) {
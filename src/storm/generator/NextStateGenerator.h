@@ -26,6 +26,8 @@ namespace storm {
     namespace generator {
         typedef storm::builder::BuilderOptions NextStateGeneratorOptions;
 
+        class BytecodeExpressionEvaluator;
+
         enum class ModelType {
             DTMC,
             CTMC,
@@ -107,6 +109,18 @@ namespace storm {
              * @post The values of all transient variables are set in the given evaluator (including the transient variables without an explicit assignment in the current locations).
              */
             virtual void unpackTransientVariableValuesIntoEvaluator(CompressedState const& state, storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const;
+
+            /*!
+             * Creates the evaluator for the expressions of the given manager. Depending on the options, expressions
+             * over the state variables are compiled to bytecode.
+             * @pre The variable information has been set.
+             */
+            void createEvaluator(storm::expressions::ExpressionManager const& manager);
+
+            /*!
+             * Sets the values of the (non-transient) variables of the given state in the evaluator.
+             */
+            void loadStateIntoEvaluator(CompressedState const& state);
             
             virtual storm::storage::BitVector evaluateObservationLabels(CompressedState const& state) const =0;
 
@@ -129,6 +143,10 @@ namespace storm {
             /// An evaluator used to evaluate expressions.
             std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> evaluator;
 
+            /// The evaluator if it compiles expressions to bytecode and null otherwise. This is only possible for
+            /// floating point models.
+            BytecodeExpressionEvaluator* bytecodeEvaluator;
+
             /// The currently loaded state.
             CompressedState const* state;
 
@@ -1,4 +1,5 @@
 #include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/BytecodeExpressionEvaluator.h"
 
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
@@ -36,7 +37,17 @@ namespace storm {
             this->variableInformation = VariableInformation(program, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
 
             // Create a proper evalator.
-            this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
+            this->createEvaluator(program.getManager());
+            if (this->bytecodeEvaluator) {
+                // The guards of a module are evaluated for every state, so they are compiled jointly.
+                for (auto const& module : this->program.getModules()) {
+                    std::vector<storm::expressions::Expression> guards;
+                    for (auto const& command : module.getCommands()) {
+                        guards.push_back(command.getGuardExpression());
+                    }
+                    this->bytecodeEvaluator->addExpressionBlock(guards);
+                }
+            }
 
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
@@ -0,0 +1,249 @@
+#include "storm/io/BinaryEncodingExporter.h"
+
+#include <functional>
+#include <set>
+#include <sstream>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace exporter {
+
+        const char BinaryEncodingHeader::Magic[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'I', 'N'};
+        const uint32_t BinaryEncodingHeader::Version = 1;
+        const uint32_t BinaryEncodingHeader::ByteOrderMark = 0x01020304;
+
+        namespace {
+            /*!
+             * Writes plain data to a stream and keeps track of the position to align the sections.
+             */
+            class BinaryWriter {
+            public:
+                BinaryWriter(std::ostream& os) : os(os), position(0) {
+                    // Intentionally left empty.
+                }
+
+                template<typename T>
+                void write(T const& value) {
+                    writeArray(&value, 1);
+                }
+
+                template<typename T>
+                void writeArray(T const* data, uint64_t count) {
+                    os.write(reinterpret_cast<char const*>(data), count * sizeof(T));
+                    position += count * sizeof(T);
+                }
+
+                void writeString(std::string const& value) {
+                    write<uint64_t>(value.size());
+                    writeArray(value.data(), value.size());
+                    align();
+                }
+
+                void writeBitVector(storm::storage::BitVector const& bitVector) {
+                    write<uint64_t>(bitVector.size());
+                    for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+                        write<uint64_t>(bitVector.getAsInt(index, std::min<uint64_t>(64, bitVector.size() - index)));
+                    }
+                }
+
+                void align() {
+                    static const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+                    if (position % 8 != 0) {
+                        writeArray(padding, 8 - position % 8);
+                    }
+                }
+
+                void checkState() const {
+                    STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Unable to write the model in the binary format.");
+                }
+
+            private:
+                std::ostream& os;
+                uint64_t position;
+            };
+
+            template<typename ValueType>
+            void writeMatrix(BinaryWriter& writer, storm::storage::SparseMatrix<ValueType> const& matrix) {
+                std::vector<uint64_t> rowIndications;
+                rowIndications.reserve(matrix.getRowCount() + 1);
+                rowIndications.push_back(0);
+                for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                    rowIndications.push_back(rowIndications.back() + matrix.getRow(row).getNumberOfEntries());
+                }
+                writer.writeArray(rowIndications.data(), rowIndications.size());
+                if (matrix.getEntryCount() > 0) {
+                    writer.writeArray(&*matrix.begin(), matrix.getEntryCount());
+                }
+            }
+
+            void writeValuations(BinaryWriter& writer, storm::storage::sparse::StateValuations const& valuations) {
+                // The variables are taken from the first state that has a valuation.
+                uint64_t referenceState = 0;
+                while (referenceState < valuations.getNumberOfStates() && valuations.isEmpty(referenceState)) {
+                    ++referenceState;
+                }
+                std::vector<std::pair<uint8_t, std::string>> variables;
+                if (referenceState < valuations.getNumberOfStates()) {
+                    auto range = valuations.at(referenceState);
+                    for (auto valueIt = range.begin(); valueIt != range.end(); ++valueIt) {
+                        if (valueIt.isLabelAssignment()) {
+                            variables.emplace_back(3, valueIt.getLabel());
+                        } else {
+                            variables.emplace_back(valueIt.isBoolean() ? 0 : (valueIt.isInteger() ? 1 : 2), valueIt.getName());
+                        }
+                    }
+                }
+                writer.write<uint64_t>(variables.size());
+                for (auto const& variable : variables) {
+                    writer.write<uint64_t>(variable.first);
+                    writer.writeString(variable.second);
+                }
+
+                writer.write<uint64_t>(valuations.getNumberOfStates());
+                for (uint64_t state = 0; state < valuations.getNumberOfStates(); ++state) {
+                    if (valuations.isEmpty(state)) {
+                        writer.write<uint64_t>(0);
+                        continue;
+                    }
+                    writer.write<uint64_t>(1);
+                    auto range = valuations.at(state);
+                    for (auto valueIt = range.begin(); valueIt != range.end(); ++valueIt) {
+                        if (valueIt.isLabelAssignment()) {
+                            writer.write<int64_t>(valueIt.getLabelValue());
+                        } else if (valueIt.isBoolean()) {
+                            writer.write<int64_t>(valueIt.getBooleanValue() ? 1 : 0);
+                        } else if (valueIt.isInteger()) {
+                            writer.write<int64_t>(valueIt.getIntegerValue());
+                        } else {
+                            std::stringstream stream;
+                            stream << valueIt.getRationalValue();
+                            writer.writeString(stream.str());
+                        }
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            void exportModel(std::ostream&, std::shared_ptr<storm::models::sparse::Model<ValueType>> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary format only supports models with double values.");
+            }
+
+            void exportModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+                auto modelType = sparseModel->getType();
+                STORM_LOG_THROW(modelType != storm::models::ModelType::S2pg && modelType != storm::models::ModelType::Smg, storm::exceptions::NotSupportedException, "The binary format does not support games.");
+                STORM_LOG_WARN_COND(!sparseModel->hasChoiceOrigins(), "The choice origins of the model are not exported to the binary format.");
+                auto const& matrix = sparseModel->getTransitionMatrix();
+
+                BinaryEncodingHeader header;
+                std::copy(BinaryEncodingHeader::Magic, BinaryEncodingHeader::Magic + 8, header.magic);
+                header.version = BinaryEncodingHeader::Version;
+                header.byteOrderMark = BinaryEncodingHeader::ByteOrderMark;
+                header.modelType = static_cast<uint32_t>(modelType);
+                header.valueSize = sizeof(double);
+                header.stateCount = sparseModel->getNumberOfStates();
+                header.choiceCount = matrix.getRowCount();
+                header.entryCount = matrix.getEntryCount();
+                header.rewardModelCount = sparseModel->getRewardModels().size();
+                header.flags = 0;
+                if (!matrix.hasTrivialRowGrouping()) {
+                    header.flags |= BinaryEncodingHeader::HasRowGroups;
+                }
+                if (modelType == storm::models::ModelType::Ctmc || modelType == storm::models::ModelType::MarkovAutomaton) {
+                    header.flags |= BinaryEncodingHeader::HasExitRates;
+                }
+                if (modelType == storm::models::ModelType::MarkovAutomaton) {
+                    header.flags |= BinaryEncodingHeader::HasMarkovianStates;
+                }
+                if (modelType == storm::models::ModelType::Pomdp) {
+                    header.flags |= BinaryEncodingHeader::HasObservations;
+                }
+                if (sparseModel->hasChoiceLabeling()) {
+                    header.flags |= BinaryEncodingHeader::HasChoiceLabeling;
+                }
+                if (sparseModel->hasStateValuations()) {
+                    header.flags |= BinaryEncodingHeader::HasStateValuations;
+                }
+
+                BinaryWriter writer(os);
+                writer.write(header);
+
+                // Transition matrix. For CTMCs, this is the rate matrix.
+                if (header.flags & BinaryEncodingHeader::HasRowGroups) {
+                    writer.writeArray(matrix.getRowGroupIndices().data(), matrix.getRowGroupIndices().size());
+                }
+                writeMatrix(writer, matrix);
+
+                // Model type specific components.
+                if (modelType == storm::models::ModelType::Ctmc) {
+                    auto const& exitRates = sparseModel->template as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+                    writer.writeArray(exitRates.data(), exitRates.size());
+                } else if (modelType == storm::models::ModelType::MarkovAutomaton) {
+                    auto const& ma = *sparseModel->template as<storm::models::sparse::MarkovAutomaton<double>>();
+                    writer.writeArray(ma.getExitRates().data(), ma.getExitRates().size());
+                    writer.writeBitVector(ma.getMarkovianStates());
+                } else if (modelType == storm::models::ModelType::Pomdp) {
+                    auto const& observations = sparseModel->template as<storm::models::sparse::Pomdp<double>>()->getObservations();
+                    writer.writeArray(observations.data(), observations.size());
+                    writer.align();
+                }
+
+                // Labelings.
+                auto writeLabeling = [&writer] (storm::models::sparse::ItemLabeling const& labeling, std::function<storm::storage::BitVector const&(std::string const&)> const& getItems) {
+                    std::set<std::string> labels = labeling.getLabels();
+                    writer.write<uint64_t>(labels.size());
+                    for (auto const& label : labels) {
+                        writer.writeString(label);
+                        writer.writeBitVector(getItems(label));
+                    }
+                };
+                auto const& stateLabeling = sparseModel->getStateLabeling();
+                writeLabeling(stateLabeling, [&stateLabeling] (std::string const& label) -> storm::storage::BitVector const& { return stateLabeling.getStates(label); });
+                if (sparseModel->hasChoiceLabeling()) {
+                    auto const& choiceLabeling = sparseModel->getChoiceLabeling();
+                    writeLabeling(choiceLabeling, [&choiceLabeling] (std::string const& label) -> storm::storage::BitVector const& { return choiceLabeling.getChoices(label); });
+                }
+
+                // Reward models, each consisting of a name, a flag for each reward kind and the reward vectors.
+                for (auto const& rewardModel : sparseModel->getRewardModels()) {
+                    writer.writeString(rewardModel.first);
+                    writer.write<uint64_t>(rewardModel.second.hasStateRewards() ? 1 : 0);
+                    writer.write<uint64_t>(rewardModel.second.hasStateActionRewards() ? 1 : 0);
+                    writer.write<uint64_t>(rewardModel.second.hasTransitionRewards() ? 1 : 0);
+                    if (rewardModel.second.hasStateRewards()) {
+                        writer.writeArray(rewardModel.second.getStateRewardVector().data(), rewardModel.second.getStateRewardVector().size());
+                    }
+                    if (rewardModel.second.hasStateActionRewards()) {
+                        writer.writeArray(rewardModel.second.getStateActionRewardVector().data(), rewardModel.second.getStateActionRewardVector().size());
+                    }
+                    if (rewardModel.second.hasTransitionRewards()) {
+                        writeMatrix(writer, rewardModel.second.getTransitionRewardMatrix());
+                    }
+                }
+
+                if (sparseModel->hasStateValuations()) {
+                    writeValuations(writer, sparseModel->getStateValuations());
+                }
+                writer.checkState();
+            }
+        }
+
+        template<typename ValueType>
+        void explicitExportSparseModelAsBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel) {
+            exportModel(os, sparseModel);
+        }
+
+        template void explicitExportSparseModelAsBinary<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+        template void explicitExportSparseModelAsBinary<storm::RationalNumber>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> const& sparseModel);
+        template void explicitExportSparseModelAsBinary<storm::RationalFunction>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const& sparseModel);
+    }
+}
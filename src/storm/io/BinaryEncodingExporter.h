@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace exporter {
+
+        /*!
+         * The binary format stores the arrays of a sparse model (in particular the ones of the transition matrix) as
+         * they are laid out in memory, such that loading a model amounts to mapping the file to memory and copying
+         * these arrays. The file starts with the header below, followed by the sections of the model in a fixed order.
+         * All sections start at positions that are multiples of eight. Numbers are stored in the byte order of the
+         * machine that wrote the file; files with a different byte order are rejected when loading.
+         *
+         * The format is not meant for archiving models: it is tied to the version given below and files written with
+         * another version are rejected as well.
+         */
+        struct BinaryEncodingHeader {
+            // The flags indicating which optional sections are present.
+            static const uint64_t HasRowGroups = 1ull << 0;
+            static const uint64_t HasExitRates = 1ull << 1;
+            static const uint64_t HasMarkovianStates = 1ull << 2;
+            static const uint64_t HasObservations = 1ull << 3;
+            static const uint64_t HasChoiceLabeling = 1ull << 4;
+            static const uint64_t HasStateValuations = 1ull << 5;
+
+            static const char Magic[8];
+            static const uint32_t Version;
+            static const uint32_t ByteOrderMark;
+
+            char magic[8];
+            uint32_t version;
+            uint32_t byteOrderMark;
+            uint32_t modelType;
+            uint32_t valueSize;
+            uint64_t stateCount;
+            uint64_t choiceCount;
+            uint64_t entryCount;
+            uint64_t rewardModelCount;
+            uint64_t flags;
+        };
+
+        /*!
+         * Exports a sparse model into the binary format. Only models with double values are supported.
+         *
+         * @param os           Stream to export to. It needs to be opened in binary mode.
+         * @param sparseModel  Model to export
+         */
+        template<typename ValueType>
+        void explicitExportSparseModelAsBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel);
+
+    }
+}
@@ -191,6 +191,36 @@ namespace storm {
             return multiobjective::performMultiObjectiveModelChecking(env, this->getModel(), checkTask.getFormula());
         }
         
+        template<typename SparseMarkovAutomatonModelType>
+        std::vector<std::unique_ptr<CheckResult>> SparseMarkovAutomatonCslModelChecker<SparseMarkovAutomatonModelType>::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask, std::vector<double> const& upperTimeBounds) {
+            storm::logic::Formula const& pathFormula = checkTask.getFormula();
+            STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+            STORM_LOG_THROW(this->getModel().isClosed(), storm::exceptions::InvalidPropertyException, "Unable to compute time-bounded reachability probabilities in non-closed Markov automaton.");
+            storm::storage::BitVector phiStates(this->getModel().getNumberOfStates(), true);
+            std::unique_ptr<CheckResult> rightResultPointer;
+            if (pathFormula.isEventuallyFormula()) {
+                rightResultPointer = this->check(env, pathFormula.asEventuallyFormula().getSubformula());
+            } else if (pathFormula.isUntilFormula()) {
+                phiStates = this->check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                rightResultPointer = this->check(env, pathFormula.asUntilFormula().getRightSubformula());
+            } else {
+                STORM_LOG_THROW(pathFormula.isBoundedUntilFormula(), storm::exceptions::InvalidPropertyException, "Unable to compute probabilities for several time bounds of formula " << pathFormula << ".");
+                storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+                STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && boundedUntilFormula.getTimeBoundReference().isTimeBound(), storm::exceptions::NotImplementedException, "Only time-bounded until formulas can be checked for several time bounds.");
+                STORM_LOG_THROW(!boundedUntilFormula.hasLowerBound(), storm::exceptions::NotImplementedException, "Formulas with a lower time bound can not be checked for several time bounds.");
+                phiStates = this->check(env, boundedUntilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                rightResultPointer = this->check(env, boundedUntilFormula.getRightSubformula());
+            }
+            ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+            
+            std::vector<std::vector<ValueType>> numericResults = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getExitRates(), this->getModel().getMarkovianStates(), phiStates, rightResult.getTruthValuesVector(), upperTimeBounds);
+            std::vector<std::unique_ptr<CheckResult>> results;
+            for (auto& numericResult : numericResults) {
+                results.emplace_back(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+            }
+            return results;
+        }
+        
         template class SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>>;
         template class SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>;
     }
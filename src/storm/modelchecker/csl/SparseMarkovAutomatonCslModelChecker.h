@@ -35,6 +35,15 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeLongRunAverageRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeReachabilityTimes(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(Environment const& env, CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
+
+            /*!
+             * Computes the probabilities of the given until (or eventually) formula for each of the given upper time bounds.
+             * A time bound of the formula is replaced by the given ones, so the formula must not have a lower time bound.
+             * All time bounds are handled in a single computation.
+             *
+             * @return For each time bound, the result of the check.
+             */
+            std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask, std::vector<double> const& upperTimeBounds);
         };
     }
 }
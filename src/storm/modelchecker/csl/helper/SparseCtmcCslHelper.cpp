@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <map>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -34,7 +36,108 @@
 namespace storm {
     namespace modelchecker {
         namespace helper {
-            
+
+            namespace detail {
+                /*!
+                 * Performs matrix-vector multiplications x' = Ax + b in which only the rows are considered that can
+                 * obtain a non-zero value, i.e., the states in the support of x and b as well as their predecessors.
+                 * The support is over-approximated solely based on the graph of the matrix and only grows. Once it
+                 * covers half of the states, the regular multiplier is used.
+                 *
+                 * @note Entries of the result that are outside of the support are not written, i.e., they have to be zero.
+                 */
+                template<typename ValueType>
+                class SupportRestrictedMultiplier {
+                public:
+                    SupportRestrictedMultiplier(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& initialValues, std::vector<ValueType> const* addVector, bool restrictToSupport) : matrix(matrix), addVector(addVector), multiplier(storm::solver::MultiplierFactory<ValueType>().create(env, matrix)), restricted(restrictToSupport) {
+                        if (restricted) {
+                            support = storm::storage::BitVector(matrix.getRowCount());
+                            for (uint64_t state = 0; state < matrix.getRowCount(); ++state) {
+                                if (!storm::utility::isZero(initialValues[state]) || (addVector != nullptr && !storm::utility::isZero((*addVector)[state]))) {
+                                    support.set(state);
+                                    frontier.push_back(state);
+                                }
+                            }
+                            checkSupportSize();
+                            if (restricted) {
+                                transposedMatrix = matrix.transpose(false, true);
+                                buffer.resize(matrix.getRowCount());
+                            }
+                        }
+                    }
+
+                    /*!
+                     * Computes result = Ax + b. The vectors x and result may coincide.
+                     */
+                    void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType>& result) {
+                        if (restricted) {
+                            extendSupport();
+                        }
+                        if (!restricted) {
+                            multiplier->multiply(env, x, addVector, result);
+                            return;
+                        }
+                        for (auto row : support) {
+                            buffer[row] = matrix.multiplyRowWithVector(row, x);
+                            if (addVector != nullptr) {
+                                buffer[row] += (*addVector)[row];
+                            }
+                        }
+                        for (auto row : support) {
+                            result[row] = buffer[row];
+                        }
+                    }
+
+                    /*!
+                     * Performs n multiplications in place.
+                     */
+                    void repeatedMultiply(Environment const& env, std::vector<ValueType>& x, uint64_t n) {
+                        for (; n > 0 && restricted; --n) {
+                            multiply(env, x, x);
+                        }
+                        if (n > 0) {
+                            multiplier->repeatedMultiply(env, x, addVector, n);
+                        }
+                    }
+
+                private:
+                    /*!
+                     * Adds the predecessors of the states that were added to the support in the previous step.
+                     */
+                    void extendSupport() {
+                        std::vector<uint64_t> newFrontier;
+                        for (auto state : frontier) {
+                            for (auto const& entry : transposedMatrix.getRow(state)) {
+                                if (!support.get(entry.getColumn())) {
+                                    support.set(entry.getColumn());
+                                    newFrontier.push_back(entry.getColumn());
+                                }
+                            }
+                        }
+                        frontier = std::move(newFrontier);
+                        checkSupportSize();
+                    }
+
+                    void checkSupportSize() {
+                        if (support.getNumberOfSetBits() * 2 > support.size()) {
+                            STORM_LOG_TRACE("Support covers " << support.getNumberOfSetBits() << " of " << support.size() << " states. Switching to unrestricted multiplication.");
+                            restricted = false;
+                            transposedMatrix = storm::storage::SparseMatrix<ValueType>();
+                        }
+                    }
+
+                    storm::storage::SparseMatrix<ValueType> const& matrix;
+                    std::vector<ValueType> const* addVector;
+                    std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplier;
+                    bool restricted;
+
+                    storm::storage::SparseMatrix<ValueType> transposedMatrix;
+                    storm::storage::BitVector support;
+                    std::vector<uint64_t> frontier;
+                    std::vector<ValueType> buffer;
+                };
+            }
+
             template <typename ValueType>
             bool SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon, std::vector<ValueType> const& resultVector, storm::storage::BitVector const& relevantPositions) {
                 // Check if the check is necessary for the provided settings
@@ -258,6 +361,106 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, std::vector<double> const& upperBounds) {
+                
+                STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException, "Exact computations not possible for bounded until probabilities.");
+                
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                std::vector<std::vector<ValueType>> results(upperBounds.size());
+                
+                // Infinite time bounds correspond to untimed reachability, which is computed (at most) once.
+                boost::optional<std::vector<ValueType>> untimedResult;
+                std::vector<uint64_t> finiteBoundIndices;
+                for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+                    STORM_LOG_THROW(upperBounds[boundIndex] >= 0.0, storm::exceptions::InvalidOperationException, "Time bounds must not be negative.");
+                    if (upperBounds[boundIndex] == storm::utility::infinity<double>()) {
+                        if (!untimedResult) {
+                            untimedResult = computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(goal), rateMatrix, backwardTransitions, exitRates, phiStates, psiStates, qualitative);
+                        }
+                        results[boundIndex] = untimedResult.get();
+                    } else {
+                        finiteBoundIndices.push_back(boundIndex);
+                    }
+                }
+                if (finiteBoundIndices.empty()) {
+                    return results;
+                }
+                
+                // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+                ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+                
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+                
+                // the positions within the result for which the precision needs to be checked
+                storm::storage::BitVector relevantValues;
+                if (goal.hasRelevantValues()) {
+                    relevantValues = std::move(goal.relevantValues());
+                    relevantValues &= statesWithProbabilityGreater0;
+                } else {
+                    relevantValues = statesWithProbabilityGreater0;
+                }
+                
+                // The uniformized matrix does not depend on the time bound, so it is built once for all bounds.
+                ValueType uniformizationRate = storm::utility::zero<ValueType>();
+                storm::storage::SparseMatrix<ValueType> uniformizedMatrix;
+                std::vector<ValueType> b;
+                std::vector<ValueType> timeBounds;
+                if (!statesWithProbabilityGreater0NonPsi.empty()) {
+                    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                    for (auto state : statesWithProbabilityGreater0NonPsi) {
+                        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                    }
+                    uniformizationRate *= 1.02;
+                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                    uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                    
+                    // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                    b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                    for (auto& element : b) {
+                        element /= uniformizationRate;
+                    }
+                    for (auto boundIndex : finiteBoundIndices) {
+                        timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBounds[boundIndex]));
+                    }
+                }
+                
+                bool refine;
+                do { // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+                    std::vector<std::vector<ValueType>> subresults;
+                    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+                        std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                        subresults = computeTransientProbabilitiesForTimeBounds(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+                    }
+                    
+                    refine = false;
+                    ValueType newEpsilon = epsilon;
+                    for (uint64_t i = 0; i < finiteBoundIndices.size(); ++i) {
+                        std::vector<ValueType>& result = results[finiteBoundIndices[i]];
+                        result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                        storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
+                        if (!subresults.empty()) {
+                            storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresults[i]);
+                        }
+                        // All time bounds share the truncation error, so the strictest requirement determines the new one.
+                        ValueType boundEpsilon = epsilon;
+                        if (checkAndUpdateTransientProbabilityEpsilon(env, boundEpsilon, result, relevantValues)) {
+                            refine = true;
+                            newEpsilon = std::min(newEpsilon, boundEpsilon);
+                        }
+                    }
+                    epsilon = newEpsilon;
+                } while (refine);
+                return results;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, std::vector<double> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative) {
                 return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(goal), computeProbabilityMatrix(rateMatrix, exitRateVector), backwardTransitions, phiStates, psiStates, qualitative);
@@ -518,9 +721,6 @@ namespace storm {
 
                     transposedMatrix = transposedMatrix.transpose();
 
-                    // Compute the uniformized matrix.
-                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(transposedMatrix, relevantStates, uniformizationRate, newRates);
-
                     // Compute the vector that is to be added as a compensation for removing the absorbing states.
                     /*std::vector<ValueType> b = transposedMatrix.getConstrainedRowSumVector(relevantStates, initialStates);
                     for (auto& element : b) {
@@ -541,7 +741,14 @@ namespace storm {
                         ++i;
                     }
                     // Finally compute the transient probabilities.
-                    std::vector<ValueType> subresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+                    std::vector<ValueType> subresult;
+                    if (env.solver().timeBounded().getAdaptiveUniformization()) {
+                        subresult = computeTransientDistributionAdaptively<ValueType>(env, transposedMatrix.getSubmatrix(false, relevantStates, relevantStates), storm::utility::vector::filterVector(newRates, relevantStates), timeBound, values, epsilon);
+                    } else {
+                        // Compute the uniformized matrix.
+                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(transposedMatrix, relevantStates, uniformizationRate, newRates);
+                        subresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+                    }
 
                     storm::utility::vector::setVectorValues(result, relevantStates, subresult);
                 }
@@ -625,16 +832,16 @@ namespace storm {
                     }
                 }
                 
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+                detail::SupportRestrictedMultiplier<ValueType> multiplier(env, uniformizedMatrix, values, addVector, env.solver().timeBounded().getAdaptiveUniformization());
                 if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
                     // Perform the matrix-vector multiplications (without adding).
-                    multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
+                    multiplier.repeatedMultiply(env, values, foxGlynnResult.left - 1);
                 } else if (useMixedPoissonProbabilities) {
                     std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
                     
                     // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
                     for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-                        multiplier->multiply(env, values, nullptr, values);
+                        multiplier.multiply(env, values, values);
                         storm::utility::vector::applyPointwise(result, values, result, addAndScale);
                     }
                     // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
@@ -648,7 +855,7 @@ namespace storm {
                 ValueType weight = 0;
                 std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
                 for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
-                    multiplier->multiply(env, values, addVector, values);
+                    multiplier.multiply(env, values, values);
                     
                     weight = foxGlynnResult.weights[index - foxGlynnResult.left];
                     storm::utility::vector::applyPointwise(result, values, result, addAndScale);
@@ -658,7 +865,203 @@ namespace storm {
                 storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                 return result;
             }
-            
+
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon) {
+                STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20), "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+                // Compute the Fox-Glynn weights once for every distinct time bound.
+                std::map<ValueType, uint64_t> timeBoundToWindow;
+                std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> windows;
+                std::vector<uint64_t> windowOfTimeBound;
+                windowOfTimeBound.reserve(timeBounds.size());
+                uint64_t lastStep = 0;
+                for (auto const& timeBound : timeBounds) {
+                    STORM_LOG_THROW(timeBound >= storm::utility::zero<ValueType>(), storm::exceptions::InvalidOperationException, "Time bounds must not be negative.");
+                    auto windowIt = timeBoundToWindow.find(timeBound);
+                    if (windowIt == timeBoundToWindow.end()) {
+                        windowIt = timeBoundToWindow.emplace(timeBound, windows.size()).first;
+                        if (storm::utility::isZero(timeBound)) {
+                            // If no time can pass, the weight of the initial values is one.
+                            storm::utility::numerical::FoxGlynnResult<ValueType> window;
+                            window.left = 0;
+                            window.right = 0;
+                            window.totalWeight = storm::utility::one<ValueType>();
+                            window.weights.push_back(storm::utility::one<ValueType>());
+                            windows.push_back(std::move(window));
+                        } else {
+                            windows.push_back(storm::utility::numerical::foxGlynn(timeBound * uniformizationRate, epsilon));
+                            STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBound << ": left=" << windows.back().left << ", right=" << windows.back().right);
+                        }
+                        lastStep = std::max<uint64_t>(lastStep, windows.back().right);
+                    }
+                    windowOfTimeBound.push_back(windowIt->second);
+                }
+
+                STORM_LOG_DEBUG("Performing " << lastStep << " iterations for " << windows.size() << " time bounds with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+
+                // All windows share the vectors obtained by the matrix-vector multiplications.
+                std::vector<std::vector<ValueType>> windowResults(windows.size(), std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>()));
+                std::vector<ValueType> currentValues = values;
+                detail::SupportRestrictedMultiplier<ValueType> multiplier(env, uniformizedMatrix, currentValues, addVector, env.solver().timeBounded().getAdaptiveUniformization());
+                ValueType weight = storm::utility::zero<ValueType>();
+                std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
+                for (uint64_t step = 0; step <= lastStep; ++step) {
+                    if (step > 0) {
+                        multiplier.multiply(env, currentValues, currentValues);
+                    }
+                    for (uint64_t window = 0; window < windows.size(); ++window) {
+                        if (windows[window].left <= step && step <= windows[window].right) {
+                            weight = windows[window].weights[step - windows[window].left];
+                            storm::utility::vector::applyPointwise(windowResults[window], currentValues, windowResults[window], addAndScale);
+                        }
+                    }
+                }
+
+                for (uint64_t window = 0; window < windows.size(); ++window) {
+                    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(windowResults[window], storm::utility::one<ValueType>() / windows[window].totalWeight);
+                }
+
+                std::vector<std::vector<ValueType>> result;
+                result.reserve(timeBounds.size());
+                for (auto window : windowOfTimeBound) {
+                    result.push_back(windowResults[window]);
+                }
+                return result;
+            }
+
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<ValueType> SparseCtmcCslHelper::computeTransientDistributionAdaptively(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transposedRateMatrix, std::vector<ValueType> const& exitRates, ValueType timeBound, std::vector<ValueType> const& values, ValueType epsilon) {
+                uint64_t numberOfStates = transposedRateMatrix.getRowCount();
+
+                // Compute the rates with which the states are left (ignoring self-loops) and a matrix that only contains the
+                // incoming rates of other states.
+                std::vector<ValueType> outgoingRates = exitRates;
+                storm::storage::SparseMatrix<ValueType> incomingRates(transposedRateMatrix);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    for (auto& entry : incomingRates.getRow(state)) {
+                        if (entry.getColumn() == state) {
+                            outgoingRates[state] = std::max(storm::utility::zero<ValueType>(), outgoingRates[state] - entry.getValue());
+                            entry.setValue(storm::utility::zero<ValueType>());
+                        }
+                    }
+                }
+                ValueType maximalRate = storm::utility::zero<ValueType>();
+                for (auto const& rate : outgoingRates) {
+                    maximalRate = std::max(maximalRate, rate);
+                }
+                if (storm::utility::isZero(timeBound) || storm::utility::isZero(maximalRate)) {
+                    return values;
+                }
+
+                // The number of steps that standard uniformization would perform serves as a limit.
+                ValueType uniformizationRate = maximalRate * storm::utility::convertNumber<ValueType>(1.02);
+                uint64_t standardSteps = storm::utility::numerical::foxGlynn(timeBound * uniformizationRate, epsilon).right;
+
+                // Determine the rates of the steps. The n-th rate is the maximal outgoing rate of a state that is reachable
+                // within n steps. As the sets of these states are increasing, so are the rates.
+                storm::storage::SparseMatrix<ValueType> transitions = transposedRateMatrix.transpose(false, true);
+                storm::storage::BitVector reachedStates(numberOfStates);
+                std::vector<uint64_t> frontier;
+                ValueType currentRate = storm::utility::zero<ValueType>();
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (!storm::utility::isZero(values[state])) {
+                        reachedStates.set(state);
+                        frontier.push_back(state);
+                        currentRate = std::max(currentRate, outgoingRates[state]);
+                    }
+                }
+                std::vector<ValueType> stepRates;
+
+                // The number of jumps N(t) of a pure birth process whose rates are the step rates determines how often each
+                // step is taken. Its distribution is obtained by uniformizing the birth process, which is cheap as its
+                // states form a chain. The last state of the chain collects the probability of taking too many steps.
+                std::vector<ValueType> jumpProbabilities;
+                uint64_t numberOfSteps = std::min<uint64_t>(64, standardSteps);
+                while (true) {
+                    while (stepRates.size() < numberOfSteps) {
+                        stepRates.push_back(currentRate);
+                        std::vector<uint64_t> newFrontier;
+                        for (auto state : frontier) {
+                            for (auto const& entry : transitions.getRow(state)) {
+                                if (!reachedStates.get(entry.getColumn())) {
+                                    reachedStates.set(entry.getColumn());
+                                    newFrontier.push_back(entry.getColumn());
+                                    currentRate = std::max(currentRate, outgoingRates[entry.getColumn()]);
+                                }
+                            }
+                        }
+                        frontier = std::move(newFrontier);
+                    }
+
+                    ValueType chainRate = stepRates.back();
+                    if (storm::utility::isZero(chainRate)) {
+                        // The initial distribution can not be left.
+                        return values;
+                    }
+                    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(timeBound * chainRate, epsilon / storm::utility::convertNumber<ValueType>(2.0));
+                    if (foxGlynnResult.right * numberOfSteps > standardSteps * transposedRateMatrix.getEntryCount()) {
+                        STORM_LOG_INFO("Adaptive uniformization does not pay off. Using standard uniformization.");
+                        break;
+                    }
+
+                    std::vector<ValueType> chain(numberOfSteps + 1, storm::utility::zero<ValueType>());
+                    chain.front() = storm::utility::one<ValueType>();
+                    jumpProbabilities.assign(numberOfSteps + 1, storm::utility::zero<ValueType>());
+                    for (uint64_t iteration = 0; iteration <= foxGlynnResult.right; ++iteration) {
+                        if (iteration >= foxGlynnResult.left) {
+                            ValueType const& weight = foxGlynnResult.weights[iteration - foxGlynnResult.left];
+                            for (uint64_t jump = 0; jump <= std::min(iteration, numberOfSteps); ++jump) {
+                                jumpProbabilities[jump] += weight * chain[jump];
+                            }
+                        }
+                        for (uint64_t jump = std::min(iteration + 1, numberOfSteps); jump > 0; --jump) {
+                            if (jump < numberOfSteps) {
+                                chain[jump] *= storm::utility::one<ValueType>() - stepRates[jump] / chainRate;
+                            }
+                            chain[jump] += chain[jump - 1] * stepRates[jump - 1] / chainRate;
+                        }
+                        chain.front() *= storm::utility::one<ValueType>() - stepRates.front() / chainRate;
+                    }
+                    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(jumpProbabilities, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+
+                    if (jumpProbabilities.back() <= epsilon / storm::utility::convertNumber<ValueType>(2.0)) {
+                        jumpProbabilities.pop_back();
+                        break;
+                    }
+                    if (numberOfSteps >= standardSteps) {
+                        STORM_LOG_INFO("Adaptive uniformization does not pay off. Using standard uniformization.");
+                        jumpProbabilities.clear();
+                        break;
+                    }
+                    numberOfSteps = std::min(2 * numberOfSteps, standardSteps);
+                }
+
+                if (jumpProbabilities.empty()) {
+                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(transposedRateMatrix, storm::storage::BitVector(numberOfStates, true), uniformizationRate, exitRates);
+                    return computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+                }
+                STORM_LOG_DEBUG("Adaptive uniformization performs " << jumpProbabilities.size() << " steps instead of " << standardSteps << ".");
+
+                // The distribution after n steps is obtained from the one after n - 1 steps by uniformizing with the n-th rate.
+                std::vector<ValueType> result(numberOfStates, storm::utility::zero<ValueType>());
+                std::vector<ValueType> currentValues = values;
+                std::vector<ValueType> incoming(numberOfStates, storm::utility::zero<ValueType>());
+                detail::SupportRestrictedMultiplier<ValueType> multiplier(env, incomingRates, currentValues, nullptr, true);
+                for (uint64_t step = 0; step < jumpProbabilities.size(); ++step) {
+                    storm::utility::vector::addScaledVector(result, currentValues, jumpProbabilities[step]);
+                    if (step + 1 == jumpProbabilities.size() || storm::utility::isZero(stepRates[step])) {
+                        continue;
+                    }
+                    multiplier.multiply(env, currentValues, incoming);
+                    ValueType const& rate = stepRates[step];
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        currentValues[state] = currentValues[state] * (storm::utility::one<ValueType>() - outgoingRates[state] / rate) + incoming[state] / rate;
+                    }
+                }
+                return result;
+            }
+
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
                 // Turn the rates into probabilities by scaling each row with the exit rate of the state.
@@ -689,6 +1092,7 @@ namespace storm {
             
             
             template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
             
             template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
 
@@ -712,9 +1116,15 @@ namespace storm {
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, double epsilon);
 
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> const& values, double epsilon);
+
+            template std::vector<double> SparseCtmcCslHelper::computeTransientDistributionAdaptively(Environment const& env, storm::storage::SparseMatrix<double> const& transposedRateMatrix, std::vector<double> const& exitRates, double timeBound, std::vector<double> const& values, double epsilon);
+
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
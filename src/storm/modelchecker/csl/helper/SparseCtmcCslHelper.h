@@ -28,6 +28,19 @@ namespace storm {
                 template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound);
                 
+                /*!
+                 * Computes the probabilities of satisfying phi U[0,t] psi for each of the given upper time bounds t. The
+                 * uniformized matrix is built once and all time bounds share the matrix-vector multiplications, so the
+                 * effort is essentially that of the largest time bound. Time bounds may be infinite.
+                 *
+                 * @return For each time bound, the vector of probabilities.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
+
+                template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
+
                 template <typename ValueType>
                 static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
 
@@ -91,7 +104,41 @@ namespace storm {
                  */
                 template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
-                
+
+                /*!
+                 * Computes the transient probabilities for several time bounds at once. All time bounds share the
+                 * matrix-vector multiplications, i.e., the number of multiplications is determined by the largest time
+                 * bound only. Time bounds that coincide share their Fox-Glynn weights.
+                 *
+                 * @param uniformizedMatrix The uniformized transition matrix.
+                 * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+                 * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+                 * @param timeBounds The time bounds to use.
+                 * @param uniformizationRate The used uniformization rate.
+                 * @param values A vector mapping each state to an initial probability.
+                 * @param epsilon The precision used for computing the truncation points.
+                 * @return For each time bound, the vector of transient probabilities.
+                 */
+                template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeTransientProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon);
+
+                /*!
+                 * Computes the transient distribution at the given time bound using adaptive uniformization. The n-th
+                 * step is uniformized with the maximal exit rate of the states that can be reached within n steps
+                 * from the initial distribution, so as long as the distribution resides in slow states, few steps are
+                 * needed. If this does not save steps compared to standard uniformization, standard uniformization is
+                 * used instead.
+                 *
+                 * @param transposedRateMatrix The transposed rate matrix, i.e., the row of a state holds its incoming rates.
+                 * @param exitRates The exit rates of all states.
+                 * @param timeBound The time bound to use.
+                 * @param values The initial distribution.
+                 * @param epsilon The precision used for computing the truncation points.
+                 * @return The transient distribution.
+                 */
+                template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<ValueType> computeTransientDistributionAdaptively(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transposedRateMatrix, std::vector<ValueType> const& exitRates, ValueType timeBound, std::vector<ValueType> const& values, ValueType epsilon);
+
                 /*!
                  * Converts the given rate-matrix into a time-abstract probability matrix.
                  *
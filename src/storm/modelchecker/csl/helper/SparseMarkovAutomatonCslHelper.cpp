@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include <numeric>
+
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
@@ -63,10 +65,14 @@ namespace storm {
             template<typename ValueType>
             class UnifPlusHelper {
             public:
-                UnifPlusHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates) : transitionMatrix(transitionMatrix), exitRateVector(exitRateVector), markovianStates(markovianStates) {
+                UnifPlusHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates) : transitionMatrix(transitionMatrix), exitRateVector(exitRateVector), markovianStates(markovianStates), minimalUniformizationRate(storm::utility::zero<ValueType>()) {
                     // Intentionally left empty
                 }
                 
+                /*!
+                 * Computes the bounded until probabilities. The uniformization rate that was sufficient for a previous
+                 * call serves as the initial rate, which saves the restarts for increasing time bounds.
+                 */
                 std::vector<ValueType> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, ValueType const& upperTimeBound, boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
                     // Since there is no lower time bound, we can treat the psiStates as if they are absorbing.
                     
@@ -103,7 +109,7 @@ namespace storm {
                     ValueType epsilon = two * storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision());
                     bool relativePrecision = env.solver().timeBounded().getRelativeTerminationCriterion();
                     // Uniformization rate
-                    ValueType lambda = *std::max_element(markovianExitRates.begin(), markovianExitRates.end());
+                    ValueType lambda = std::max(*std::max_element(markovianExitRates.begin(), markovianExitRates.end()), minimalUniformizationRate);
                     STORM_LOG_DEBUG("Initial lambda is " << lambda << ".");
 
                     // Split the transitions into various part
@@ -296,6 +302,9 @@ namespace storm {
                             break;
                         }
                     }
+                    if (converged) {
+                        minimalUniformizationRate = lambda;
+                    }
 
                     // Prepare the result vector
                     std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
@@ -460,6 +469,9 @@ namespace storm {
                 storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
                 std::vector<ValueType> const& exitRateVector;
                 storm::storage::BitVector const& markovianStates;
+                
+                /// The uniformization rate with which the last computation converged.
+                ValueType minimalUniformizationRate;
             };
             
             template <typename ValueType>
@@ -684,6 +696,53 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds) {
+                STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException, "Exact computations not possible for bounded until probabilities.");
+                
+                auto method = env.solver().timeBounded().getMaMethod();
+                if (method == storm::solver::MaBoundedReachabilityMethod::Imca && !phiStates.full()) {
+                    STORM_LOG_WARN("Using Unif+ method because IMCA method does not support (phi Until psi) for non-trivial phi");
+                    method = storm::solver::MaBoundedReachabilityMethod::UnifPlus;
+                }
+                boost::optional<storm::storage::BitVector> relevantValues;
+                if (goal.hasRelevantValues()) {
+                    relevantValues = std::move(goal.relevantValues());
+                }
+                
+                // Treat the time bounds in ascending order, so Unif+ can start each computation with the uniformization rate that was sufficient for the previous (smaller) bound.
+                std::vector<uint64_t> boundOrder(upperBounds.size());
+                std::iota(boundOrder.begin(), boundOrder.end(), 0);
+                std::stable_sort(boundOrder.begin(), boundOrder.end(), [&upperBounds] (uint64_t const& first, uint64_t const& second) { return upperBounds[first] < upperBounds[second]; });
+                
+                std::vector<std::vector<ValueType>> results(upperBounds.size());
+                UnifPlusHelper<ValueType> helper(transitionMatrix, exitRateVector, markovianStates);
+                boost::optional<std::vector<ValueType>> untimedResult;
+                for (auto boundIndex : boundOrder) {
+                    double upperBound = upperBounds[boundIndex];
+                    STORM_LOG_THROW(upperBound >= 0.0, storm::exceptions::InvalidOperationException, "Time bounds must not be negative.");
+                    if (upperBound == 0.0) {
+                        results[boundIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                        storm::utility::vector::setVectorValues(results[boundIndex], psiStates, storm::utility::one<ValueType>());
+                    } else if (upperBound == storm::utility::infinity<double>()) {
+                        if (!untimedResult) {
+                            untimedResult = computeUntilProbabilities<ValueType>(env, goal.direction(), transitionMatrix, transitionMatrix.transpose(true), phiStates, psiStates, false, false).values;
+                        }
+                        results[boundIndex] = untimedResult.get();
+                    } else if (method == storm::solver::MaBoundedReachabilityMethod::Imca) {
+                        results[boundIndex] = computeBoundedUntilProbabilitiesImca(env, goal.direction(), transitionMatrix, exitRateVector, markovianStates, psiStates, std::make_pair(0.0, upperBound));
+                    } else {
+                        results[boundIndex] = helper.computeBoundedUntilProbabilities(env, goal.direction(), phiStates, psiStates, storm::utility::convertNumber<ValueType>(upperBound), relevantValues);
+                    }
+                }
+                return results;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, std::vector<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<double> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+
             template<typename ValueType>
             MDPSparseModelCheckingHelperReturnType<ValueType> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler) {
                 return storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(env, dir, transitionMatrix, backwardTransitions, phiStates, psiStates, qualitative, produceScheduler);
@@ -731,6 +790,8 @@ namespace storm {
             }
 
             template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
+
+            template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
                 
             template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler);
                 
@@ -741,6 +802,8 @@ namespace storm {
             template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeReachabilityTimes(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, bool produceScheduler);
             
             template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
+
+            template std::vector<std::vector<storm::RationalNumber>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
                 
             template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler);
                 
@@ -0,0 +1,183 @@
+#include "storm/modelchecker/helper/utility/GraphAnalysisCache.h"
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            namespace detail {
+                inline uint64_t getSizeOfStateSets(std::pair<storm::storage::BitVector, storm::storage::BitVector> const& stateSets) {
+                    return stateSets.first.getSizeInBytes() + stateSets.second.getSizeInBytes();
+                }
+
+                template<typename ValueType>
+                uint64_t getSizeOfMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                    return sizeof(matrix) + matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>) + (matrix.getRowCount() + 1) * sizeof(uint_fast64_t);
+                }
+
+                template<typename ValueType>
+                uint64_t getSizeOfDecomposition(storm::storage::MaximalEndComponentDecomposition<ValueType> const& decomposition) {
+                    // Each state and choice is stored in a hash map or a flat set, so we estimate a small constant overhead
+                    // per element.
+                    uint64_t result = sizeof(decomposition);
+                    for (auto const& mec : decomposition) {
+                        for (auto const& stateChoicesPair : mec) {
+                            result += 4 * sizeof(uint64_t) + stateChoicesPair.second.size() * sizeof(uint64_t);
+                        }
+                    }
+                    return result;
+                }
+            }
+
+            bool GraphAnalysisCache::Key::operator==(Key const& other) const {
+                return type == other.type && stateSets == other.stateSets;
+            }
+
+            std::size_t GraphAnalysisCache::KeyHash::operator()(Key const& key) const {
+                std::size_t result = static_cast<std::size_t>(key.type);
+                for (auto const& stateSet : key.stateSets) {
+                    boost::hash_combine(result, std::hash<storm::storage::BitVector>()(stateSet));
+                }
+                return result;
+            }
+
+            template<typename ResultType, typename ValueType>
+            std::shared_ptr<ResultType const> GraphAnalysisCache::getOrCompute(Environment const& env, AnalysisType type, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::storage::BitVector>&& stateSets, std::function<ResultType()> const& compute, std::function<uint64_t(ResultType const&)> const& getSizeOfResult) {
+                uint64_t budget = env.modelchecker().getAnalysisCacheSize();
+                if (budget == 0 || &matrix != transitionMatrix) {
+                    return std::make_shared<ResultType>(compute());
+                }
+
+                Key key{type, std::move(stateSets)};
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    // The budget might have been reduced since the last request.
+                    evict(budget);
+                    auto positionIt = positions.find(key);
+                    if (positionIt != positions.end()) {
+                        ++numberOfHits;
+                        // Mark the entry as the most recently used one.
+                        entries.splice(entries.begin(), entries, positionIt->second);
+                        return std::static_pointer_cast<ResultType const>(positionIt->second->value);
+                    }
+                    ++numberOfMisses;
+                }
+
+                std::shared_ptr<ResultType const> result = std::make_shared<ResultType>(compute());
+                // The key is stored twice (in the list and the index).
+                uint64_t resultSize = getSizeOfResult(*result);
+                for (auto const& stateSet : key.stateSets) {
+                    resultSize += 2 * stateSet.getSizeInBytes();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (resultSize > budget || positions.find(key) != positions.end()) {
+                    // The result is either too large or has been inserted concurrently.
+                    return result;
+                }
+                entries.push_front(Entry{key, result, resultSize});
+                positions.emplace(std::move(key), entries.begin());
+                size += resultSize;
+                evict(budget);
+                return result;
+            }
+
+            void GraphAnalysisCache::evict(uint64_t budget) {
+                while (size > budget) {
+                    STORM_LOG_ASSERT(!entries.empty(), "Cache size is positive although there are no entries.");
+                    Entry const& leastRecentlyUsed = entries.back();
+                    size -= leastRecentlyUsed.size;
+                    positions.erase(leastRecentlyUsed.key);
+                    entries.pop_back();
+                }
+            }
+
+            template<typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> GraphAnalysisCache::getBackwardTransitions(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                return getOrCompute<storm::storage::SparseMatrix<ValueType>>(env, AnalysisType::BackwardTransitions, transitionMatrix, {},
+                                                                             [&] () { return transitionMatrix.transpose(true); },
+                                                                             &detail::getSizeOfMatrix<ValueType>);
+            }
+
+            template<typename ValueType>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return *getOrCompute<std::pair<storm::storage::BitVector, storm::storage::BitVector>>(env, AnalysisType::Prob01, transitionMatrix, {phiStates, psiStates},
+                                                                                                    [&] () { return storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates); },
+                                                                                                    &detail::getSizeOfStateSets);
+            }
+
+            template<typename ValueType>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01Max(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return *getOrCompute<std::pair<storm::storage::BitVector, storm::storage::BitVector>>(env, AnalysisType::Prob01Max, transitionMatrix, {phiStates, psiStates},
+                                                                                                    [&] () { return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates); },
+                                                                                                    &detail::getSizeOfStateSets);
+            }
+
+            template<typename ValueType>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01Min(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return *getOrCompute<std::pair<storm::storage::BitVector, storm::storage::BitVector>>(env, AnalysisType::Prob01Min, transitionMatrix, {phiStates, psiStates},
+                                                                                                    [&] () { return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates); },
+                                                                                                    &detail::getSizeOfStateSets);
+            }
+
+            template<typename ValueType>
+            std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> GraphAnalysisCache::getMaximalEndComponentDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
+                return getOrCompute<storm::storage::MaximalEndComponentDecomposition<ValueType>>(env, AnalysisType::MaximalEndComponents, transitionMatrix, {states},
+                                                                                                [&] () { return storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, states); },
+                                                                                                &detail::getSizeOfDecomposition<ValueType>);
+            }
+
+            void GraphAnalysisCache::clear() {
+                std::lock_guard<std::mutex> lock(mutex);
+                positions.clear();
+                entries.clear();
+                size = 0;
+                numberOfHits = 0;
+                numberOfMisses = 0;
+            }
+
+            uint64_t GraphAnalysisCache::getSize() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return size;
+            }
+
+            uint64_t GraphAnalysisCache::getNumberOfHits() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return numberOfHits;
+            }
+
+            uint64_t GraphAnalysisCache::getNumberOfMisses() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return numberOfMisses;
+            }
+
+            template std::shared_ptr<storm::storage::SparseMatrix<double> const> GraphAnalysisCache::getBackwardTransitions(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01Max(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01Min(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<double> const> GraphAnalysisCache::getMaximalEndComponentDecomposition(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& states);
+#ifdef STORM_HAVE_CARL
+            template std::shared_ptr<storm::storage::SparseMatrix<storm::RationalNumber> const> GraphAnalysisCache::getBackwardTransitions(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01Max(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01Min(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<storm::RationalNumber> const> GraphAnalysisCache::getMaximalEndComponentDecomposition(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
+
+            template std::shared_ptr<storm::storage::SparseMatrix<storm::RationalFunction> const> GraphAnalysisCache::getBackwardTransitions(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01Max(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> GraphAnalysisCache::performProb01Min(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            template std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<storm::RationalFunction> const> GraphAnalysisCache::getMaximalEndComponentDecomposition(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
+#endif
+        }
+    }
+}
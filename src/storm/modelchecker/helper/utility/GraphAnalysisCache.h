@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+
+namespace storm {
+    class Environment;
+
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * A cache for the results of graph analyses on the transition matrix of a model. Every sparse model owns one
+             * such cache, so properties that are checked on the same model with the same sub-formula results can reuse
+             * the results. Besides the qualitative analyses and end components, the cache keeps the backward transitions
+             * of the matrix. Results are identified by the kind of analysis and the input state sets. Requests on any
+             * other matrix than the one the cache belongs to are computed directly and are not cached.
+             * The cache respects the memory budget given by the environment and evicts the least recently used results
+             * first. If the budget is zero, all analyses are computed directly.
+             *
+             * All methods are thread-safe. The analyses themselves are performed without holding the lock, i.e.,
+             * concurrent requests for the same result may compute it more than once.
+             */
+            class GraphAnalysisCache {
+            public:
+                /*!
+                 * Creates an empty cache for results on the given matrix. The matrix is only identified by its address.
+                 */
+                template<typename ValueType>
+                explicit GraphAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) : transitionMatrix(&transitionMatrix), size(0), numberOfHits(0), numberOfMisses(0) {
+                    // Intentionally left empty.
+                }
+
+                GraphAnalysisCache(GraphAnalysisCache const&) = delete;
+                GraphAnalysisCache& operator=(GraphAnalysisCache const&) = delete;
+
+                /*!
+                 * Retrieves the backward transitions of the given matrix (see SparseMatrix::transpose).
+                 */
+                template<typename ValueType>
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+                /*!
+                 * Computes the states of a deterministic model that satisfy phi until psi with probability 0 and 1,
+                 * respectively (see storm::utility::graph::performProb01).
+                 */
+                template<typename ValueType>
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Computes the states of a nondeterministic model that satisfy phi until psi with probability 0 and 1,
+                 * respectively, when maximizing (see storm::utility::graph::performProb01Max).
+                 */
+                template<typename ValueType>
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Computes the states of a nondeterministic model that satisfy phi until psi with probability 0 and 1,
+                 * respectively, when minimizing (see storm::utility::graph::performProb01Min).
+                 */
+                template<typename ValueType>
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Retrieves the maximal end components of the sub-model induced by the given states.
+                 */
+                template<typename ValueType>
+                std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> getMaximalEndComponentDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+
+                /*!
+                 * Removes all results from the cache and resets the statistics.
+                 */
+                void clear();
+
+                /*!
+                 * Retrieves the (estimated) number of bytes occupied by the cached results.
+                 */
+                uint64_t getSize() const;
+
+                /*!
+                 * Retrieves the number of requests that could (not) be answered from the cache.
+                 */
+                uint64_t getNumberOfHits() const;
+                uint64_t getNumberOfMisses() const;
+
+            private:
+                enum class AnalysisType {
+                    BackwardTransitions, Prob01, Prob01Max, Prob01Min, MaximalEndComponents
+                };
+
+                struct Key {
+                    bool operator==(Key const& other) const;
+
+                    AnalysisType type;
+                    std::vector<storm::storage::BitVector> stateSets;
+                };
+
+                struct KeyHash {
+                    std::size_t operator()(Key const& key) const;
+                };
+
+                struct Entry {
+                    Key key;
+                    std::shared_ptr<void const> value;
+                    uint64_t size;
+                };
+
+                /*!
+                 * Looks up the result of the given analysis. If it is not present, the result is computed and inserted,
+                 * provided that it fits into the budget given by the environment.
+                 */
+                template<typename ResultType, typename ValueType>
+                std::shared_ptr<ResultType const> getOrCompute(Environment const& env, AnalysisType type, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<storm::storage::BitVector>&& stateSets, std::function<ResultType()> const& compute, std::function<uint64_t(ResultType const&)> const& getSizeOfResult);
+
+                void evict(uint64_t budget);
+
+                // The matrix whose results are cached.
+                void const* transitionMatrix;
+
+                mutable std::mutex mutex;
+
+                // The cached results, ordered from the most recently to the least recently used one.
+                std::list<Entry> entries;
+                std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> positions;
+                uint64_t size;
+                uint64_t numberOfHits;
+                uint64_t numberOfMisses;
+            };
+
+        }
+    }
+}
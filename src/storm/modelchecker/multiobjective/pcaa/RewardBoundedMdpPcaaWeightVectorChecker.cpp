@@ -1,6 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/RewardBoundedMdpPcaaWeightVectorChecker.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -23,6 +24,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/io/export.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 
@@ -58,8 +60,7 @@ namespace storm {
                     STORM_PRINT_AND_LOG("           #checked epochs overall: " << numCheckedEpochs << "." << std::endl);
                     STORM_PRINT_AND_LOG("# checked epochs per weight vector: " << numCheckedEpochs / numChecks << "." << std::endl);
                     STORM_PRINT_AND_LOG("                      overall Time: " <<  swAll << "." << std::endl);
-                    STORM_PRINT_AND_LOG("         Epoch Model building time: "  << swEpochModelBuild << "." << std::endl);
-                    STORM_PRINT_AND_LOG("         Epoch Model checking time: "  << swEpochModelAnalysis << "." << std::endl);
+                    STORM_PRINT_AND_LOG("Epoch Model building and checking time: "  << swEpochModelAnalysis << "." << std::endl);
                     STORM_PRINT_AND_LOG("--------------------------------------------------" << std::endl);
                 }
             }
@@ -73,18 +74,26 @@ namespace storm {
                 std::vector<std::vector<ValueType>> cdfData;
                 
                 auto initEpoch = rewardUnfolding.getStartEpoch();
-                auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
-                EpochCheckingData cachedData;
+                auto epochLayers = rewardUnfolding.getEpochComputationLayers(initEpoch);
+                uint64_t numEpochs = 0;
+                for (auto const& layer : epochLayers) {
+                    numEpochs += layer.size();
+                }
+                uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfEpochThreads());
+                std::vector<EpochCheckingData> cachedData(numberOfThreads);
                 ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
                 Environment newEnv = env;
                 newEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
                 newEnv.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
                 storm::utility::ProgressMeasurement progress("epochs");
-                progress.setMaxCount(epochOrder.size());
+                progress.setMaxCount(numEpochs);
                 progress.startNewMeasurement(0);
-                uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    computeEpochSolution(newEnv, epoch, weightVector, cachedData);
+                uint64_t numCheckedEpochsOfWeightVector = 0;
+                swEpochModelAnalysis.start();
+                rewardUnfolding.analyzeEpochs(epochLayers, numberOfThreads, [&] (uint64_t threadIndex, typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const&, helper::rewardbounded::EpochModel<ValueType, false>& epochModel) {
+                    return computeEpochSolution(newEnv, epochModel, weightVector, cachedData[threadIndex]);
+                }, [&] (typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch) {
+                    ++numCheckedEpochs;
                     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                         std::vector<ValueType> cdfEntry;
                         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
@@ -97,12 +106,11 @@ namespace storm {
                         cdfEntry.insert(cdfEntry.end(), solutionIt, solution.end());
                         cdfData.push_back(std::move(cdfEntry));
                     }
-                    ++numCheckedEpochs;
-                    progress.updateProgress(numCheckedEpochs);
-                    if (storm::utility::resources::isTerminate()) {
-                        break;
-                    }
-                }
+                    ++numCheckedEpochsOfWeightVector;
+                    progress.updateProgress(numCheckedEpochsOfWeightVector);
+                    return !storm::utility::resources::isTerminate();
+                });
+                swEpochModelAnalysis.stop();
                 
                 if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
                     std::vector<std::string> headers;
@@ -123,13 +131,7 @@ namespace storm {
             }
             
             template <class SparseMdpModelType>
-            void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSolution(Environment const& env, typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch, std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData) {
-                
-                ++numCheckedEpochs;
-                swEpochModelBuild.start();
-                auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                swEpochModelBuild.stop();
-                swEpochModelAnalysis.start();
+            std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<typename SparseMdpModelType::ValueType, false>::SolutionType> RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSolution(Environment const& env, helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData) {
                 std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> result;
                 result.reserve(epochModel.epochInStates.getNumberOfSetBits());
                 uint64_t solutionSize = this->objectives.size() + 1;
@@ -307,8 +309,7 @@ namespace storm {
                         }
                     }
                 }
-                rewardUnfolding.setSolutionForCurrentEpoch(std::move(result));
-                swEpochModelAnalysis.stop();
+                return result;
             }
 
             template <class SparseMdpModelType>
@@ -62,11 +62,14 @@ namespace storm {
                     std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> solutions;
                 };
                 
-                void computeEpochSolution(Environment const& env, typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch, std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData);
+                /*!
+                 * Computes the solution of the given epoch model. As each thread uses its own cached data, this can be called concurrently.
+                 */
+                std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> computeEpochSolution(Environment const& env, helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData);
                 
                 void updateCachedData(Environment const& env, typename helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, EpochCheckingData& cachedData, std::vector<ValueType> const& weightVector);
                 
-                storm::utility::Stopwatch swAll, swEpochModelBuild, swEpochModelAnalysis;
+                storm::utility::Stopwatch swAll, swEpochModelAnalysis;
                 uint64_t numCheckedEpochs, numChecks;
                 
                 helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false> rewardUnfolding;
@@ -1,6 +1,7 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/modelchecker/helper/utility/GraphAnalysisCache.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -18,6 +19,7 @@
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -29,6 +31,7 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 #include "storm/io/export.h"
 
 #include "storm/utility/macros.h"
@@ -53,7 +56,7 @@ namespace storm {
             
             template<typename ValueType, typename RewardModelType>
             std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeRewardBoundedValues(Environment const& env, storm::models::sparse::Dtmc<ValueType> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula) {
-                storm::utility::Stopwatch swAll(true), swBuild, swCheck;
+                storm::utility::Stopwatch swAll(true), swCheck;
                 
                 storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, rewardBoundedFormula);
                 
@@ -63,11 +66,16 @@ namespace storm {
                 
                 // Initialize epoch models
                 auto initEpoch = rewardUnfolding.getStartEpoch();
-                auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+                auto epochLayers = rewardUnfolding.getEpochComputationLayers(initEpoch);
+                uint64_t numEpochs = 0;
+                for (auto const& layer : epochLayers) {
+                    numEpochs += layer.size();
+                }
                 
-                // initialize data that will be needed for each epoch
-                std::vector<ValueType> x, b;
-                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
+                // initialize data that will be needed for each epoch (one copy per thread)
+                uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfEpochThreads());
+                std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+                std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolver(numberOfThreads);
 
                 Environment preciseEnv = env;
                 ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
@@ -81,15 +89,13 @@ namespace storm {
                 rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(preciseEnv));
 
                 storm::utility::ProgressMeasurement progress("epochs");
-                progress.setMaxCount(epochOrder.size());
+                progress.setMaxCount(numEpochs);
                 progress.startNewMeasurement(0);
                 uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    swBuild.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    swBuild.stop(); swCheck.start();
-                    rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-                    swCheck.stop();
+                swCheck.start();
+                rewardUnfolding.analyzeEpochs(epochLayers, numberOfThreads, [&] (uint64_t threadIndex, typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const&, rewardbounded::EpochModel<ValueType, true>& epochModel) {
+                    return epochModel.analyzeSingleObjective(preciseEnv, x[threadIndex], b[threadIndex], linEqSolver[threadIndex], lowerBound, upperBound);
+                }, [&] (typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
                     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                         std::vector<ValueType> cdfEntry;
                         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
@@ -101,10 +107,9 @@ namespace storm {
                     }
                     ++numCheckedEpochs;
                     progress.updateProgress(numCheckedEpochs);
-                    if (storm::utility::resources::isTerminate()) {
-                        break;
-                    }
-                }
+                    return !storm::utility::resources::isTerminate();
+                });
+                swCheck.stop();
                 
                 std::map<storm::storage::sparse::state_type, ValueType> result;
                 for (auto initState : model.getInitialStates()) {
@@ -126,10 +131,9 @@ namespace storm {
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
                     STORM_PRINT_AND_LOG("Statistics:" << std::endl);
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
-                    STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << "." << std::endl);
-                    STORM_PRINT_AND_LOG("             overall Time: " << swAll << "." << std::endl);
-                    STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << "." << std::endl);
-                    STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << "." << std::endl);
+                    STORM_PRINT_AND_LOG("                       #checked epochs: " << numEpochs << "." << std::endl);
+                    STORM_PRINT_AND_LOG("                          overall Time: " << swAll << "." << std::endl);
+                    STORM_PRINT_AND_LOG("Epoch Model building and checking Time: " << swCheck << "." << std::endl);
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
                 }
                 
@@ -137,7 +141,7 @@ namespace storm {
             }
             
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint, GraphAnalysisCache* analysisCache) {
                 
                 std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
                 
@@ -164,7 +168,7 @@ namespace storm {
                     STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1 (" << maybeStates.getNumberOfSetBits() << " states remaining).");
                 } else {
                     // Get all states that have probability 0 and 1 of satisfying the until-formula.
-                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = analysisCache ? analysisCache->performProb01(env, transitionMatrix, backwardTransitions, phiStates, psiStates) : storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
                     storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
                     statesWithProbability1 = std::move(statesWithProbability01.second);
                     maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -287,9 +291,9 @@ namespace storm {
             }
 
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, GraphAnalysisCache* analysisCache) {
                 goal.oneMinus();
-                std::vector<ValueType> result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative);
+                std::vector<ValueType> result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative, ModelCheckerHint(), analysisCache);
                 for (auto& entry : result) {
                     entry = storm::utility::one<ValueType>() - entry;
                 }
@@ -7,6 +7,7 @@
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
+#include "storm/modelchecker/helper/utility/GraphAnalysisCache.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -35,9 +36,11 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/io/export.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidStateException.h"
@@ -55,7 +58,7 @@ namespace storm {
             
             template<typename ValueType>
             std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<ValueType>::computeRewardBoundedValues(Environment const& env, OptimizationDirection dir, rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding, storm::storage::BitVector const& initialStates) {
-                storm::utility::Stopwatch swAll(true), swBuild, swCheck;
+                storm::utility::Stopwatch swAll(true), swCheck;
                 
                 // Get lower and upper bounds for the solution.
                 auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
@@ -63,11 +66,16 @@ namespace storm {
                 
                 // Initialize epoch models
                 auto initEpoch = rewardUnfolding.getStartEpoch();
-                auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+                auto epochLayers = rewardUnfolding.getEpochComputationLayers(initEpoch);
+                uint64_t numEpochs = 0;
+                for (auto const& layer : epochLayers) {
+                    numEpochs += layer.size();
+                }
                 
-                // initialize data that will be needed for each epoch
-                std::vector<ValueType> x, b;
-                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
+                // initialize data that will be needed for each epoch (one copy per thread)
+                uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.modelchecker().getNumberOfEpochThreads());
+                std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+                std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolver(numberOfThreads);
 
                 ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
                 Environment preciseEnv = env;
@@ -77,15 +85,13 @@ namespace storm {
                 std::vector<std::vector<ValueType>> cdfData;
 
                 storm::utility::ProgressMeasurement progress("epochs");
-                progress.setMaxCount(epochOrder.size());
+                progress.setMaxCount(numEpochs);
                 progress.startNewMeasurement(0);
                 uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    swBuild.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    swBuild.stop(); swCheck.start();
-                    rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-                    swCheck.stop();
+                swCheck.start();
+                rewardUnfolding.analyzeEpochs(epochLayers, numberOfThreads, [&] (uint64_t threadIndex, typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const&, rewardbounded::EpochModel<ValueType, true>& epochModel) {
+                    return epochModel.analyzeSingleObjective(preciseEnv, dir, x[threadIndex], b[threadIndex], minMaxSolver[threadIndex], lowerBound, upperBound);
+                }, [&] (typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
                     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                         std::vector<ValueType> cdfEntry;
                         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
@@ -97,10 +103,9 @@ namespace storm {
                     }
                     ++numCheckedEpochs;
                     progress.updateProgress(numCheckedEpochs);
-                    if (storm::utility::resources::isTerminate()) {
-                        break;
-                    }
-                }
+                    return !storm::utility::resources::isTerminate();
+                });
+                swCheck.stop();
                 
                 std::map<storm::storage::sparse::state_type, ValueType> result;
                 for (auto initState : initialStates) {
@@ -123,10 +128,9 @@ namespace storm {
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
                     STORM_PRINT_AND_LOG("Statistics:" << std::endl);
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
-                    STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << "." << std::endl);
-                    STORM_PRINT_AND_LOG("             overall Time: " << swAll << "." << std::endl);
-                    STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << "." << std::endl);
-                    STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << "." << std::endl);
+                    STORM_PRINT_AND_LOG("                       #checked epochs: " << numEpochs << "." << std::endl);
+                    STORM_PRINT_AND_LOG("                          overall Time: " << swAll << "." << std::endl);
+                    STORM_PRINT_AND_LOG("Epoch Model building and checking Time: " << swCheck << "." << std::endl);
                     STORM_PRINT_AND_LOG("---------------------------------" << std::endl);
                 }
                 
@@ -474,12 +478,18 @@ namespace storm {
             }
             
             template<typename ValueType>
-            QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, GraphAnalysisCache* analysisCache) {
                 QualitativeStateSetsUntilProbabilities result;
 
                 // Get all states that have probability 0 and 1 of satisfying the until-formula.
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-                if (goal.minimize()) {
+                if (analysisCache) {
+                    if (goal.minimize()) {
+                        statesWithProbability01 = analysisCache->performProb01Min(env, transitionMatrix, backwardTransitions, phiStates, psiStates);
+                    } else {
+                        statesWithProbability01 = analysisCache->performProb01Max(env, transitionMatrix, backwardTransitions, phiStates, psiStates);
+                    }
+                } else if (goal.minimize()) {
                     statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
                 } else {
                     statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
@@ -492,11 +502,11 @@ namespace storm {
             }
             
             template<typename ValueType>
-            QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
+            QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint, GraphAnalysisCache* analysisCache) {
                 if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
                     return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
                 } else {
-                    return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+                    return computeQualitativeStateSetsUntilProbabilities(env, goal, transitionMatrix, backwardTransitions, phiStates, psiStates, analysisCache);
                 }
             }
             
@@ -544,23 +554,27 @@ namespace storm {
             }
             
             template<typename ValueType>
-            boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler) {
+            boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(Environment const& env, storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler, GraphAnalysisCache* analysisCache) {
                 
                 // Get the set of states that (under some scheduler) can stay in the set of maybestates forever
                 storm::storage::BitVector candidateStates = storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, qualitativeStateSets.maybeStates, ~qualitativeStateSets.maybeStates);
                 
                 bool doDecomposition = !candidateStates.empty();
                 
-                storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
+                std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> endComponentDecomposition;
                 if (doDecomposition) {
                     // Compute the states that are in MECs.
-                    endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+                    if (analysisCache) {
+                        endComponentDecomposition = analysisCache->getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, candidateStates);
+                    } else {
+                        endComponentDecomposition = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, backwardTransitions, candidateStates);
+                    }
                 }
                 
                 // Only do more work if there are actually end-components.
-                if (doDecomposition && !endComponentDecomposition.empty()) {
-                    STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition.size() << " EC(s).");
-                    SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr, submatrix, &b, nullptr, produceScheduler);
+                if (doDecomposition && !endComponentDecomposition->empty()) {
+                    STORM_LOG_DEBUG("Eliminating " << endComponentDecomposition->size() << " EC(s).");
+                    SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(*endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr, submatrix, &b, nullptr, produceScheduler);
                     
                     // If the solve goal has relevant values, we need to adjust them.
                     if (goal.hasRelevantValues()) {
@@ -585,7 +599,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, GraphAnalysisCache* analysisCache) {
                 STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException, "Cannot produce scheduler when performing qualitative model checking only.");
                 
                 // Prepare resulting vector.
@@ -593,7 +607,7 @@ namespace storm {
                 
                 // We need to identify the maybe states (states which have a probability for satisfying the until formula
                 // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
-                QualitativeStateSetsUntilProbabilities qualitativeStateSets = getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+                QualitativeStateSetsUntilProbabilities qualitativeStateSets = getQualitativeStateSetsUntilProbabilities(env, goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, analysisCache);
                 
                 STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, " << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 (" << qualitativeStateSets.maybeStates.getNumberOfSetBits() << " states remaining).");
                 
@@ -627,7 +641,7 @@ namespace storm {
                         // If the hint information tells us that we have to eliminate MECs, we do so now.
                         boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
                         if (hintInformation.getEliminateEndComponents()) {
-                            ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler);
+                            ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(env, goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b, produceScheduler, analysisCache);
                         } else {
                             // Otherwise, we compute the standard equations.
                             computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
@@ -668,21 +682,26 @@ namespace storm {
             }
 
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, bool useMecBasedTechnique) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, bool useMecBasedTechnique, GraphAnalysisCache* analysisCache) {
                 if (useMecBasedTechnique) {
                     // TODO: does this really work for minimizing objectives?
-                    storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, psiStates);
+                    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> mecDecomposition;
+                    if (analysisCache) {
+                        mecDecomposition = analysisCache->getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, psiStates);
+                    } else {
+                        mecDecomposition = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, backwardTransitions, psiStates);
+                    }
                     storm::storage::BitVector statesInPsiMecs(transitionMatrix.getRowGroupCount());
-                    for (auto const& mec : mecDecomposition) {
+                    for (auto const& mec : *mecDecomposition) {
                         for (auto const& stateActionsPair : mec) {
                             statesInPsiMecs.set(stateActionsPair.first, true);
                         }
                     }
                     
-                    return computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, statesInPsiMecs, qualitative, produceScheduler);
+                    return computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, statesInPsiMecs, qualitative, produceScheduler, ModelCheckerHint(), analysisCache);
                 } else {
                     goal.oneMinus();
-                    auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative, produceScheduler);
+                    auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative, produceScheduler, ModelCheckerHint(), analysisCache);
                     for (auto& element : result.values) {
                         element = storm::utility::one<ValueType>() - element;
                     }
@@ -1177,7 +1196,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditionalProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, storm::storage::BitVector const& conditionStates) {
+            std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditionalProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, storm::storage::BitVector const& conditionStates, GraphAnalysisCache* analysisCache) {
                 
                 std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
                 
@@ -1188,8 +1207,13 @@ namespace storm {
                     fixedTargetStates = targetStates;
                 } else {
                     fixedTargetStates = storm::storage::BitVector(targetStates.size());
-                    storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, ~targetStates);
-                    for (auto const& mec : mecDecomposition) {
+                    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> mecDecomposition;
+                    if (analysisCache) {
+                        mecDecomposition = analysisCache->getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, ~targetStates);
+                    } else {
+                        mecDecomposition = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, backwardTransitions, ~targetStates);
+                    }
+                    for (auto const& mec : *mecDecomposition) {
                         for (auto const& stateActionsPair : mec) {
                             fixedTargetStates.set(stateActionsPair.first);
                         }
@@ -1213,7 +1237,7 @@ namespace storm {
 
                 STORM_LOG_DEBUG("Computing probabilities to satisfy condition.");
                 std::chrono::high_resolution_clock::time_point conditionStart = std::chrono::high_resolution_clock::now();
-                std::vector<ValueType> conditionProbabilities = std::move(computeUntilProbabilities(env, OptimizationDirection::Maximize, transitionMatrix, backwardTransitions, allStates, extendedConditionStates, false, false).values);
+                std::vector<ValueType> conditionProbabilities = std::move(computeUntilProbabilities(env, OptimizationDirection::Maximize, transitionMatrix, backwardTransitions, allStates, extendedConditionStates, false, false, ModelCheckerHint(), analysisCache).values);
                 std::chrono::high_resolution_clock::time_point conditionEnd = std::chrono::high_resolution_clock::now();
                 STORM_LOG_DEBUG("Computed probabilities to satisfy for condition in " << std::chrono::duration_cast<std::chrono::milliseconds>(conditionEnd - conditionStart).count() << "ms.");
                 
@@ -1224,7 +1248,7 @@ namespace storm {
                 
                 STORM_LOG_DEBUG("Computing probabilities to reach target.");
                 std::chrono::high_resolution_clock::time_point targetStart = std::chrono::high_resolution_clock::now();
-                std::vector<ValueType> targetProbabilities = std::move(computeUntilProbabilities(env, OptimizationDirection::Maximize, transitionMatrix, backwardTransitions, allStates, fixedTargetStates, false, false).values);
+                std::vector<ValueType> targetProbabilities = std::move(computeUntilProbabilities(env, OptimizationDirection::Maximize, transitionMatrix, backwardTransitions, allStates, fixedTargetStates, false, false, ModelCheckerHint(), analysisCache).values);
                 std::chrono::high_resolution_clock::time_point targetEnd = std::chrono::high_resolution_clock::now();
                 STORM_LOG_DEBUG("Computed probabilities to reach target in " << std::chrono::duration_cast<std::chrono::milliseconds>(targetEnd - targetStart).count() << "ms.");
 
@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <atomic>
 #include <string>
 #include <set>
 #include <functional>
@@ -15,6 +16,8 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
@@ -355,6 +358,115 @@ namespace storm {
                     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
                 }
                 
+                template<typename ValueType, bool SingleObjectiveMode>
+                std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>> MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationLayers(Epoch const& startEpoch) {
+                    std::vector<std::vector<Epoch>> layers;
+                    // The computation order groups the epochs by their class. Successors of an epoch are either of the same class or of a class
+                    // that is completed before, so the layers are assigned per class.
+                    std::map<Epoch, uint64_t> epochToLayer;
+                    uint64_t firstLayerOfClass = 0;
+                    boost::optional<Epoch> previousEpoch;
+                    for (auto const& epoch : getEpochComputationOrder(startEpoch)) {
+                        if (previousEpoch && !epochManager.compareEpochClass(epoch, previousEpoch.get())) {
+                            firstLayerOfClass = layers.size();
+                        }
+                        previousEpoch = epoch;
+                        uint64_t layer = firstLayerOfClass;
+                        for (auto const& step : possibleEpochSteps) {
+                            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+                            if (successorEpoch != epoch) {
+                                auto successorLayerIt = epochToLayer.find(successorEpoch);
+                                STORM_LOG_ASSERT(successorLayerIt != epochToLayer.end(), "Successor epoch " << epochManager.toString(successorEpoch) << " is not computed before epoch " << epochManager.toString(epoch) << ".");
+                                if (successorLayerIt->second >= firstLayerOfClass) {
+                                    layer = std::max(layer, successorLayerIt->second + 1);
+                                }
+                            }
+                        }
+                        epochToLayer.emplace(epoch, layer);
+                        if (layer == layers.size()) {
+                            layers.emplace_back();
+                        }
+                        layers[layer].push_back(epoch);
+                    }
+                    return layers;
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(std::vector<std::vector<Epoch>> const& epochLayers, uint64_t numberOfThreads, EpochAnalyzer const& analyzeEpoch, std::function<bool(Epoch const& epoch)> const& epochAnalyzed) {
+                    std::set<Epoch> scheduledEpochs;
+                    for (auto const& layer : epochLayers) {
+                        scheduledEpochs.insert(layer.begin(), layer.end());
+                    }
+                    
+                    numberOfThreads = storm::NumberTraits<ValueType>::IsExact ? 1 : storm::utility::parallel::getNumberOfThreads(numberOfThreads);
+                    std::unique_ptr<storm::utility::parallel::ThreadPool> threadPool;
+                    if (numberOfThreads > 1) {
+                        threadPool = std::make_unique<storm::utility::parallel::ThreadPool>(numberOfThreads);
+                    }
+                    // Thread 0 works on the epoch model of this object, the other threads on copies that are refreshed whenever the epoch class changes.
+                    std::vector<EpochModel<ValueType, SingleObjectiveMode>> threadEpochModels(numberOfThreads - 1);
+                    bool threadEpochModelsOutdated = true;
+                    
+                    uint64_t numberOfAnalyzedEpochs = 0;
+                    for (auto const& layer : epochLayers) {
+                        if (!currentEpoch || !epochManager.compareEpochClass(layer.front(), currentEpoch.get())) {
+                            setCurrentEpochClass(layer.front());
+                            epochModel.epochMatrixChanged = true;
+                            threadEpochModelsOutdated = true;
+                            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                                if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
+                                    std::cout << "Epoch model for epoch " << epochManager.toString(layer.front()) <<  " is cyclic." << std::endl;
+                                }
+                            }
+                        }
+                        currentEpoch = layer.back();
+                        
+                        std::vector<std::vector<SolutionType>> layerSolutions(layer.size());
+                        auto analyzeLayer = [&] (uint64_t threadIndex, uint64_t epochIndex) {
+                            EpochModel<ValueType, SingleObjectiveMode>* threadEpochModel = &epochModel;
+                            if (threadIndex > 0) {
+                                threadEpochModel = &threadEpochModels[threadIndex - 1];
+                            }
+                            Epoch const& epoch = layer[epochIndex];
+                            STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
+                            setStepSolutions(epoch, *threadEpochModel);
+                            layerSolutions[epochIndex] = analyzeEpoch(threadIndex, epoch, *threadEpochModel);
+                            STORM_LOG_ASSERT(layerSolutions[epochIndex].size() == threadEpochModel->epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+                            threadEpochModel->epochMatrixChanged = false;
+                        };
+                        if (threadPool && layer.size() > 1) {
+                            // The copies have to be made before the threads start, as thread 0 modifies the epoch model of this object while analyzing.
+                            if (threadEpochModelsOutdated) {
+                                for (auto& threadEpochModel : threadEpochModels) {
+                                    threadEpochModel = epochModel;
+                                    threadEpochModel.epochMatrixChanged = true;
+                                }
+                                threadEpochModelsOutdated = false;
+                            }
+                            std::atomic<uint64_t> nextEpochIndex(0);
+                            threadPool->run([&] (uint64_t threadIndex) {
+                                for (uint64_t epochIndex = nextEpochIndex++; epochIndex < layer.size(); epochIndex = nextEpochIndex++) {
+                                    analyzeLayer(threadIndex, epochIndex);
+                                }
+                            });
+                        } else {
+                            for (uint64_t epochIndex = 0; epochIndex < layer.size(); ++epochIndex) {
+                                analyzeLayer(0, epochIndex);
+                            }
+                        }
+                        
+                        // The epochs of a layer do not depend on each other, so storing a solution never discards a solution of the same layer.
+                        for (uint64_t epochIndex = 0; epochIndex < layer.size(); ++epochIndex) {
+                            storeEpochSolution(layer[epochIndex], std::move(layerSolutions[epochIndex]), &scheduledEpochs);
+                            ++numberOfAnalyzedEpochs;
+                            if (!epochAnalyzed(layer[epochIndex])) {
+                                return numberOfAnalyzedEpochs;
+                            }
+                        }
+                    }
+                    return numberOfAnalyzedEpochs;
+                }
+                
                 template<typename ValueType, bool SingleObjectiveMode>
                 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
                     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
@@ -372,6 +484,35 @@ namespace storm {
                         epochModel.epochMatrixChanged = false;
                     }
                     
+                    setStepSolutions(epoch, epochModel);
+                    
+                    assert(epochModel.objectiveRewards.size() == objectives.size());
+                    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
+                    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
+                    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
+                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
+                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
+                    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
+                    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+                    
+                    currentEpoch = epoch;
+                    /*
+                    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << std::endl;
+                    std::cout << "Matrix: " << std::endl << epochModel.epochMatrix << std::endl;
+                    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << std::endl;
+                    std::cout << "steps: " << epochModel.stepChoices << std::endl;
+                    std::cout << "step solutions: ";
+                    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
+                        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+                    }
+                    std::cout << std::endl;
+                    */
+                    return epochModel;
+                    
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setStepSolutions(Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& targetEpochModel) const {
                     bool containsLowerBoundedObjective = false;
                     for (auto const& dimension : dimensions) {
                         if (dimension.boundType == DimensionBoundType::LowerBound) {
@@ -388,9 +529,9 @@ namespace storm {
                             subSolutions.emplace(successorEpoch, &successorSolIt->second);
                         }
                     }
-                    epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
-                    auto stepSolIt = epochModel.stepSolutions.begin();
-                    for (auto reducedChoice : epochModel.stepChoices) {
+                    targetEpochModel.stepSolutions.resize(targetEpochModel.stepChoices.getNumberOfSetBits());
+                    auto stepSolIt = targetEpochModel.stepSolutions.begin();
+                    for (auto reducedChoice : targetEpochModel.stepChoices) {
                         uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
                         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
                         auto const& memoryState = productModel->getMemoryState(productState);
@@ -401,7 +542,7 @@ namespace storm {
                         // a) there is an upper bounded subObjective that is __still_relevant__ but the corresponding reward bound is passed after taking the choice
                         // b) there is a lower bounded subObjective and the corresponding reward bound is not passed yet.
                         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-                            bool rewardEarned = !storm::utility::isZero(epochModel.objectiveRewards[objIndex][reducedChoice]);
+                            bool rewardEarned = !storm::utility::isZero(targetEpochModel.objectiveRewards[objIndex][reducedChoice]);
                             if (rewardEarned) {
                                 for (auto dim : objectiveDimensions[objIndex]) {
                                     if ((dimensions[dim].boundType == DimensionBoundType::UpperBound) == epochManager.isBottomDimension(successorEpoch, dim) && productModel->getMemoryStateManager().isRelevantDimension(memoryState, dim)) {
@@ -410,7 +551,7 @@ namespace storm {
                                     }
                                 }
                             }
-                            epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
+                            targetEpochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
                         }
                         // compute the solution for the stepChoices
                         // For optimization purposes, we distinguish the case where the memory state does not have to be transformed
@@ -442,30 +583,6 @@ namespace storm {
                         *stepSolIt = std::move(choiceSolution);
                         ++stepSolIt;
                     }
-                    
-                    assert(epochModel.objectiveRewards.size() == objectives.size());
-                    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-                    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-                    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-                    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-                    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
-                    
-                    currentEpoch = epoch;
-                    /*
-                    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << std::endl;
-                    std::cout << "Matrix: " << std::endl << epochModel.epochMatrix << std::endl;
-                    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << std::endl;
-                    std::cout << "steps: " << epochModel.stepChoices << std::endl;
-                    std::cout << "step solutions: ";
-                    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-                        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
-                    }
-                    std::cout << std::endl;
-                    */
-                    return epochModel;
-                    
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
@@ -804,13 +921,18 @@ namespace storm {
                     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
                     STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
     
+                    storeEpochSolution(currentEpoch.get(), std::move(inStateSolutions), nullptr);
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::storeEpochSolution(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions, std::set<Epoch> const* scheduledEpochs) {
                     std::set<Epoch> predecessorEpochs, successorEpochs;
                     for (auto const& step : possibleEpochSteps) {
-                        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-                        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+                        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+                        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
                     }
-                    predecessorEpochs.erase(currentEpoch.get());
-                    successorEpochs.erase(currentEpoch.get());
+                    predecessorEpochs.erase(epoch);
+                    successorEpochs.erase(epoch);
                     
                     // clean up solutions that are not needed anymore
                     for (auto const& successorEpoch : successorEpochs) {
@@ -824,28 +946,38 @@ namespace storm {
                     
                     // add the new solution
                     EpochSolution solution;
-                    solution.count = predecessorEpochs.size();
+                    if (scheduledEpochs) {
+                        // Predecessors that are not scheduled will never access this solution.
+                        solution.count = 0;
+                        for (auto const& predecessorEpoch : predecessorEpochs) {
+                            if (scheduledEpochs->count(predecessorEpoch) > 0) {
+                                ++solution.count;
+                            }
+                        }
+                    } else {
+                        solution.count = predecessorEpochs.size();
+                    }
                     solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
                     solution.solutions = std::move(inStateSolutions);
-                    epochSolutions[currentEpoch.get()] = std::move(solution);
+                    epochSolutions[epoch] = std::move(solution);
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) const {
                     auto epochSolutionIt = epochSolutions.find(epoch);
                     STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
                     return getStateSolution(epochSolutionIt->second, productState);
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const {
                     auto epochSolutionIt = solutions.find(epoch);
                     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
                     return *epochSolutionIt->second;
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const {
                     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
                     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(), "Requested solution for epoch at product state " << productState << " for which no solution was stored.");
                     return epochSolution.solutions[(*epochSolution.productStateToSolutionVectorMap)[productState]];
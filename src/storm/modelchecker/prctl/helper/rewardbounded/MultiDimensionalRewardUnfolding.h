@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/BitVector.h"
@@ -60,6 +62,32 @@ namespace storm {
                      */
                     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
                     
+                    /*!
+                     * Groups the epochs that need to be analyzed to get a result at the start epoch into layers. All epochs of a layer belong to the same
+                     * epoch class and only depend on epochs of previous layers, i.e., they can be analyzed independently of each other. Consecutive layers
+                     * of the same epoch class share the epoch model structure, so the epoch class changes as rarely as in getEpochComputationOrder.
+                     */
+                    std::vector<std::vector<Epoch>> getEpochComputationLayers(Epoch const& startEpoch);
+                    
+                    typedef std::function<std::vector<SolutionType>(uint64_t threadIndex, Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& epochModel)> EpochAnalyzer;
+                    
+                    /*!
+                     * Analyzes the given epochs layer by layer. The epochs of a layer are distributed among the given number of threads, each of which
+                     * works on its own copy of the epoch model. The solution of an epoch is discarded as soon as all given epochs that depend on it have
+                     * been analyzed. Hence, afterwards only the solution of the start epoch is guaranteed to be available.
+                     *
+                     * @param epochLayers The layers as computed by getEpochComputationLayers.
+                     * @param numberOfThreads The number of threads, where zero refers to the number of hardware threads. Epochs are analyzed
+                     * sequentially for exact value types.
+                     * @param analyzeEpoch Computes the solutions at the in-states of the given epoch model. It is called concurrently with different
+                     * thread indices (from {0, ..., numberOfThreads-1}), and the epochMatrixChanged flag of the model refers to the previous call with the
+                     * same thread index.
+                     * @param epochAnalyzed Is called sequentially (in an order that respects the dependencies) after the solution for the given epoch has
+                     * been stored. If it returns false, the analysis is aborted.
+                     * @return The number of analyzed epochs.
+                     */
+                    uint64_t analyzeEpochs(std::vector<std::vector<Epoch>> const& epochLayers, uint64_t numberOfThreads, EpochAnalyzer const& analyzeEpoch, std::function<bool(Epoch const& epoch)> const& epochAnalyzed);
+                    
                     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
                     
                     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
@@ -85,6 +113,19 @@ namespace storm {
                 private:
                 
                     void setCurrentEpochClass(Epoch const& epoch);
+                    
+                    /*!
+                     * Sets the step solutions and the objective reward filter of the given model (of the current epoch class) for the given epoch.
+                     * This only reads the stored epoch solutions and can thus be called concurrently.
+                     */
+                    void setStepSolutions(Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& targetEpochModel) const;
+                    
+                    /*!
+                     * Stores the solution of the given epoch (of the current epoch class) and discards the solutions that are not needed anymore.
+                     * @param scheduledEpochs if given, only predecessor epochs within this set are expected to access the solution. Otherwise, all
+                     * predecessor epochs are considered.
+                     */
+                    void storeEpochSolution(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions, std::set<Epoch> const* scheduledEpochs);
                     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
                     
                     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -116,15 +157,15 @@ namespace storm {
                     template<bool SO = SingleObjectiveMode, typename std::enable_if<!SO, int>::type = 0>
                     std::string solutionToString(SolutionType const& solution) const;
                     
-                    SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
+                    SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState) const;
                     struct EpochSolution {
                         uint64_t count;
                         std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
                         std::vector<SolutionType> solutions;
                     };
                     std::map<Epoch, EpochSolution> epochSolutions;
-                    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-                    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+                    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+                    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
                     
                     storm::models::sparse::Model<ValueType> const& model;
                     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace storm {
+    namespace modelchecker {
+        
+        /*!
+         * The methods to decide whether a probability meets a bound based on sampled paths.
+         */
+        enum class HypothesisTestMethod {
+            Sprt, /// Wald's sequential probability ratio test, which stops as soon as the sampled paths are conclusive
+            Chernoff /// Estimates the probability with a number of paths determined by the Chernoff-Hoeffding bound and compares the estimate with the bound
+        };
+    }
+}
@@ -0,0 +1,356 @@
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/helper/utility/GraphAnalysisCache.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/SignalHandler.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        namespace {
+            /*!
+             * Derives the seed of the random number stream of the given batch (using the finalizer of splitmix64).
+             */
+            uint64_t getBatchSeed(uint64_t seed, uint64_t batch) {
+                uint64_t z = seed + (batch + 1) * 0x9e3779b97f4a7c15ull;
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+                return z ^ (z >> 31);
+            }
+
+            /*!
+             * The number of paths such that the relative frequency of satisfying paths differs from the actual probability by
+             * at most the given precision with the given error probability (Chernoff-Hoeffding bound).
+             */
+            uint64_t getChernoffNumberOfPaths(double errorProbability, double precision) {
+                return static_cast<uint64_t>(std::ceil(std::log(2.0 / errorProbability) / (2.0 * precision * precision)));
+            }
+
+            /*!
+             * Wald's sequential probability ratio test for the hypotheses p >= threshold + indifference and p <= threshold - indifference.
+             * The probabilities of errors of the first and second kind are both the given error probability.
+             */
+            class SequentialProbabilityRatioTest {
+            public:
+                SequentialProbabilityRatioTest(double threshold, double indifference, double errorProbability) {
+                    double p0 = std::min(threshold + indifference, 1.0);
+                    double p1 = std::max(threshold - indifference, 0.0);
+                    logSuccessRatio = std::log(p1 / p0);
+                    logFailureRatio = std::log((1.0 - p1) / (1.0 - p0));
+                    logUpperThreshold = std::log((1.0 - errorProbability) / errorProbability);
+                    logLowerThreshold = std::log(errorProbability / (1.0 - errorProbability));
+                }
+
+                /*!
+                 * Evaluates the test for the given numbers of paths.
+                 *
+                 * @return +1 if the probability is above the threshold, -1 if it is below and 0 if more paths are needed.
+                 */
+                int evaluate(uint64_t numberOfPaths, uint64_t numberOfSatisfyingPaths) const {
+                    // Terms with zero occurrences are skipped as the ratios might be infinite.
+                    double logLikelihoodRatio = 0.0;
+                    if (numberOfSatisfyingPaths > 0) {
+                        logLikelihoodRatio += numberOfSatisfyingPaths * logSuccessRatio;
+                    }
+                    if (numberOfPaths > numberOfSatisfyingPaths) {
+                        logLikelihoodRatio += (numberOfPaths - numberOfSatisfyingPaths) * logFailureRatio;
+                    }
+                    if (logLikelihoodRatio <= logLowerThreshold) {
+                        return 1;
+                    } else if (logLikelihoodRatio >= logUpperThreshold) {
+                        return -1;
+                    }
+                    return 0;
+                }
+
+            private:
+                double logSuccessRatio;
+                double logFailureRatio;
+                double logUpperThreshold;
+                double logLowerThreshold;
+            };
+        }
+
+        template<typename SparseModelType>
+        SparseStatisticalModelChecker<SparseModelType>::SparseStatisticalModelChecker(SparseModelType const& model, std::shared_ptr<storm::storage::Scheduler<ValueType>> const& scheduler) : SparsePropositionalModelChecker<SparseModelType>(model) {
+            if (scheduler) {
+                STORM_LOG_THROW(scheduler->isMemorylessScheduler() && scheduler->isDeterministicScheduler(), storm::exceptions::NotSupportedException, "The statistical model checker only supports memoryless deterministic schedulers.");
+                schedulerChoices.reserve(model.getNumberOfStates());
+                for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+                    auto const& choice = scheduler->getChoice(state);
+                    schedulerChoices.push_back(choice.isDefined() ? choice.getDeterministicChoice() : 0);
+                }
+            } else {
+                STORM_LOG_WARN_COND(model.getTransitionMatrix().hasTrivialRowGrouping(), "No scheduler given for the statistical model checker. The nondeterminism is resolved uniformly at random.");
+            }
+        }
+
+        template<typename SparseModelType>
+        bool SparseStatisticalModelChecker<SparseModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            if (formula.isInFragment(storm::logic::propositional())) {
+                return true;
+            }
+            storm::logic::FragmentSpecification fragment = storm::logic::reachability();
+            fragment.setNextFormulasAllowed(true).setBoundedUntilFormulasAllowed(true).setStepBoundedUntilFormulasAllowed(true);
+            return checkTask.isOnlyInitialStatesRelevantSet() && formula.isInFragment(fragment);
+        }
+
+        template<typename SparseModelType>
+        bool SparseStatisticalModelChecker<SparseModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+            if (checkTask.getFormula().isInFragment(storm::logic::propositional())) {
+                return true;
+            }
+            return canHandleStatic(checkTask) && this->getModel().getInitialStates().getNumberOfSetBits() == 1;
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::checkProbabilityOperatorFormula(Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+            STORM_LOG_WARN_COND(!checkTask.isOptimizationDirectionSet() || this->getModel().getTransitionMatrix().hasTrivialRowGrouping(), "The statistical model checker ignores the optimization direction.");
+            if (!checkTask.isBoundSet()) {
+                return computeProbabilitiesBySampling(env, checkTask.getFormula().getSubformula());
+            }
+
+            PathProperty property = getPathProperty(env, checkTask.getFormula().getSubformula());
+            bool isAbove = isProbabilityAbove(env, property, getSeed(env), checkTask.getBoundThreshold());
+            bool result = storm::logic::isLowerBound(checkTask.getBoundComparisonType()) ? isAbove : !isAbove;
+            ExplicitQualitativeCheckResult::map_type resultMap;
+            resultMap[*this->getModel().getInitialStates().begin()] = result;
+            return std::unique_ptr<CheckResult>(new ExplicitQualitativeCheckResult(std::move(resultMap)));
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+            return computeProbabilitiesBySampling(env, checkTask.getFormula());
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::computeNextProbabilities(Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
+            return computeProbabilitiesBySampling(env, checkTask.getFormula());
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+            return computeProbabilitiesBySampling(env, checkTask.getFormula());
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::computeProbabilitiesBySampling(Environment const& env, storm::logic::Formula const& pathFormula) {
+            PathProperty property = getPathProperty(env, pathFormula);
+            typename ExplicitQuantitativeCheckResult<ValueType>::map_type resultMap;
+            resultMap[*this->getModel().getInitialStates().begin()] = estimateProbability(env, property, getSeed(env));
+            return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(resultMap)));
+        }
+
+        template<typename SparseModelType>
+        typename SparseStatisticalModelChecker<SparseModelType>::PathProperty SparseStatisticalModelChecker<SparseModelType>::getPathProperty(Environment const& env, storm::logic::Formula const& pathFormula) {
+            STORM_LOG_THROW(this->getModel().getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException, "The statistical model checker requires a single initial state.");
+            uint64_t numberOfStates = this->getModel().getNumberOfStates();
+            PathProperty property;
+            property.lowerBound = 0;
+            property.upperBound = std::numeric_limits<uint64_t>::max();
+
+            // Next formulas are treated as true U[1,1] psi.
+            storm::logic::Formula const* phiFormula = nullptr;
+            storm::logic::Formula const* psiFormula = nullptr;
+            if (pathFormula.isNextFormula()) {
+                psiFormula = &pathFormula.asNextFormula().getSubformula();
+                property.lowerBound = 1;
+                property.upperBound = 1;
+            } else if (pathFormula.isUntilFormula()) {
+                phiFormula = &pathFormula.asUntilFormula().getLeftSubformula();
+                psiFormula = &pathFormula.asUntilFormula().getRightSubformula();
+            } else if (pathFormula.isEventuallyFormula()) {
+                psiFormula = &pathFormula.asEventuallyFormula().getSubformula();
+            } else if (pathFormula.isBoundedUntilFormula()) {
+                storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+                STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && boundedUntilFormula.getTimeBoundReference().isTimeBound(), storm::exceptions::NotSupportedException, "The statistical model checker only supports step bounded until formulas.");
+                STORM_LOG_THROW(!boundedUntilFormula.hasLowerBound() || boundedUntilFormula.hasIntegerLowerBound(), storm::exceptions::InvalidPropertyException, "Formula lower step bound must be discrete/integral.");
+                STORM_LOG_THROW(!boundedUntilFormula.hasUpperBound() || boundedUntilFormula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException, "Formula upper step bound must be discrete/integral.");
+                phiFormula = &boundedUntilFormula.getLeftSubformula();
+                psiFormula = &boundedUntilFormula.getRightSubformula();
+                if (boundedUntilFormula.hasLowerBound()) {
+                    property.lowerBound = boundedUntilFormula.template getNonStrictLowerBound<uint64_t>();
+                }
+                if (boundedUntilFormula.hasUpperBound()) {
+                    property.upperBound = boundedUntilFormula.template getNonStrictUpperBound<uint64_t>();
+                }
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The statistical model checker does not support the formula " << pathFormula << ".");
+            }
+
+            if (phiFormula) {
+                property.phiStates = this->check(env, *phiFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                property.phiStates = storm::storage::BitVector(numberOfStates, true);
+            }
+            property.psiStates = this->check(env, *psiFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+
+            // Paths can be stopped early in states from which the outcome is already determined.
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> prob01;
+            if (schedulerChoices.empty()) {
+                prob01 = this->getModel().getGraphAnalysisCache().performProb01(env, this->getModel().getTransitionMatrix(), *this->getModel().getGraphAnalysisCache().getBackwardTransitions(env, this->getModel().getTransitionMatrix()), property.phiStates, property.psiStates);
+            } else {
+                prob01 = storm::utility::graph::performProb01(this->getModel().getTransitionMatrix().selectRowsFromRowGroups(schedulerChoices, false).transpose(), property.phiStates, property.psiStates);
+            }
+            property.prob0States = std::move(prob01.first);
+            if (property.upperBound == std::numeric_limits<uint64_t>::max()) {
+                property.prob1States = std::move(prob01.second);
+            } else {
+                property.prob1States = storm::storage::BitVector(numberOfStates, false);
+            }
+            return property;
+        }
+
+        template<typename SparseModelType>
+        std::vector<typename SparseStatisticalModelChecker<SparseModelType>::SamplingResult> SparseStatisticalModelChecker<SparseModelType>::sampleBatches(Environment const& env, PathProperty const& property, uint64_t seed, uint64_t firstBatch, uint64_t numberOfBatches, uint64_t totalNumberOfPaths) const {
+            auto const& statisticalEnv = env.modelchecker().statistical();
+            uint64_t batchSize = statisticalEnv.getBatchSize();
+            uint64_t maximalPathLength = statisticalEnv.getMaximalPathLength();
+            bool hasNondeterminism = !this->getModel().getTransitionMatrix().hasTrivialRowGrouping();
+
+            std::vector<SamplingResult> results(numberOfBatches);
+            std::atomic<uint64_t> nextBatch(0);
+            uint64_t numberOfThreads = std::min(storm::utility::parallel::getNumberOfThreads(statisticalEnv.getNumberOfThreads()), numberOfBatches);
+            storm::utility::parallel::runOnThreads(numberOfThreads, [&] (uint64_t) {
+                storm::simulator::DiscreteTimeSparseModelSimulator<ValueType, RewardModelType> simulator(this->getModel());
+                for (uint64_t batchOffset = nextBatch++; batchOffset < numberOfBatches; batchOffset = nextBatch++) {
+                    uint64_t batch = firstBatch + batchOffset;
+                    SamplingResult& result = results[batchOffset];
+                    uint64_t firstPath = batch * batchSize;
+                    uint64_t numberOfPaths = firstPath < totalNumberOfPaths ? std::min(batchSize, totalNumberOfPaths - firstPath) : 0;
+                    simulator.setSeed(getBatchSeed(seed, batch));
+                    for (uint64_t path = 0; path < numberOfPaths; ++path) {
+                        simulator.resetToInitial();
+                        bool satisfied = false;
+                        for (uint64_t step = 0; ; ++step) {
+                            uint64_t state = simulator.getCurrentState();
+                            if (step >= property.lowerBound) {
+                                if (property.psiStates.get(state) || property.prob1States.get(state)) {
+                                    satisfied = true;
+                                    break;
+                                } else if (property.prob0States.get(state)) {
+                                    break;
+                                }
+                            }
+                            if (!property.phiStates.get(state) || step >= property.upperBound) {
+                                break;
+                            }
+                            if (step >= maximalPathLength) {
+                                ++result.numberOfTruncatedPaths;
+                                break;
+                            }
+                            bool moved;
+                            if (!schedulerChoices.empty()) {
+                                moved = simulator.step(schedulerChoices[state]);
+                            } else if (hasNondeterminism) {
+                                moved = simulator.randomStep();
+                            } else {
+                                moved = simulator.step(0);
+                            }
+                            if (!moved) {
+                                break;
+                            }
+                        }
+                        ++result.numberOfPaths;
+                        if (satisfied) {
+                            ++result.numberOfSatisfyingPaths;
+                        }
+                    }
+                }
+            });
+            return results;
+        }
+
+        template<typename SparseModelType>
+        typename SparseStatisticalModelChecker<SparseModelType>::ValueType SparseStatisticalModelChecker<SparseModelType>::estimateProbability(Environment const& env, PathProperty const& property, uint64_t seed) const {
+            auto const& statisticalEnv = env.modelchecker().statistical();
+            uint64_t numberOfPaths = getChernoffNumberOfPaths(statisticalEnv.getErrorProbability(), statisticalEnv.getPrecision());
+            uint64_t numberOfBatches = (numberOfPaths + statisticalEnv.getBatchSize() - 1) / statisticalEnv.getBatchSize();
+
+            SamplingResult total;
+            for (auto const& result : sampleBatches(env, property, seed, 0, numberOfBatches, numberOfPaths)) {
+                total.numberOfPaths += result.numberOfPaths;
+                total.numberOfSatisfyingPaths += result.numberOfSatisfyingPaths;
+                total.numberOfTruncatedPaths += result.numberOfTruncatedPaths;
+            }
+            STORM_LOG_WARN_COND(total.numberOfTruncatedPaths == 0, total.numberOfTruncatedPaths << " sampled paths exceeded the maximal path length and were considered to not satisfy the property.");
+            ValueType estimate = static_cast<ValueType>(total.numberOfSatisfyingPaths) / static_cast<ValueType>(total.numberOfPaths);
+            STORM_LOG_INFO("Sampled " << total.numberOfPaths << " paths. The probability is within [" << std::max(estimate - statisticalEnv.getPrecision(), 0.0) << ", " << std::min(estimate + statisticalEnv.getPrecision(), 1.0) << "] with probability at least " << (1.0 - statisticalEnv.getErrorProbability()) << ".");
+            return estimate;
+        }
+
+        template<typename SparseModelType>
+        bool SparseStatisticalModelChecker<SparseModelType>::isProbabilityAbove(Environment const& env, PathProperty const& property, uint64_t seed, ValueType const& threshold) const {
+            auto const& statisticalEnv = env.modelchecker().statistical();
+            if (statisticalEnv.getHypothesisTestMethod() == HypothesisTestMethod::Chernoff) {
+                uint64_t numberOfPaths = getChernoffNumberOfPaths(statisticalEnv.getErrorProbability(), statisticalEnv.getIndifference());
+                uint64_t numberOfBatches = (numberOfPaths + statisticalEnv.getBatchSize() - 1) / statisticalEnv.getBatchSize();
+                uint64_t numberOfSatisfyingPaths = 0;
+                for (auto const& result : sampleBatches(env, property, seed, 0, numberOfBatches, numberOfPaths)) {
+                    numberOfSatisfyingPaths += result.numberOfSatisfyingPaths;
+                }
+                STORM_LOG_INFO("Sampled " << numberOfPaths << " paths.");
+                return static_cast<ValueType>(numberOfSatisfyingPaths) >= threshold * numberOfPaths;
+            }
+
+            // The test is evaluated after every batch (in the order of the batches), so that the outcome does not depend on
+            // the number of threads. Each round samples as many batches as there are threads.
+            SequentialProbabilityRatioTest test(threshold, statisticalEnv.getIndifference(), statisticalEnv.getErrorProbability());
+            uint64_t batchesPerRound = storm::utility::parallel::getNumberOfThreads(statisticalEnv.getNumberOfThreads());
+            SamplingResult total;
+            for (uint64_t firstBatch = 0; ; firstBatch += batchesPerRound) {
+                for (auto const& result : sampleBatches(env, property, seed, firstBatch, batchesPerRound, std::numeric_limits<uint64_t>::max())) {
+                    total.numberOfPaths += result.numberOfPaths;
+                    total.numberOfSatisfyingPaths += result.numberOfSatisfyingPaths;
+                    total.numberOfTruncatedPaths += result.numberOfTruncatedPaths;
+                    int outcome = test.evaluate(total.numberOfPaths, total.numberOfSatisfyingPaths);
+                    if (outcome != 0) {
+                        STORM_LOG_WARN_COND(total.numberOfTruncatedPaths == 0, total.numberOfTruncatedPaths << " sampled paths exceeded the maximal path length and were considered to not satisfy the property.");
+                        STORM_LOG_INFO("Sequential probability ratio test finished after " << total.numberOfPaths << " paths (" << total.numberOfSatisfyingPaths << " satisfying).");
+                        return outcome > 0;
+                    }
+                }
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Sequential probability ratio test aborted after " << total.numberOfPaths << " paths. The result is based on the relative frequency of satisfying paths.");
+                    return static_cast<ValueType>(total.numberOfSatisfyingPaths) >= threshold * total.numberOfPaths;
+                }
+            }
+        }
+
+        template<typename SparseModelType>
+        uint64_t SparseStatisticalModelChecker<SparseModelType>::getSeed(Environment const& env) const {
+            auto const& seed = env.modelchecker().statistical().getSeed();
+            if (seed) {
+                return seed.get();
+            }
+            std::random_device device;
+            uint64_t result = (static_cast<uint64_t>(device()) << 32) | device();
+            STORM_LOG_INFO("Sampling paths with seed " << result << ".");
+            return result;
+        }
+
+        template class SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+        template class SparseStatisticalModelChecker<storm::models::sparse::Mdp<double>>;
+    }
+}
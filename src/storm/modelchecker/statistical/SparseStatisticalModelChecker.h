@@ -0,0 +1,97 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Scheduler.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * Model checker for discrete-time models that samples paths from the initial state instead of solving equation
+         * systems (statistical model checking). Probabilities are estimated such that the estimate is within the precision
+         * of the environment with the given error probability (Chernoff-Hoeffding bound). Probability operators with a bound
+         * are decided with a hypothesis test, i.e. the result is only guaranteed to be correct (with the given error
+         * probability) if the actual probability is not within the indifference region around the bound.
+         *
+         * Nondeterminism of MDPs is resolved by the given memoryless deterministic scheduler or, if no scheduler is given,
+         * uniformly at random.
+         *
+         * Paths are sampled in batches that can be processed by multiple threads. Each batch uses its own random number
+         * stream whose seed is derived from the seed of the environment and the index of the batch. Hence, the result
+         * does not depend on the number of threads.
+         */
+        template<typename SparseModelType>
+        class SparseStatisticalModelChecker : public SparsePropositionalModelChecker<SparseModelType> {
+        public:
+            typedef typename SparseModelType::ValueType ValueType;
+            typedef typename SparseModelType::RewardModelType RewardModelType;
+
+            explicit SparseStatisticalModelChecker(SparseModelType const& model, std::shared_ptr<storm::storage::Scheduler<ValueType>> const& scheduler = nullptr);
+
+            /*!
+             * Returns false, if this task can certainly not be handled by this model checker (independent of the concrete model).
+             */
+            static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+            // The implemented methods of the AbstractModelChecker interface.
+            virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+            virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeNextProbabilities(Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+
+        private:
+            /*!
+             * A path formula phi U[lowerBound, upperBound] psi together with the states from which it is decided.
+             */
+            struct PathProperty {
+                storm::storage::BitVector phiStates;
+                storm::storage::BitVector psiStates;
+                uint64_t lowerBound;
+                uint64_t upperBound;
+                // States that (once the lower bound is reached) satisfy the property with probability zero or one.
+                storm::storage::BitVector prob0States;
+                storm::storage::BitVector prob1States;
+            };
+
+            /*!
+             * The number of sampled paths and how many of them satisfy the property.
+             */
+            struct SamplingResult {
+                uint64_t numberOfPaths = 0;
+                uint64_t numberOfSatisfyingPaths = 0;
+                uint64_t numberOfTruncatedPaths = 0;
+            };
+
+            PathProperty getPathProperty(Environment const& env, storm::logic::Formula const& pathFormula);
+
+            /*!
+             * Samples the given number of batches starting from the given batch index. Batches are cut off after the given total number of paths.
+             *
+             * @return The results of the individual batches.
+             */
+            std::vector<SamplingResult> sampleBatches(Environment const& env, PathProperty const& property, uint64_t seed, uint64_t firstBatch, uint64_t numberOfBatches, uint64_t totalNumberOfPaths) const;
+
+            /*!
+             * Estimates the probability of the given property in the initial state.
+             */
+            ValueType estimateProbability(Environment const& env, PathProperty const& property, uint64_t seed) const;
+
+            /*!
+             * Decides whether the probability of the given property in the initial state is above the given threshold.
+             */
+            bool isProbabilityAbove(Environment const& env, PathProperty const& property, uint64_t seed, ValueType const& threshold) const;
+
+            uint64_t getSeed(Environment const& env) const;
+
+            std::unique_ptr<CheckResult> computeProbabilitiesBySampling(Environment const& env, storm::logic::Formula const& pathFormula);
+
+            // The scheduler choices used to resolve the nondeterminism. Empty if no scheduler is given.
+            std::vector<uint64_t> schedulerChoices;
+        };
+    }
+}
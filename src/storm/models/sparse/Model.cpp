@@ -8,6 +8,7 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/helper/utility/GraphAnalysisCache.h"
 #include "storm/utility/vector.h"
 #include "storm/io/export.h"
 #include "storm/utility/NumberTraits.h"
@@ -22,6 +23,7 @@ namespace storm {
             : storm::models::Model<ValueType>(modelType), transitionMatrix(components.transitionMatrix), stateLabeling(components.stateLabeling), rewardModels(components.rewardModels),
                       choiceLabeling(components.choiceLabeling), stateValuations(components.stateValuations), choiceOrigins(components.choiceOrigins) {
                 assertValidityOfComponents(components);
+                graphAnalysisCache = std::make_unique<storm::modelchecker::helper::GraphAnalysisCache>(transitionMatrix);
             }
             
             template <typename ValueType, typename RewardModelType>
@@ -29,6 +31,58 @@ namespace storm {
             : storm::models::Model<ValueType>(modelType), transitionMatrix(std::move(components.transitionMatrix)), stateLabeling(std::move(components.stateLabeling)), rewardModels(std::move(components.rewardModels)),
                       choiceLabeling(std::move(components.choiceLabeling)), stateValuations(std::move(components.stateValuations)), choiceOrigins(std::move(components.choiceOrigins)) {
                 assertValidityOfComponents(components);
+                graphAnalysisCache = std::make_unique<storm::modelchecker::helper::GraphAnalysisCache>(transitionMatrix);
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>::Model(Model<ValueType, RewardModelType> const& other)
+            : storm::models::Model<ValueType>(other), transitionMatrix(other.transitionMatrix), graphAnalysisCache(std::make_unique<storm::modelchecker::helper::GraphAnalysisCache>(transitionMatrix)), stateLabeling(other.stateLabeling), rewardModels(other.rewardModels),
+                      choiceLabeling(other.choiceLabeling), stateValuations(other.stateValuations), choiceOrigins(other.choiceOrigins) {
+                // Intentionally left empty.
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>& Model<ValueType, RewardModelType>::operator=(Model<ValueType, RewardModelType> const& other) {
+                if (this != &other) {
+                    storm::models::Model<ValueType>::operator=(other);
+                    transitionMatrix = other.transitionMatrix;
+                    stateLabeling = other.stateLabeling;
+                    rewardModels = other.rewardModels;
+                    choiceLabeling = other.choiceLabeling;
+                    stateValuations = other.stateValuations;
+                    choiceOrigins = other.choiceOrigins;
+                    graphAnalysisCache->clear();
+                }
+                return *this;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>::Model(Model<ValueType, RewardModelType>&& other)
+            : storm::models::Model<ValueType>(std::move(other)), transitionMatrix(std::move(other.transitionMatrix)), graphAnalysisCache(std::make_unique<storm::modelchecker::helper::GraphAnalysisCache>(transitionMatrix)), stateLabeling(std::move(other.stateLabeling)), rewardModels(std::move(other.rewardModels)),
+                      choiceLabeling(std::move(other.choiceLabeling)), stateValuations(std::move(other.stateValuations)), choiceOrigins(std::move(other.choiceOrigins)) {
+                // The results of the other model refer to its matrix, so they are not taken over.
+                other.graphAnalysisCache->clear();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>& Model<ValueType, RewardModelType>::operator=(Model<ValueType, RewardModelType>&& other) {
+                if (this != &other) {
+                    storm::models::Model<ValueType>::operator=(std::move(other));
+                    transitionMatrix = std::move(other.transitionMatrix);
+                    stateLabeling = std::move(other.stateLabeling);
+                    rewardModels = std::move(other.rewardModels);
+                    choiceLabeling = std::move(other.choiceLabeling);
+                    stateValuations = std::move(other.stateValuations);
+                    choiceOrigins = std::move(other.choiceOrigins);
+                    graphAnalysisCache->clear();
+                    other.graphAnalysisCache->clear();
+                }
+                return *this;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>::~Model() {
+                // Intentionally left empty.
             }
             
             template <typename ValueType, typename RewardModelType>
@@ -140,9 +194,16 @@ namespace storm {
             
             template<typename ValueType, typename RewardModelType>
             storm::storage::SparseMatrix<ValueType>& Model<ValueType, RewardModelType>::getTransitionMatrix() {
+                // The matrix might be modified, so the cached results are no longer valid.
+                graphAnalysisCache->clear();
                 return transitionMatrix;
             }
             
+            template<typename ValueType, typename RewardModelType>
+            storm::modelchecker::helper::GraphAnalysisCache& Model<ValueType, RewardModelType>::getGraphAnalysisCache() const {
+                return *graphAnalysisCache;
+            }
+            
             template<typename ValueType, typename RewardModelType>
             bool Model<ValueType, RewardModelType>::hasRewardModel(std::string const& rewardModelName) const {
                 return this->rewardModels.find(rewardModelName) != this->rewardModels.end();
@@ -445,11 +506,13 @@ namespace storm {
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
                 this->transitionMatrix = transitionMatrix;
+                graphAnalysisCache->clear();
             }
             
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
                 this->transitionMatrix = std::move(transitionMatrix);
+                graphAnalysisCache->clear();
             }
 
             template<typename ValueType, typename RewardModelType>
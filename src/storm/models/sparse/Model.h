@@ -1,6 +1,7 @@
 #ifndef STORM_MODELS_SPARSE_MODEL_H_
 #define STORM_MODELS_SPARSE_MODEL_H_
 
+#include <memory>
 #include <vector>
 #include <unordered_map>
 #include <boost/optional.hpp>
@@ -20,6 +21,12 @@ namespace storm {
         class BitVector;
     }
     
+    namespace modelchecker {
+        namespace helper {
+            class GraphAnalysisCache;
+        }
+    }
+    
     namespace models {
         namespace sparse {
             
@@ -35,8 +42,15 @@ namespace storm {
                 typedef CValueType ValueType;
                 typedef CRewardModelType RewardModelType;
                 
-                Model(Model<ValueType, RewardModelType> const& other) = default;
-                Model& operator=(Model<ValueType, RewardModelType> const& other) = default;
+                /*!
+                 * Copies (moves) the given model. The copy gets its own, empty graph analysis cache.
+                 */
+                Model(Model<ValueType, RewardModelType> const& other);
+                Model& operator=(Model<ValueType, RewardModelType> const& other);
+                Model(Model<ValueType, RewardModelType>&& other);
+                Model& operator=(Model<ValueType, RewardModelType>&& other);
+                
+                virtual ~Model();
                 
                 /*!
                  * Constructs a model from the given data.
@@ -120,6 +134,15 @@ namespace storm {
                  * @return A matrix representing the transitions of the model.
                  */
                 storm::storage::SparseMatrix<ValueType>& getTransitionMatrix();
+                
+                /*!
+                 * Retrieves the cache for graph analyses on the transition matrix of this model. The cached results are
+                 * dropped whenever the transition matrix is accessed for modification. Copies of the model do not use
+                 * the results of the original model.
+                 *
+                 * @return The cache for graph analyses on the transition matrix.
+                 */
+                storm::modelchecker::helper::GraphAnalysisCache& getGraphAnalysisCache() const;
 
                 
                 /*!
@@ -414,6 +437,10 @@ namespace storm {
                 //  A matrix representing transition relation.
                 storm::storage::SparseMatrix<ValueType> transitionMatrix;
                 
+                // The cache for graph analyses on the transition matrix. It is bound to the transition matrix of this
+                // object and never shared with other models.
+                std::unique_ptr<storm::modelchecker::helper::GraphAnalysisCache> graphAnalysisCache;
+                
                 // The labeling of the states.
                 storm::models::sparse::StateLabeling stateLabeling;
                 
@@ -22,6 +22,8 @@ namespace storm {
             const std::string BisimulationSettings::initialPartitionOptionName = "init";
             const std::string BisimulationSettings::refinementModeOptionName = "refine";
             const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+            const std::string BisimulationSettings::sparseRefinementModeOptionName = "sparserefine";
+            const std::string BisimulationSettings::threadsOptionName = "threads";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "strong", "weak" };
@@ -54,6 +56,15 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                              .setDefaultValueString("full").build())
                                 .build());
+                
+                std::vector<std::string> sparseRefinementModes = {"splitter", "signature"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementModeOptionName, true, "Sets how sparse bisimulation refines the partition. 'splitter' refines with respect to one splitter at a time, 'signature' splits all blocks according to the signatures of their states in parallel rounds.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementModes))
+                                             .setDefaultValueString("splitter").build())
+                                .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads used by signature-based sparse bisimulation.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means one thread per hardware thread).").setDefaultValueUnsignedInteger(0).build())
+                                .build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -135,6 +146,18 @@ namespace storm {
                 return RefinementMode::Full;
             }
 
+            BisimulationSettings::SparseRefinementMode BisimulationSettings::getSparseRefinementMode() const {
+                std::string sparseRefinementModeAsString = this->getOption(sparseRefinementModeOptionName).getArgumentByName("mode").getValueAsString();
+                if (sparseRefinementModeAsString == "signature") {
+                    return SparseRefinementMode::Signature;
+                }
+                return SparseRefinementMode::Splitter;
+            }
+            
+            uint64_t BisimulationSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
             bool BisimulationSettings::check() const {
                 bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet, "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
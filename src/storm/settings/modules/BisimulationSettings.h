@@ -24,6 +24,8 @@ namespace storm {
                 
                 enum class RefinementMode { Full, ChangedStates };
                 
+                enum class SparseRefinementMode { Splitter, Signature };
+                
                 /*!
                  * Creates a new set of bisimulation settings.
                  */
@@ -95,6 +97,18 @@ namespace storm {
                  * Retrieves the refinement mode to use.
                  */
                 RefinementMode getRefinementMode() const;
+                
+                /*!
+                 * Retrieves the refinement mode to use in sparse bisimulation.
+                 * NOTE: only applies to sparse bisimulation.
+                 */
+                SparseRefinementMode getSparseRefinementMode() const;
+                
+                /*!
+                 * Retrieves the number of threads to use in signature-based sparse bisimulation, where zero refers to
+                 * the number of hardware threads.
+                 */
+                uint64_t getNumberOfThreads() const;
                                 
                 virtual bool check() const override;
                 
@@ -113,6 +127,8 @@ namespace storm {
                 static const std::string refinementModeOptionName;
                 static const std::string parallelismModeOptionName;
                 static const std::string exactArithmeticDdOptionName;
+                static const std::string sparseRefinementModeOptionName;
+                static const std::string threadsOptionName;
             };
         } // namespace modules
     } // namespace settings
@@ -37,6 +37,8 @@ namespace storm {
             const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
             const std::string noSimplifyOptionName = "no-simplify";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
+            const std::string buildThreadsOptionName = "build-threads";
+            const std::string bytecodeExpressionsOptionName = "bytecode-expressions";
 
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
@@ -59,6 +61,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, buildThreadsOptionName, false, "Sets the number of threads used for the explicit state space exploration (breadth-first order only). The built model does not depend on this number.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means one thread per hardware thread).").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, bytecodeExpressionsOptionName, false, "If set, guards and other expressions over the state variables are compiled to bytecode that reads the variables directly from the explored states (floating point models only).").setIsAdvanced().build());
             }
 
             bool BuildSettings::isExplorationOrderSet() const {
@@ -135,6 +140,14 @@ namespace storm {
                 return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
             }
 
+            uint64_t BuildSettings::getNumberOfBuildThreads() const {
+                return this->getOption(buildThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            bool BuildSettings::isBytecodeExpressionsSet() const {
+                return this->getOption(bytecodeExpressionsOptionName).getHasOptionBeenSet();
+            }
+
         }
 
 
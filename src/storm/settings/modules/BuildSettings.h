@@ -121,6 +121,19 @@ namespace storm {
                  */
                  bool isNoSimplifySet() const;
 
+                /*!
+                 * Retrieves the number of threads that are to be used for the explicit state space exploration.
+                 * A value of zero refers to the number of available hardware threads.
+                 *
+                 * @return The number of threads.
+                 */
+                uint64_t getNumberOfBuildThreads() const;
+
+                /*!
+                 * Retrieves whether expressions are to be compiled to bytecode during the explicit state space exploration.
+                 */
+                bool isBytecodeExpressionsSet() const;
+
                 // The name of the module.
                 static const std::string moduleName;
             };
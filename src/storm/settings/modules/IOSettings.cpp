@@ -21,6 +21,7 @@ namespace storm {
             const std::string IOSettings::exportDotMaxWidthOptionName = "dot-maxwidth";
             const std::string IOSettings::exportExplicitOptionName = "exportexplicit";
             const std::string IOSettings::exportDdOptionName = "exportdd";
+            const std::string IOSettings::exportBinaryOptionName = "exportbinary";
             const std::string IOSettings::exportJaniDotOptionName = "exportjanidot";
             const std::string IOSettings::exportCdfOptionName = "exportcdf";
             const std::string IOSettings::exportCdfOptionShortName = "cdf";
@@ -30,6 +31,7 @@ namespace storm {
             const std::string IOSettings::explicitOptionShortName = "exp";
             const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
             const std::string IOSettings::explicitDrnOptionShortName = "drn";
+            const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
             const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
             const std::string IOSettings::explicitImcaOptionShortName = "imca";
             const std::string IOSettings::prismInputOptionName = "prism";
@@ -70,12 +72,17 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName,  preventDRNPlaceholderOptionName, true, "If given, the exported DRN contains no placeholders").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportDdOptionName, "", "If given, the loaded model will be written to the specified file in the drdd format.")
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportBinaryOptionName, "", "If given, the loaded model will be written to the specified file in the binary format that can be loaded with --" + explicitBinaryOptionName + ".")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "the name of the file to which the model is to be writen.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitOptionName, false, "Parses the model given in an explicit (sparse) representation.").setShortName(explicitOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("transition filename", "The name of the file from which to read the transitions.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("labeling filename", "The name of the file from which to read the state labeling.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrnOptionName, false, "Parses the model given in the DRN format.").setShortName(explicitDrnOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drn filename", "The name of the DRN file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Parses the model given in the binary format (see --" + exportBinaryOptionName + ").")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("binary filename", "The name of the binary file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
+                                .build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.").setShortName(explicitImcaOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build())
                                 .build());
@@ -150,6 +157,14 @@ namespace storm {
                 return this->getOption(preventDRNPlaceholderOptionName).getHasOptionBeenSet();
             }
 
+            bool IOSettings::isExportBinarySet() const {
+                return this->getOption(exportBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExportBinaryFilename() const {
+                return this->getOption(exportBinaryOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
             bool IOSettings::isExportDdSet() const {
                 return this->getOption(exportDdOptionName).getHasOptionBeenSet();
             }
@@ -206,6 +221,14 @@ namespace storm {
                 return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
             }
 
+            bool IOSettings::isExplicitBinarySet() const {
+                return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string IOSettings::getExplicitBinaryFilename() const {
+                return this->getOption(explicitBinaryOptionName).getArgumentByName("binary filename").getValueAsString();
+            }
+
             bool IOSettings::isExplicitIMCASet() const {
                 return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
             }
@@ -350,6 +373,7 @@ namespace storm {
                 // Ensure that not two explicit input models were given.
                 uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
                 numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+                numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
                 numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
                 STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
@@ -21,6 +21,8 @@ namespace storm {
             const std::string JitBuilderSettings::carlIncludeDirectoryOptionName = "carl";
             const std::string JitBuilderSettings::compilerFlagsOptionName = "cxxflags";
             const std::string JitBuilderSettings::optimizationLevelOptionName = "opt";
+            const std::string JitBuilderSettings::cacheDirectoryOptionName = "cache";
+            const std::string JitBuilderSettings::cacheSizeOptionName = "cache-size";
 
             JitBuilderSettings::JitBuilderSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, doctorOptionName, false, "Show debugging information on why the jit-based model builder is not working on your system.").setIsAdvanced().build());
@@ -36,6 +38,10 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("flags", "The compiler flags.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, optimizationLevelOptionName, false, "Sets the optimization level.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("level", "The level to use.").setDefaultValueUnsignedInteger(3).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheDirectoryOptionName, false, "If set, compiled model builders are stored in (and reused from) the given directory.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory of the cache.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheSizeOptionName, false, "Sets the maximal size of the cache of compiled model builders. The least recently used builders are removed first.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The maximal size in megabytes.").setDefaultValueUnsignedInteger(1024).build()).build());
             }
             
             bool JitBuilderSettings::isCompilerSet() const {
@@ -86,6 +92,18 @@ namespace storm {
                 return this->getOption(optimizationLevelOptionName).getArgumentByName("level").getValueAsUnsignedInteger();
             }
             
+            bool JitBuilderSettings::isCacheDirectorySet() const {
+                return this->getOption(cacheDirectoryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string JitBuilderSettings::getCacheDirectory() const {
+                return this->getOption(cacheDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+
+            uint64_t JitBuilderSettings::getMaximalCacheSize() const {
+                return this->getOption(cacheSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger() * 1024 * 1024;
+            }
+
             void JitBuilderSettings::finalize() {
                 // Intentionally left empty.
             }
@@ -31,6 +31,14 @@ namespace storm {
                 std::string getCompilerFlags() const;
                 
                 uint64_t getOptimizationLevel() const;
+
+                bool isCacheDirectorySet() const;
+                std::string getCacheDirectory() const;
+
+                /*!
+                 * Retrieves the maximal size (in bytes) of the cache of compiled model builders.
+                 */
+                uint64_t getMaximalCacheSize() const;
                 
                 bool check() const override;
                 void finalize() override;
@@ -45,6 +53,8 @@ namespace storm {
                 static const std::string compilerFlagsOptionName;
                 static const std::string doctorOptionName;
                 static const std::string optimizationLevelOptionName;
+                static const std::string cacheDirectoryOptionName;
+                static const std::string cacheSizeOptionName;
             };
             
         }
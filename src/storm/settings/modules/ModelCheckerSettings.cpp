@@ -7,6 +7,11 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
 
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
+#include <boost/algorithm/string.hpp>
+
 
 namespace storm {
     namespace settings {
@@ -14,15 +19,63 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::propertyThreadsOptionName = "property-threads";
+            const std::string ModelCheckerSettings::analysisCacheSizeOptionName = "analysis-cache";
+            const std::string ModelCheckerSettings::timeBoundsOptionName = "timebounds";
+            const std::string ModelCheckerSettings::epochThreadsOptionName = "epoch-threads";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, propertyThreadsOptionName, false, "Sets the number of threads used to check the properties of a model concurrently. This only affects the sparse engine. Results are reported in the order of the properties.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. Zero refers to the number of hardware threads.").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, analysisCacheSizeOptionName, false, "Sets the memory budget of a cache for backward transitions, qualitative (prob0/prob1) analyses and end component decompositions that is shared among the properties checked on the same model. Least recently used results are evicted first.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The size of the cache in megabytes. Zero disables the cache.").setDefaultValueUnsignedInteger(0).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, timeBoundsOptionName, false, "Checks time-bounded reachability properties on CTMCs and MAs for each of the given time bounds (replacing the bound of the property) and reports the curve of results. The time bounds are handled jointly.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma-separated list of time bounds in ascending order.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, epochThreadsOptionName, false, "Sets the number of threads used to analyze independent epochs of reward-bounded properties concurrently. This only affects the sparse engine with floating point numbers.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. Zero refers to the number of hardware threads.").setDefaultValueUnsignedInteger(1).build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
             
+            uint64_t ModelCheckerSettings::getNumberOfPropertyThreads() const {
+                return this->getOption(propertyThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t ModelCheckerSettings::getAnalysisCacheSize() const {
+                return this->getOption(analysisCacheSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
+            
+            bool ModelCheckerSettings::isTimeBoundsSet() const {
+                return this->getOption(timeBoundsOptionName).getHasOptionBeenSet();
+            }
+            
+            std::vector<double> ModelCheckerSettings::getTimeBounds() const {
+                std::string valuesAsString = this->getOption(timeBoundsOptionName).getArgumentByName("values").getValueAsString();
+                std::vector<std::string> tokens;
+                boost::split(tokens, valuesAsString, boost::is_any_of(","));
+                std::vector<double> timeBounds;
+                for (auto& token : tokens) {
+                    boost::trim(token);
+                    double timeBound;
+                    try {
+                        timeBound = std::stod(token);
+                    } catch (std::exception const&) {
+                        STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unable to parse time bound '" << token << "'.");
+                    }
+                    STORM_LOG_THROW(timeBound >= 0.0, storm::exceptions::IllegalArgumentValueException, "Time bound " << timeBound << " is negative.");
+                    STORM_LOG_THROW(timeBounds.empty() || timeBounds.back() <= timeBound, storm::exceptions::IllegalArgumentValueException, "The time bounds are not in ascending order.");
+                    timeBounds.push_back(timeBound);
+                }
+                return timeBounds;
+            }
+            
+            uint64_t ModelCheckerSettings::getNumberOfEpochThreads() const {
+                return this->getOption(epochThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
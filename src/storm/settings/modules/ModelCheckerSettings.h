@@ -1,6 +1,9 @@
 #pragma once
 
 #include "storm-config.h"
+
+#include <vector>
+
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/builder/ExplorationOrder.h"
@@ -21,6 +24,41 @@ namespace storm {
                 ModelCheckerSettings();
                 
                 bool isFilterRewZeroSet() const;
+                
+                /*!
+                 * Retrieves the number of threads that are to be used for checking properties concurrently, where zero
+                 * refers to the number of hardware threads.
+                 *
+                 * @return The number of threads.
+                 */
+                uint64_t getNumberOfPropertyThreads() const;
+                
+                /*!
+                 * Retrieves the size (in megabytes) of the cache for graph analyses shared among properties.
+                 *
+                 * @return The size of the cache, where zero means that no cache is to be used.
+                 */
+                uint64_t getAnalysisCacheSize() const;
+                
+                /*!
+                 * Retrieves whether time-bounded reachability properties are to be checked for a list of time bounds.
+                 */
+                bool isTimeBoundsSet() const;
+                
+                /*!
+                 * Retrieves the time bounds for which time-bounded reachability properties are to be checked.
+                 *
+                 * @return The time bounds in ascending order.
+                 */
+                std::vector<double> getTimeBounds() const;
+                
+                /*!
+                 * Retrieves the number of threads that are to be used for analyzing independent epochs of reward-bounded
+                 * properties concurrently, where zero refers to the number of hardware threads.
+                 *
+                 * @return The number of threads.
+                 */
+                uint64_t getNumberOfEpochThreads() const;
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -28,6 +66,10 @@ namespace storm {
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string propertyThreadsOptionName;
+                static const std::string analysisCacheSizeOptionName;
+                static const std::string timeBoundsOptionName;
+                static const std::string epochThreadsOptionName;
             };
 
         } // namespace modules
@@ -13,12 +13,23 @@ namespace storm {
             
             const std::string MultiplierSettings::moduleName = "multiplier";
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+            const std::string MultiplierSettings::threadsOptionName = "threads";
+            const std::string MultiplierSettings::pinThreadsOptionName = "pin-threads";
+            const std::string MultiplierSettings::simdOptionName = "simd";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "Sets the number of threads used by the native multiplier. Rows are split among the threads such that each thread handles roughly the same number of matrix entries.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. Zero refers to the number of hardware threads.").setDefaultValueUnsignedInteger(1).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, pinThreadsOptionName, false, "If set, the threads of the native multiplier are bound to fixed processors (Linux only).").setIsAdvanced().build());
+                
+                std::vector<std::string> instructionSets = {"auto", "avx512", "avx2", "none"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, simdOptionName, false, "Sets the vector instructions used for matrix-vector multiplications on double-precision matrices. 'auto' selects the best instruction set supported by the processor and 'none' disables vectorization.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the instruction set.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(instructionSets)).setDefaultValueString("auto").build()).build());
             }
             
             storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -35,6 +46,36 @@ namespace storm {
             bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
                 return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
+            
+            uint64_t MultiplierSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool MultiplierSettings::isPinThreadsSet() const {
+                return this->getOption(pinThreadsOptionName).getHasOptionBeenSet();
+            }
+            
+            storm::utility::simd::InstructionSet MultiplierSettings::getSimdInstructionSet() const {
+                std::string name = this->getOption(simdOptionName).getArgumentByName("name").getValueAsString();
+                storm::utility::simd::InstructionSet instructionSet;
+                if (name == "auto") {
+                    return storm::utility::simd::getBestSupportedInstructionSet();
+                } else if (name == "avx512") {
+                    instructionSet = storm::utility::simd::InstructionSet::Avx512;
+                } else if (name == "avx2") {
+                    instructionSet = storm::utility::simd::InstructionSet::Avx2;
+                } else if (name == "none") {
+                    instructionSet = storm::utility::simd::InstructionSet::None;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown instruction set '" << name << "'.");
+                }
+                if (!storm::utility::simd::isSupported(instructionSet)) {
+                    storm::utility::simd::InstructionSet fallback = storm::utility::simd::getBestSupportedInstructionSet();
+                    STORM_LOG_WARN("The instruction set " << storm::utility::simd::toString(instructionSet) << " is not supported by this processor. Using " << storm::utility::simd::toString(fallback) << " instead.");
+                    return fallback;
+                }
+                return instructionSet;
+            }
         }
     }
 }
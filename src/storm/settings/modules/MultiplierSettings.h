@@ -5,6 +5,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/utility/simd.h"
 
 namespace storm {
     namespace settings {
@@ -22,11 +23,37 @@ namespace storm {
                 
                 bool isMultiplierTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves the number of threads that are to be used for matrix-vector multiplications, where zero
+                 * refers to the number of hardware threads.
+                 *
+                 * @return The number of threads.
+                 */
+                uint64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves whether the threads used for matrix-vector multiplications are to be bound to processors.
+                 *
+                 * @return True iff the threads are to be pinned.
+                 */
+                bool isPinThreadsSet() const;
+                
+                /*!
+                 * Retrieves the instruction set that is to be used for vectorized matrix-vector multiplications. If the
+                 * requested instruction set is not supported by the processor, the best supported one is returned.
+                 *
+                 * @return The instruction set.
+                 */
+                storm::utility::simd::InstructionSet getSimdInstructionSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string multiplierTypeOptionName;
+                static const std::string threadsOptionName;
+                static const std::string pinThreadsOptionName;
+                static const std::string simdOptionName;
             };
             
         }
@@ -0,0 +1,89 @@
+#include "storm/settings/modules/StatisticalModelCheckerSettings.h"
+
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Argument.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string StatisticalModelCheckerSettings::moduleName = "smc";
+            const std::string StatisticalModelCheckerSettings::threadsOptionName = "threads";
+            const std::string StatisticalModelCheckerSettings::seedOptionName = "seed";
+            const std::string StatisticalModelCheckerSettings::errorOptionName = "error";
+            const std::string StatisticalModelCheckerSettings::precisionOptionName = "precision";
+            const std::string StatisticalModelCheckerSettings::indifferenceOptionName = "indifference";
+            const std::string StatisticalModelCheckerSettings::testOptionName = "test";
+            const std::string StatisticalModelCheckerSettings::maxPathLengthOptionName = "maxpathlength";
+            const std::string StatisticalModelCheckerSettings::batchSizeOptionName = "batchsize";
+            
+            StatisticalModelCheckerSettings::StatisticalModelCheckerSettings() : ModuleSettings(moduleName) {
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "Sets the number of threads that sample paths.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. Zero refers to the number of hardware threads.").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, false, "Sets the seed of the random number generators. The results only depend on the seed and the batch size, not on the number of threads. If not set, a random seed is used.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, errorOptionName, false, "Sets the admissible probability of an incorrect result.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.").setDefaultValueDouble(0.01).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "Sets the absolute precision of estimated probabilities.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision.").setDefaultValueDouble(0.01).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, false, "Sets the half-width of the region around the bound of a probability operator in which both outcomes are considered correct.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width.").setDefaultValueDouble(0.01).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 0.5)).build()).build());
+                std::vector<std::string> tests = {"sprt", "chernoff"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, testOptionName, false, "Sets the method for checking probability operators with a bound.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method. 'sprt' stops as soon as the sampled paths are conclusive, 'chernoff' samples a fixed number of paths.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(tests)).setDefaultValueString("sprt").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, maxPathLengthOptionName, false, "Sets the maximal number of steps of a sampled path. Longer paths are considered to not satisfy the property.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of steps.").setDefaultValueUnsignedInteger(1000000).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, false, "Sets the number of paths that are sampled with one random number stream. Sequential tests are evaluated after each batch.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths.").setDefaultValueUnsignedInteger(1000).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+            }
+            
+            uint64_t StatisticalModelCheckerSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool StatisticalModelCheckerSettings::isSeedSet() const {
+                return this->getOption(seedOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t StatisticalModelCheckerSettings::getSeed() const {
+                return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
+            
+            double StatisticalModelCheckerSettings::getErrorProbability() const {
+                return this->getOption(errorOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            double StatisticalModelCheckerSettings::getPrecision() const {
+                return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            double StatisticalModelCheckerSettings::getIndifference() const {
+                return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            storm::modelchecker::HypothesisTestMethod StatisticalModelCheckerSettings::getHypothesisTestMethod() const {
+                std::string methodAsString = this->getOption(testOptionName).getArgumentByName("name").getValueAsString();
+                if (methodAsString == "sprt") {
+                    return storm::modelchecker::HypothesisTestMethod::Sprt;
+                } else if (methodAsString == "chernoff") {
+                    return storm::modelchecker::HypothesisTestMethod::Chernoff;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown hypothesis test '" << methodAsString << "'.");
+            }
+            
+            uint64_t StatisticalModelCheckerSettings::getMaximalPathLength() const {
+                return this->getOption(maxPathLengthOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t StatisticalModelCheckerSettings::getBatchSize() const {
+                return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+#include "storm/modelchecker/statistical/HypothesisTestMethod.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            /*!
+             * This class represents the settings for statistical model checking, i.e., for model checking by sampling paths.
+             */
+            class StatisticalModelCheckerSettings : public ModuleSettings {
+            public:
+                
+                /*!
+                 * Creates a new set of statistical model checking settings.
+                 */
+                StatisticalModelCheckerSettings();
+                
+                /*!
+                 * Retrieves the number of threads that sample paths.
+                 *
+                 * @return The number of threads (zero refers to the number of hardware threads).
+                 */
+                uint64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves whether a seed for the random number generators was set.
+                 */
+                bool isSeedSet() const;
+                
+                /*!
+                 * Retrieves the seed for the random number generators.
+                 */
+                uint64_t getSeed() const;
+                
+                /*!
+                 * Retrieves the admissible probability of an incorrect result.
+                 */
+                double getErrorProbability() const;
+                
+                /*!
+                 * Retrieves the absolute precision of estimated probabilities.
+                 */
+                double getPrecision() const;
+                
+                /*!
+                 * Retrieves the half-width of the indifference region around the bound of a probability operator.
+                 */
+                double getIndifference() const;
+                
+                /*!
+                 * Retrieves the method for checking probability operators with a bound.
+                 */
+                storm::modelchecker::HypothesisTestMethod getHypothesisTestMethod() const;
+                
+                /*!
+                 * Retrieves the maximal number of steps of a sampled path.
+                 */
+                uint64_t getMaximalPathLength() const;
+                
+                /*!
+                 * Retrieves the number of paths that are sampled with one random number stream.
+                 */
+                uint64_t getBatchSize() const;
+                
+                // The name of the module.
+                static const std::string moduleName;
+                
+            private:
+                // Define the string names of the options as constants.
+                static const std::string threadsOptionName;
+                static const std::string seedOptionName;
+                static const std::string errorOptionName;
+                static const std::string precisionOptionName;
+                static const std::string indifferenceOptionName;
+                static const std::string testOptionName;
+                static const std::string maxPathLengthOptionName;
+                static const std::string batchSizeOptionName;
+            };
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
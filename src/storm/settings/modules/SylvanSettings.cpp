@@ -14,16 +14,22 @@ namespace storm {
             const std::string SylvanSettings::moduleName = "sylvan";
             const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
             const std::string SylvanSettings::threadCountOptionName = "threads";
+            const std::string SylvanSettings::initialTableSizeOptionName = "inittable";
             
             SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
-                this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan.").setDefaultValueUnsignedInteger(4096).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan (0 means half of the physical memory).").setDefaultValueUnsignedInteger(0).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads available to Sylvan (0 means 'auto-detect').").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, initialTableSizeOptionName, true, "Sets the number of nodes that the node table of Sylvan initially provides space for. The node table and the operation cache are enlarged during garbage collection when they are filled.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The initial number of nodes (0 means that the tables start with their maximal size).").setDefaultValueUnsignedInteger(1ull << 22).build()).build());
             }
             
             uint_fast64_t SylvanSettings::getMaximalMemory() const {
                 return this->getOption(maximalMemoryOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
 
+            uint_fast64_t SylvanSettings::getInitialTableSize() const {
+                return this->getOption(initialTableSizeOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
+
             bool SylvanSettings::isNumberOfThreadsSet() const {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getHasBeenSet();
             }
@@ -18,12 +18,22 @@ namespace storm {
                 SylvanSettings();
                 
                 /*!
-                 * Retrieves the maximal amount of memory (in megabytes) that Sylvan can occupy.
+                 * Retrieves the maximal amount of memory (in megabytes) that Sylvan can occupy. Note that a value of zero
+                 * means that the amount is derived from the physical memory of the current machine.
                  *
                  * @return The maximal amount of memory to use.
                  */
                 uint_fast64_t getMaximalMemory() const;
                 
+                /*!
+                 * Retrieves the number of nodes that the node table of Sylvan initially provides space for. The node
+                 * table and the operation cache grow (up to the maximal memory) as the decision diagrams grow. Note
+                 * that a value of zero means that the tables are allocated with their maximal size right away.
+                 *
+                 * @return The initial number of nodes.
+                 */
+                uint_fast64_t getInitialTableSize() const;
+                
                 /*!
                  * Retrieves the amount of threads available to Sylvan. Note that a value of zero means that the number
                  * of threads is auto-detected to fit the current machine.
@@ -44,6 +54,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string maximalMemoryOptionName;
                 static const std::string threadCountOptionName;
+                static const std::string initialTableSizeOptionName;
             };
             
         } // namespace modules
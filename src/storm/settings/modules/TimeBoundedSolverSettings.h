@@ -51,6 +51,11 @@ namespace storm {
                  */
                 double getUnifPlusKappa() const;
                 
+                /*!
+                 * Retrieves whether transient probabilities of CTMCs are to be computed with adaptive uniformization.
+                 */
+                bool isAdaptiveUniformizationSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -59,6 +64,7 @@ namespace storm {
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string unifPlusKappaOptionName;
+                static const std::string adaptiveUniformizationOptionName;
             };
             
         }
@@ -24,6 +24,7 @@ namespace storm {
             const std::string TopologicalEquationSolverSettings::moduleName = "topological";
             const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
             const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+            const std::string TopologicalEquationSolverSettings::threadsOptionName = "threads";
             
             TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -32,6 +33,8 @@ namespace storm {
                 std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, underlyingMinMaxMethodOptionName, true, "Sets which minmax method is considered for solving the underlying minmax equation systems.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the used min max method.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(minMaxSolvingTechniques)).setDefaultValueString("value-iteration").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "Sets the number of threads used by the topological solver. SCCs that do not depend on each other are solved concurrently.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. Zero refers to the number of hardware threads.").setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -87,6 +90,10 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
             }
             
+            uint64_t TopologicalEquationSolverSettings::getNumberOfThreads() const {
+                return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             bool TopologicalEquationSolverSettings::check() const {
                 if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
                     STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
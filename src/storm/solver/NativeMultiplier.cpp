@@ -1,5 +1,7 @@
 #include "storm/solver/NativeMultiplier.h"
 
+#include <type_traits>
+
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
@@ -17,8 +19,11 @@
 namespace storm {
     namespace solver {
         
+        // The minimal number of matrix entries per thread for which a multiplication is distributed among threads.
+        static const uint64_t minimalNumberOfEntriesPerThread = 10000;
+        
         template<typename ValueType>
-        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+        NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix), rowGroupPartitionIndices(nullptr) {
             // Intentionally left empty.
         }
         
@@ -31,6 +36,28 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::useThreadPool(Environment const& env) const {
+            // Arithmetic on exact and parametric values is not guaranteed to be thread safe.
+            if (!std::is_same<ValueType, double>::value) {
+                return false;
+            }
+            auto const& multiplierEnvironment = env.solver().multiplier();
+            uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(multiplierEnvironment.getNumberOfThreads());
+            numberOfThreads = std::min<uint64_t>(numberOfThreads, std::max<uint64_t>(this->matrix.getEntryCount() / minimalNumberOfEntriesPerThread, 1));
+            if (numberOfThreads <= 1) {
+                return false;
+            }
+            if (!threadPool || threadPool->getNumberOfThreads() != numberOfThreads || threadPool->areThreadsPinned() != multiplierEnvironment.isPinThreadsSet()) {
+                STORM_LOG_INFO("Using " << numberOfThreads << " threads for matrix-vector multiplications.");
+                threadPool = std::make_unique<storm::utility::parallel::ThreadPool>(numberOfThreads, multiplierEnvironment.isPinThreadsSet());
+                rowPartition = this->matrix.getEntryBalancedRowPartition(numberOfThreads);
+                rowGroupPartition.clear();
+                rowGroupPartitionIndices = nullptr;
+            }
+            return true;
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             std::vector<ValueType>* target = &result;
@@ -42,7 +69,9 @@ namespace storm {
                 }
                 target = this->cachedVector.get();
             }
-            if (parallelize(env)) {
+            if (useThreadPool(env)) {
+                multAddThreaded(x, b, *target);
+            } else if (parallelize(env)) {
                 multAddParallel(x, b, *target);
             } else {
                 multAdd(x, b, *target);
@@ -72,7 +101,9 @@ namespace storm {
                 }
                 target = this->cachedVector.get();
             }
-            if (parallelize(env)) {
+            if (useThreadPool(env)) {
+                multAddReduceThreaded(dir, rowGroupIndices, x, b, *target, choices);
+            } else if (parallelize(env)) {
                 multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
             } else {
                 multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
@@ -136,6 +167,24 @@ namespace storm {
 #endif
         }
 
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddThreaded(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            threadPool->run([&] (uint64_t threadIndex) {
+                this->matrix.multiplyWithVectorRange(rowPartition[threadIndex], rowPartition[threadIndex + 1], x, result, b);
+            });
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduceThreaded(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+            if (rowGroupPartitionIndices != &rowGroupIndices || rowGroupPartition.back() != rowGroupIndices.size() - 1) {
+                rowGroupPartition = this->matrix.getEntryBalancedRowGroupPartition(rowGroupIndices, threadPool->getNumberOfThreads());
+                rowGroupPartitionIndices = &rowGroupIndices;
+            }
+            threadPool->run([&] (uint64_t threadIndex) {
+                this->matrix.multiplyAndReduceRange(dir, rowGroupIndices, rowGroupPartition[threadIndex], rowGroupPartition[threadIndex + 1], x, b, result, choices);
+            });
+        }
+
         template class NativeMultiplier<double>;
 #ifdef STORM_HAVE_CARL
         template class NativeMultiplier<storm::RationalNumber>;
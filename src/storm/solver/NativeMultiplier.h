@@ -3,6 +3,7 @@
 #include "storm/solver/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace storage {
@@ -35,6 +36,24 @@ namespace storm {
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
+            /*!
+             * Checks whether multiplications are to be distributed among the threads of this multiplier's thread pool
+             * and (re-)creates the pool, if necessary.
+             */
+            bool useThreadPool(Environment const& env) const;
+            
+            void multAddThreaded(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            void multAddReduceThreaded(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+            
+            // The threads that perform the multiplications. Each thread always processes the same block of rows, so
+            // it keeps working on the same parts of the matrix and the vectors.
+            mutable std::unique_ptr<storm::utility::parallel::ThreadPool> threadPool;
+            
+            // The blocks of rows (row groups) of the threads. They are computed once for the current thread pool.
+            // The row group partition refers to the row group indices it was computed for.
+            mutable std::vector<uint_fast64_t> rowPartition;
+            mutable std::vector<uint_fast64_t> rowGroupPartition;
+            mutable std::vector<uint64_t> const* rowGroupPartitionIndices;
         };
         
     }
@@ -2,7 +2,11 @@
 
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include <atomic>
+
 #include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
@@ -61,10 +65,16 @@ namespace storm {
             // For sound computations we need to increase the precision in each SCC
             bool needAdaptPrecision = env.solver().isForceSoundness() && env.solver().getPrecisionOfLinearEquationSolver(env.solver().topological().getUnderlyingEquationSolverType()).first.is_initialized();
             
-            if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+            // As the values of exact number types might not be accessed concurrently, we only solve SCCs of non-exact systems concurrently.
+            uint64_t numberOfThreads = storm::NumberTraits<ValueType>::IsExact ? 1 : storm::utility::parallel::getNumberOfThreads(env.solver().topological().getNumberOfThreads());
+            
+            // Solving SCCs concurrently requires the SCC depths
+            bool needSccDepths = needAdaptPrecision || numberOfThreads > 1;
+            
+            if (!this->sortedSccDecomposition || (needSccDepths && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
                 storm::utility::Stopwatch sccSw(true);
-                createSortedSccDecomposition(needAdaptPrecision);
+                createSortedSccDecomposition(needSccDepths, numberOfThreads);
                 sccSw.stop();
                 STORM_LOG_INFO("SCC decomposition computed in " << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size() << " states. Average SCC size is " << static_cast<double>(this->getMatrixRowCount()) / static_cast<double>(this->sortedSccDecomposition->size()) << ".");
             }
@@ -82,6 +92,8 @@ namespace storm {
             bool returnValue = true;
             if (this->sortedSccDecomposition->size() == 1) {
                 returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+            } else if (numberOfThreads > 1) {
+                returnValue = solveSccsConcurrently(sccSolverEnvironment, numberOfThreads, x, b);
             } else {
                 // Solve each SCC individually
                 storm::storage::BitVector sccAsBitVector(x.size(), false);
@@ -97,7 +109,7 @@ namespace storm {
                         for (auto const& state : scc) {
                             sccAsBitVector.set(state, true);
                         }
-                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, this->sccSolver) && returnValue;
                     }
                     ++sccIndex;
                     progress.updateProgress(sccIndex);
@@ -119,9 +131,40 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->concurrentSccHelper || this->concurrentSccHelper->getNumberOfThreads() != numberOfThreads) {
+                this->concurrentSccHelper = std::make_unique<helper::ConcurrentSccSolverHelper>(numberOfThreads);
+                this->concurrentSccSolvers.clear();
+                this->concurrentSccSolvers.resize(numberOfThreads);
+            }
+            
+            // Each thread uses its own SCC solver and bit vector
+            std::vector<storm::storage::BitVector> sccsAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+            std::atomic<bool> returnValue(true);
+            uint64_t numberOfHandledSccs = this->concurrentSccHelper->forEachScc(*this->sortedSccDecomposition, [&] (uint64_t threadIndex, storm::storage::StronglyConnectedComponent const& scc) {
+                bool sccReturnValue;
+                if (scc.size() == 1) {
+                    sccReturnValue = solveTrivialScc(*scc.begin(), x, b);
+                } else {
+                    storm::storage::BitVector& sccAsBitVector = sccsAsBitVectors[threadIndex];
+                    sccAsBitVector.clear();
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, true);
+                    }
+                    sccReturnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, this->concurrentSccSolvers[threadIndex]);
+                }
+                if (!sccReturnValue) {
+                    returnValue = false;
+                }
+            });
+            STORM_LOG_WARN_COND(numberOfHandledSccs == this->sortedSccDecomposition->size(), "Topological solver aborted after analyzing " << numberOfHandledSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            return returnValue;
+        }
+        
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
             // Obtain the scc decomposition
-            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize).numberOfThreads(numberOfThreads));
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
@@ -173,21 +216,21 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
             
             // Matrix
-            bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+            bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
             if (asEquationSystem) {
                 sccA.convertToEquationSystem();
             }
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -207,20 +250,20 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
             }
             
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
-            bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+            bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
             storm::utility::vector::setVectorValues(globalX, scc, sccX);
             return returnvalue;
         }
@@ -241,6 +284,8 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            concurrentSccHelper.reset();
+            concurrentSccSolvers.clear();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -4,6 +4,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
+#include "storm/solver/helper/ConcurrentSccSolverHelper.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
@@ -38,7 +39,10 @@ namespace storm {
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
             
             // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-            void createSortedSccDecomposition(bool needLongestChainSize) const;
+            void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
+            
+            // Solves all SCCs using the given number of threads. This requires that the SCC depths are computed.
+            bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
             // Solves the SCC with the given index
             // ... for the case that the SCC is trivial
@@ -46,7 +50,7 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const;
 
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
@@ -60,6 +64,10 @@ namespace storm {
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+            
+            // auxiliary data for solving SCCs concurrently (one SCC solver per thread)
+            mutable std::unique_ptr<helper::ConcurrentSccSolverHelper> concurrentSccHelper;
+            mutable std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> concurrentSccSolvers;
         };
         
         template<typename ValueType>
@@ -3,7 +3,11 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include <atomic>
+
 #include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
@@ -51,10 +55,16 @@ namespace storm {
             // For sound computations we need to increase the precision in each SCC
             bool needAdaptPrecision = env.solver().isForceSoundness();
             
-            if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+            // As the values of exact number types might not be accessed concurrently, we only solve SCCs of non-exact systems concurrently.
+            uint64_t numberOfThreads = storm::NumberTraits<ValueType>::IsExact ? 1 : storm::utility::parallel::getNumberOfThreads(env.solver().topological().getNumberOfThreads());
+            
+            // Solving SCCs concurrently requires the SCC depths
+            bool needSccDepths = needAdaptPrecision || numberOfThreads > 1;
+            
+            if (!this->sortedSccDecomposition || (needSccDepths && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
                 storm::utility::Stopwatch sccSw(true);
-                createSortedSccDecomposition(needAdaptPrecision);
+                createSortedSccDecomposition(needSccDepths, numberOfThreads);
                 sccSw.stop();
                 STORM_LOG_INFO("SCC decomposition computed in " << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size() << " states. Average SCC size is " << static_cast<double>(this->A->getRowGroupCount()) / static_cast<double>(this->sortedSccDecomposition->size()) << ".");
             }
@@ -81,41 +91,30 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
-                storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-                storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-                uint64_t sccIndex = 0;
-                storm::utility::ProgressMeasurement progress("states");
-                progress.setMaxCount(x.size());
-                progress.startNewMeasurement(0);
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.size() == 1) {
-                        // TODO: directly use localMonRes on this
-                        returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-                    } else {
-                        STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                        sccRowGroupsAsBitVector.clear();
-                        sccRowsAsBitVector.clear();
-                        for (auto const& group : scc) { // Group refers to state
-                            bool allIgnored = true;
-                            sccRowGroupsAsBitVector.set(group, true);
-
-                            if (!this->fixedStates || !this->fixedStates.get()[group]) {
-                                for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                                    sccRowsAsBitVector.set(row, true);
-                                }
-                            } else {
-                                auto row = this->A->getRowGroupIndices()[group]+this->getInitialScheduler()[group];
-                                sccRowsAsBitVector.set(row, true);
-                                STORM_LOG_INFO("Fixing state " << group << " to option " << this->getInitialScheduler()[group] << " because of local monotonicity.");
-                            }
+                if (numberOfThreads > 1) {
+                    returnValue = solveSccsConcurrently(sccSolverEnvironment, dir, numberOfThreads, x, b);
+                } else {
+                    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+                    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+                    uint64_t sccIndex = 0;
+                    storm::utility::ProgressMeasurement progress("states");
+                    progress.setMaxCount(x.size());
+                    progress.startNewMeasurement(0);
+                    for (auto const& scc : *this->sortedSccDecomposition) {
+                        if (scc.size() == 1) {
+                            // TODO: directly use localMonRes on this
+                            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                        } else {
+                            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                            setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector);
+                            returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, this->sccSolver) && returnValue;
+                        }
+                        ++sccIndex;
+                        progress.updateProgress(sccIndex);
+                        if (storm::utility::resources::isTerminate()) {
+                            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                            break;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-                    }
-                    ++sccIndex;
-                    progress.updateProgress(sccIndex);
-                    if (storm::utility::resources::isTerminate()) {
-                        STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                        break;
                     }
                 }
                 
@@ -137,9 +136,57 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+        void TopologicalMinMaxLinearEquationSolver<ValueType>::setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups, storm::storage::BitVector& sccRows) const {
+            sccRowGroups.clear();
+            sccRows.clear();
+            for (auto const& group : scc) { // Group refers to state
+                sccRowGroups.set(group, true);
+                
+                if (!this->fixedStates || !this->fixedStates.get()[group]) {
+                    for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                        sccRows.set(row, true);
+                    }
+                } else {
+                    auto row = this->A->getRowGroupIndices()[group]+this->getInitialScheduler()[group];
+                    sccRows.set(row, true);
+                    STORM_LOG_INFO("Fixing state " << group << " to option " << this->getInitialScheduler()[group] << " because of local monotonicity.");
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->concurrentSccHelper || this->concurrentSccHelper->getNumberOfThreads() != numberOfThreads) {
+                this->concurrentSccHelper = std::make_unique<helper::ConcurrentSccSolverHelper>(numberOfThreads);
+                this->concurrentSccSolvers.clear();
+                this->concurrentSccSolvers.resize(numberOfThreads);
+            }
+            
+            // Each thread uses its own SCC solver and bit vectors
+            std::vector<storm::storage::BitVector> sccRowGroupsAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+            std::vector<storm::storage::BitVector> sccRowsAsBitVectors(numberOfThreads, storm::storage::BitVector(b.size(), false));
+            std::atomic<bool> returnValue(true);
+            uint64_t numberOfHandledSccs = this->concurrentSccHelper->forEachScc(*this->sortedSccDecomposition, [&] (uint64_t threadIndex, storm::storage::StronglyConnectedComponent const& scc) {
+                bool sccReturnValue;
+                if (scc.size() == 1) {
+                    sccReturnValue = solveTrivialScc(*scc.begin(), dir, x, b);
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVectors[threadIndex], sccRowsAsBitVectors[threadIndex]);
+                    sccReturnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVectors[threadIndex], sccRowsAsBitVectors[threadIndex], x, b, this->concurrentSccSolvers[threadIndex]);
+                }
+                if (!sccReturnValue) {
+                    returnValue = false;
+                }
+            });
+            STORM_LOG_WARN_COND(numberOfHandledSccs == this->sortedSccDecomposition->size(), "Topological solver aborted after analyzing " << numberOfHandledSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            return returnValue;
+        }
+        
+        template<typename ValueType>
+        void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
             // Obtain the scc decomposition
-            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize).numberOfThreads(numberOfThreads));
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
@@ -270,12 +317,12 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const {
 
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
             if (this->fixedStates) {
                 // convert fixed states to only fixed states of sccs
@@ -286,11 +333,11 @@ namespace storm {
                     j++;
                 }
                 assert (j = sccRowGroups.getNumberOfSetBits());
-                this->sccSolver->setFixedStates(std::move(fixedStatesSCC));
+                sccSolver->setFixedStates(std::move(fixedStatesSCC));
             }
-            this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-            this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-            this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+            sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+            sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+            sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
             
             // SCC Matrix
             storm::storage::SparseMatrix<ValueType> sccA;
@@ -303,7 +350,7 @@ namespace storm {
 
 //            std::cout << "Matrix is " << sccA << std::endl;
 
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -324,26 +371,26 @@ namespace storm {
             // initial scheduler
             if (this->hasInitialScheduler()) {
                 auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-                this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                sccSolver->setInitialScheduler(std::move(sccInitChoices));
                 if (this->fixedStates) {
-                    this->sccSolver->updateScheduler();
+                    sccSolver->updateScheduler();
                 }
             }
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
             }
             
             // Requirements
-            auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+            auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
             if (req.upperBounds() && this->hasUpperBound()) {
                 req.clearUpperBounds();
             }
@@ -357,16 +404,16 @@ namespace storm {
                 req.clearUniqueSolution();
             }
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            this->sccSolver->setRequirementsChecked(true);
+            sccSolver->setRequirementsChecked(true);
 
             // Invoke scc solver
-            bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+            bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
             // Set Scheduler choices
             if (this->isTrackSchedulerSet()) {
-                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
             }
             
             // Set solution
@@ -387,6 +434,8 @@ namespace storm {
             longestSccChainSize = boost::none;
             sccSolver.reset();
             auxiliaryRowGroupVector.reset();
+            concurrentSccHelper.reset();
+            concurrentSccSolvers.clear();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
         
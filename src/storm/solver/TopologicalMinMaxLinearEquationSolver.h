@@ -3,6 +3,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/ConcurrentSccSolverHelper.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
@@ -33,7 +34,13 @@ namespace storm {
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
             // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-            void createSortedSccDecomposition(bool needLongestChainSize) const;
+            void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
+            
+            // Solves all SCCs using the given number of threads. This requires that the SCC depths are computed.
+            bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            // Sets the row groups and rows of the given SCC in the given bit vectors
+            void setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups, storm::storage::BitVector& sccRows) const;
 
             // Solves the SCC with the given index
             // ... for the case that the SCC is trivial
@@ -41,13 +48,17 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const;
 
             // cached auxiliary data
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
+            
+            // auxiliary data for solving SCCs concurrently (one SCC solver per thread)
+            mutable std::unique_ptr<helper::ConcurrentSccSolverHelper> concurrentSccHelper;
+            mutable std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> concurrentSccSolvers;
         };
     }
 }
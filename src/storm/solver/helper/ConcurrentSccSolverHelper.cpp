@@ -0,0 +1,99 @@
+#include "storm/solver/helper/ConcurrentSccSolverHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+            
+            // Levels with fewer states that have at most one non-trivial SCC are not worth the synchronization overhead.
+            static const uint64_t minimalNumberOfStatesForConcurrentLevel = 1000;
+            
+            ConcurrentSccSolverHelper::ConcurrentSccSolverHelper(uint64_t numberOfThreads) : threadPool(numberOfThreads) {
+                // Intentionally left empty.
+            }
+            
+            uint64_t ConcurrentSccSolverHelper::getNumberOfThreads() const {
+                return threadPool.getNumberOfThreads();
+            }
+            
+            template<typename ValueType>
+            uint64_t ConcurrentSccSolverHelper::forEachScc(storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition, std::function<void (uint64_t, storm::storage::StronglyConnectedComponent const&)> const& function) {
+                STORM_LOG_ASSERT(decomposition.hasSccDepths(), "Expected the SCC depths to be computed.");
+                uint64_t numberOfSccs = decomposition.size();
+                
+                // Sort the SCCs by their depth. Within a level, larger SCCs come first to balance the work among the threads.
+                std::vector<uint64_t> sortedSccs(numberOfSccs);
+                std::iota(sortedSccs.begin(), sortedSccs.end(), 0);
+                std::sort(sortedSccs.begin(), sortedSccs.end(), [&decomposition] (uint64_t const& first, uint64_t const& second) {
+                    uint64_t firstDepth = decomposition.getSccDepth(first);
+                    uint64_t secondDepth = decomposition.getSccDepth(second);
+                    return firstDepth < secondDepth || (firstDepth == secondDepth && decomposition.getBlock(first).size() > decomposition.getBlock(second).size());
+                });
+                
+                uint64_t numberOfStates = 0;
+                for (auto const& scc : decomposition) {
+                    numberOfStates += scc.size();
+                }
+                storm::utility::ProgressMeasurement progress("states");
+                progress.setMaxCount(numberOfStates);
+                progress.startNewMeasurement(0);
+                
+                uint64_t numberOfHandledSccs = 0;
+                uint64_t numberOfHandledStates = 0;
+                auto levelBegin = sortedSccs.begin();
+                while (levelBegin != sortedSccs.end()) {
+                    uint64_t depth = decomposition.getSccDepth(*levelBegin);
+                    auto levelEnd = std::find_if(levelBegin, sortedSccs.end(), [&decomposition, &depth] (uint64_t const& scc) { return decomposition.getSccDepth(scc) != depth; });
+                    uint64_t levelSize = std::distance(levelBegin, levelEnd);
+                    uint64_t levelStates = 0;
+                    uint64_t levelNonTrivialSccs = 0;
+                    for (auto sccIt = levelBegin; sccIt != levelEnd; ++sccIt) {
+                        uint64_t sccSize = decomposition.getBlock(*sccIt).size();
+                        levelStates += sccSize;
+                        if (sccSize > 1) {
+                            ++levelNonTrivialSccs;
+                        }
+                    }
+                    
+                    if (levelSize > 1 && threadPool.getNumberOfThreads() > 1 && (levelNonTrivialSccs > 1 || levelStates >= minimalNumberOfStatesForConcurrentLevel)) {
+                        std::atomic<uint64_t> nextScc(0);
+                        threadPool.run([&] (uint64_t threadIndex) {
+                            for (uint64_t sccIndex = nextScc++; sccIndex < levelSize; sccIndex = nextScc++) {
+                                function(threadIndex, decomposition.getBlock(*(levelBegin + sccIndex)));
+                            }
+                        });
+                    } else {
+                        for (auto sccIt = levelBegin; sccIt != levelEnd; ++sccIt) {
+                            function(0, decomposition.getBlock(*sccIt));
+                        }
+                    }
+                    
+                    numberOfHandledSccs += levelSize;
+                    numberOfHandledStates += levelStates;
+                    progress.updateProgress(numberOfHandledStates);
+                    if (storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                    levelBegin = levelEnd;
+                }
+                return numberOfHandledSccs;
+            }
+            
+            template uint64_t ConcurrentSccSolverHelper::forEachScc<double>(storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition, std::function<void (uint64_t, storm::storage::StronglyConnectedComponent const&)> const& function);
+            
+#ifdef STORM_HAVE_CARL
+            template uint64_t ConcurrentSccSolverHelper::forEachScc<storm::RationalNumber>(storm::storage::StronglyConnectedComponentDecomposition<storm::RationalNumber> const& decomposition, std::function<void (uint64_t, storm::storage::StronglyConnectedComponent const&)> const& function);
+            template uint64_t ConcurrentSccSolverHelper::forEachScc<storm::RationalFunction>(storm::storage::StronglyConnectedComponentDecomposition<storm::RationalFunction> const& decomposition, std::function<void (uint64_t, storm::storage::StronglyConnectedComponent const&)> const& function);
+#endif
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "storm/utility/parallel.h"
+
+namespace storm {
+    
+    namespace storage {
+        template<typename ValueType>
+        class StronglyConnectedComponentDecomposition;
+        
+        class StronglyConnectedComponent;
+    }
+    
+    namespace solver {
+        namespace helper {
+            
+            /*!
+             * Helps the topological solvers to solve independent SCCs concurrently. The SCCs are grouped into levels
+             * according to their depth in the SCC graph. As an SCC only has transitions to SCCs with a smaller depth,
+             * all SCCs of one level can be solved concurrently once the previous levels are solved.
+             */
+            class ConcurrentSccSolverHelper {
+            public:
+                /*!
+                 * Creates a helper that uses the given number of threads.
+                 */
+                ConcurrentSccSolverHelper(uint64_t numberOfThreads);
+                
+                /*!
+                 * Retrieves the number of threads used by this helper.
+                 */
+                uint64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Invokes the given function for every SCC of the given decomposition such that an SCC is only handled
+                 * after all SCCs it can reach. The function is called with the index of the executing thread and the SCC.
+                 * Calls with different SCCs might be executed concurrently, but calls with the same thread index are not.
+                 * Levels with only a few (small) SCCs are handled by the calling thread (with index 0).
+                 *
+                 * @param decomposition The decomposition whose SCCs are handled. The SCC depths need to be computed.
+                 * @param function The function to invoke.
+                 * @return The number of SCCs that have been handled. This is less than the number of SCCs iff the
+                 * computation was aborted.
+                 */
+                template<typename ValueType>
+                uint64_t forEachScc(storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition, std::function<void (uint64_t, storm::storage::StronglyConnectedComponent const&)> const& function);
+                
+            private:
+                storm::utility::parallel::ThreadPool threadPool;
+            };
+        }
+    }
+}
@@ -547,6 +547,9 @@ namespace storm {
             template<typename StateType>
             friend struct Murmur3BitVectorHash;
 
+            template<typename ValueType, typename Hash>
+            friend class ConcurrentBitVectorHashMap;
+
         private:
             /*!
              * Creates an empty bit vector with the given number of buckets.
@@ -0,0 +1,345 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace detail {
+            // A slot of a table stores the index of a key plus one in the lower 48 bits, a fingerprint of the hash of
+            // the key in the next 15 bits and a flag that indicates that the slot was moved to the successor table.
+            static const uint64_t emptySlot = 0;
+            static const uint64_t indexMask = (1ull << 48) - 1;
+            static const uint64_t fingerprintMask = ((1ull << 15) - 1) << 48;
+            static const uint64_t movedFlag = 1ull << 63;
+            // The content of a slot that has been claimed by an insertion which did not yet store the key.
+            static const uint64_t busySlot = indexMask;
+            // The largest index that can be stored.
+            static const uint64_t maximalIndex = indexMask - 2;
+
+            // The number of keys in the first segment is 2^firstSegmentExponent.
+            static const uint64_t firstSegmentExponent = 10;
+
+            // The number of slots that are migrated at once.
+            static const uint64_t migrationChunkSize = 4096;
+
+            inline uint64_t getFingerprint(uint64_t hash) {
+                return (hash << 48) & fingerprintMask;
+            }
+
+            inline uint64_t getSegment(uint64_t index) {
+                uint64_t shiftedIndex = index + (1ull << firstSegmentExponent);
+                uint64_t segment = 63;
+                while ((shiftedIndex & (1ull << segment)) == 0) {
+                    --segment;
+                }
+                return segment - firstSegmentExponent;
+            }
+
+            inline uint64_t getOffsetInSegment(uint64_t index, uint64_t segment) {
+                return index + (1ull << firstSegmentExponent) - (1ull << (segment + firstSegmentExponent));
+            }
+
+            inline void waitBriefly() {
+                std::this_thread::yield();
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t sizeExponent) : sizeExponent(sizeExponent), slots(new std::atomic<uint64_t>[1ull << sizeExponent]()), successor(nullptr), nextChunkToMigrate(0), numberOfMigratedChunks(0) {
+            // Intentionally left empty.
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), wordsPerKey(bucketSize / 64), numberOfElements(0) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            STORM_LOG_ASSERT(loadFactor > 0.0 && loadFactor < 1.0, "Illegal load factor " << loadFactor << ".");
+
+            uint64_t sizeExponent = 1;
+            while ((1ull << sizeExponent) * loadFactor < initialSize) {
+                ++sizeExponent;
+            }
+            firstTable = new Table(sizeExponent);
+            currentTable.store(firstTable);
+            for (auto& segment : keySegments) {
+                segment.store(nullptr);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+            Table* table = firstTable;
+            while (table != nullptr) {
+                Table* successor = table->successor.load();
+                delete table;
+                table = successor;
+            }
+            for (auto& segment : keySegments) {
+                delete[] segment.load();
+            }
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key) {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+            uint64_t hash = hasher(key);
+
+            while (true) {
+                Table* table = currentTable.load(std::memory_order_acquire);
+                if (table->successor.load(std::memory_order_acquire) != nullptr) {
+                    migrate(*table);
+                    continue;
+                }
+
+                uint64_t index;
+                switch (findOrAddInTable(*table, key, hash, index)) {
+                    case TableOperationResult::Found:
+                        return std::make_pair(static_cast<ValueType>(index), false);
+                    case TableOperationResult::Added:
+                        return std::make_pair(static_cast<ValueType>(index), true);
+                    case TableOperationResult::Full:
+                        startMigration(*table);
+                        migrate(*table);
+                        break;
+                    case TableOperationResult::Moved:
+                        migrate(*table);
+                        break;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::TableOperationResult ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddInTable(Table& table, storm::storage::BitVector const& key, uint64_t hash, uint64_t& index) {
+            uint64_t const mask = (1ull << table.sizeExponent) - 1;
+            uint64_t const fingerprint = detail::getFingerprint(hash);
+            uint64_t slot = hash >> (64 - table.sizeExponent);
+
+            for (uint64_t probe = 0; probe <= mask; ++probe) {
+                std::atomic<uint64_t>& currentSlot = table.slots[slot];
+                uint64_t content = currentSlot.load(std::memory_order_acquire);
+
+                if (content == detail::emptySlot) {
+                    if (numberOfElements.load(std::memory_order_relaxed) >= getMaximalLoad(table)) {
+                        return TableOperationResult::Full;
+                    }
+                    if (currentSlot.compare_exchange_strong(content, detail::busySlot, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        // The slot is ours, so we can safely obtain a fresh index and store the key.
+                        index = numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                        STORM_LOG_ASSERT(index <= detail::maximalIndex && index <= std::numeric_limits<ValueType>::max(), "Too many elements in hash map.");
+                        std::copy(key.buckets, key.buckets + wordsPerKey, getKeyStorage(index, true));
+                        currentSlot.store(fingerprint | (index + 1), std::memory_order_release);
+                        return TableOperationResult::Added;
+                    }
+                    // Otherwise, content now holds the value that was written by another thread.
+                }
+
+                while (content == detail::busySlot) {
+                    detail::waitBriefly();
+                    content = currentSlot.load(std::memory_order_acquire);
+                }
+
+                if ((content & detail::movedFlag) != 0) {
+                    return TableOperationResult::Moved;
+                }
+                if ((content & detail::fingerprintMask) == fingerprint && keyMatches((content & detail::indexMask) - 1, key)) {
+                    index = (content & detail::indexMask) - 1;
+                    return TableOperationResult::Found;
+                }
+
+                slot = (slot + 1) & mask;
+            }
+            return TableOperationResult::Full;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<bool, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+            uint64_t hash = hasher(key);
+            uint64_t const fingerprint = detail::getFingerprint(hash);
+
+            Table const* table = currentTable.load(std::memory_order_acquire);
+            while (table != nullptr) {
+                uint64_t const mask = (1ull << table->sizeExponent) - 1;
+                uint64_t slot = hash >> (64 - table->sizeExponent);
+                bool searchSuccessor = true;
+                for (uint64_t probe = 0; probe <= mask; ++probe) {
+                    uint64_t content = table->slots[slot].load(std::memory_order_acquire);
+                    while (content == detail::busySlot) {
+                        detail::waitBriefly();
+                        content = table->slots[slot].load(std::memory_order_acquire);
+                    }
+
+                    uint64_t entry = content & ~detail::movedFlag;
+                    if (entry == detail::emptySlot) {
+                        // Keys that are not in this table can only be in the successor if this slot was already moved.
+                        searchSuccessor = (content & detail::movedFlag) != 0;
+                        break;
+                    }
+                    if ((entry & detail::fingerprintMask) == fingerprint && keyMatches((entry & detail::indexMask) - 1, key)) {
+                        return std::make_pair(true, (entry & detail::indexMask) - 1);
+                    }
+                    slot = (slot + 1) & mask;
+                }
+                if (!searchSuccessor) {
+                    break;
+                }
+                table = table->successor.load(std::memory_order_acquire);
+            }
+            return std::make_pair(false, 0);
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::startMigration(Table& table) {
+            if (table.successor.load(std::memory_order_acquire) == nullptr) {
+                STORM_LOG_TRACE("Increasing size of concurrent hash map from " << (1ull << table.sizeExponent) << " to " << (1ull << (table.sizeExponent + 1)) << ".");
+                Table* successor = new Table(table.sizeExponent + 1);
+                Table* expected = nullptr;
+                if (!table.successor.compare_exchange_strong(expected, successor, std::memory_order_acq_rel)) {
+                    // Another thread was faster.
+                    delete successor;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::migrate(Table& table) {
+            Table* successor = table.successor.load(std::memory_order_acquire);
+            STORM_LOG_ASSERT(successor != nullptr, "Cannot migrate table without successor.");
+
+            uint64_t const numberOfSlots = 1ull << table.sizeExponent;
+            uint64_t const numberOfChunks = (numberOfSlots + detail::migrationChunkSize - 1) / detail::migrationChunkSize;
+            storm::storage::BitVector scratchKey(bucketSize);
+            for (uint64_t chunk = table.nextChunkToMigrate.fetch_add(1, std::memory_order_relaxed); chunk < numberOfChunks; chunk = table.nextChunkToMigrate.fetch_add(1, std::memory_order_relaxed)) {
+                uint64_t const endSlot = std::min(numberOfSlots, (chunk + 1) * detail::migrationChunkSize);
+                for (uint64_t slot = chunk * detail::migrationChunkSize; slot < endSlot; ++slot) {
+                    migrateSlot(table, *successor, slot, scratchKey);
+                }
+                table.numberOfMigratedChunks.fetch_add(1, std::memory_order_acq_rel);
+            }
+
+            // Wait for the other threads to finish their chunks.
+            while (table.numberOfMigratedChunks.load(std::memory_order_acquire) < numberOfChunks) {
+                detail::waitBriefly();
+            }
+
+            Table* expected = &table;
+            currentTable.compare_exchange_strong(expected, successor, std::memory_order_acq_rel);
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::migrateSlot(Table& table, Table& successor, uint64_t slot, storm::storage::BitVector& scratchKey) {
+            // Mark the slot as moved. This prevents further insertions into this slot.
+            std::atomic<uint64_t>& currentSlot = table.slots[slot];
+            uint64_t content = currentSlot.load(std::memory_order_acquire);
+            while (true) {
+                if (content == detail::busySlot) {
+                    detail::waitBriefly();
+                    content = currentSlot.load(std::memory_order_acquire);
+                } else if (currentSlot.compare_exchange_weak(content, content | detail::movedFlag, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    break;
+                }
+            }
+
+            if (content != detail::emptySlot) {
+                // Recompute the hash value from the stored key and insert the entry into the successor table. Since no
+                // keys are added to the successor during the migration, we only need to find an empty slot.
+                uint64_t const index = (content & detail::indexMask) - 1;
+                uint64_t const* keyStorage = getKeyStorage(index);
+                std::copy(keyStorage, keyStorage + wordsPerKey, scratchKey.buckets);
+                uint64_t const mask = (1ull << successor.sizeExponent) - 1;
+                uint64_t successorSlot = hasher(scratchKey) >> (64 - successor.sizeExponent);
+                while (true) {
+                    uint64_t expected = detail::emptySlot;
+                    if (successor.slots[successorSlot].compare_exchange_strong(expected, content, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                        break;
+                    }
+                    successorSlot = (successorSlot + 1) & mask;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t* ConcurrentBitVectorHashMap<ValueType, Hash>::getKeyStorage(uint64_t index, bool create) {
+            uint64_t segment = detail::getSegment(index);
+            uint64_t* segmentStorage = keySegments[segment].load(std::memory_order_acquire);
+            if (segmentStorage == nullptr && create) {
+                uint64_t* newSegmentStorage = new uint64_t[(1ull << (segment + detail::firstSegmentExponent)) * wordsPerKey];
+                if (keySegments[segment].compare_exchange_strong(segmentStorage, newSegmentStorage, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    segmentStorage = newSegmentStorage;
+                } else {
+                    // Another thread was faster, so segmentStorage now points to its segment.
+                    delete[] newSegmentStorage;
+                }
+            }
+            STORM_LOG_ASSERT(segmentStorage != nullptr, "Missing storage for key with index " << index << ".");
+            return segmentStorage + detail::getOffsetInSegment(index, segment) * wordsPerKey;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t const* ConcurrentBitVectorHashMap<ValueType, Hash>::getKeyStorage(uint64_t index) const {
+            uint64_t segment = detail::getSegment(index);
+            uint64_t const* segmentStorage = keySegments[segment].load(std::memory_order_acquire);
+            STORM_LOG_ASSERT(segmentStorage != nullptr, "Missing storage for key with index " << index << ".");
+            return segmentStorage + detail::getOffsetInSegment(index, segment) * wordsPerKey;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::keyMatches(uint64_t index, storm::storage::BitVector const& key) const {
+            uint64_t const* keyStorage = getKeyStorage(index);
+            return std::equal(keyStorage, keyStorage + wordsPerKey, key.buckets);
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getMaximalLoad(Table const& table) const {
+            return static_cast<uint64_t>(loadFactor * (1ull << table.sizeExponent));
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+            return find(key).first;
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+            std::pair<bool, uint64_t> flagIndexPair = find(key);
+            STORM_LOG_ASSERT(flagIndexPair.first, "Unknown key.");
+            return static_cast<ValueType>(flagIndexPair.second);
+        }
+
+        template<class ValueType, class Hash>
+        storm::storage::BitVector ConcurrentBitVectorHashMap<ValueType, Hash>::getKey(ValueType const& value) const {
+            STORM_LOG_ASSERT(value < size(), "Unknown value " << value << ".");
+            storm::storage::BitVector result(bucketSize);
+            uint64_t const* keyStorage = getKeyStorage(value);
+            std::copy(keyStorage, keyStorage + wordsPerKey, result.buckets);
+            return result;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+            return numberOfElements.load(std::memory_order_acquire);
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+            return 1ull << currentTable.load(std::memory_order_acquire)->sizeExponent;
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::releaseRetiredTables() {
+            Table* table = currentTable.load();
+            while (firstTable != table) {
+                Table* successor = firstTable->successor.load();
+                delete firstTable;
+                firstTable = successor;
+            }
+        }
+
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+        template class ConcurrentBitVectorHashMap<uint64_t>;
+    }
+}
@@ -0,0 +1,205 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a hash map whose keys are bit vectors and that supports concurrent insertions and
+         * queries from multiple threads. Each key is mapped to the number of keys that were inserted before it, i.e.,
+         * the values form the range {0, ..., size()-1}, which makes the map suitable to assign indices to states.
+         * As for the BitVectorHashMap, the keys must be bit vectors with a length that is a multiple of 64.
+         *
+         * The keys are stored contiguously (in the order of insertion) in segments that are never moved. The hash
+         * table itself only stores a part of the hash value and the index of the key, which makes it cheap to grow
+         * the table. Insertions claim an empty slot of the table with a single compare-and-swap operation. If the
+         * table becomes too full, a table of twice the size is allocated and all threads that access the map help
+         * migrating the slots to the new table instead of waiting for a single thread to finish the rehashing.
+         *
+         * Currently, the map is only used by the multi-threaded exploration of the ExplicitModelBuilder, which also
+         * builds GSPNs (via their JANI translation). The other state stores are not migrated: the DFT builder and the
+         * state generation of the exploration engine explore states one at a time and thus do not insert concurrently,
+         * and the BeliefManager of storm-pomdp identifies beliefs, i.e., sparse probability distributions, which are no
+         * bit vectors of a fixed length. Its successor beliefs are computed in parallel and inserted sequentially.
+         */
+        template<typename ValueType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+        class ConcurrentBitVectorHashMap {
+        public:
+            /*!
+             * Creates a new hash map with the given bucket size and initial size.
+             *
+             * @param bucketSize The size of the keys that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of keys that can be inserted before the table needs to grow.
+             * @param loadFactor The load factor that determines at which point the size of the table is increased.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+            ~ConcurrentBitVectorHashMap();
+
+            ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+            ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+            /*!
+             * Searches for the given key in the map and inserts it if it is not yet contained. This method may be
+             * called concurrently with all other thread-safe methods of this class.
+             *
+             * @param key The key to search or insert.
+             * @return A pair whose first component is the value of the key and whose second component indicates
+             * whether the key was inserted by this call.
+             */
+            std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key);
+
+            /*!
+             * Checks whether the given key is contained in the map. This method is thread-safe.
+             *
+             * @param key The key to search.
+             * @return True iff the key is contained in the map.
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the value associated with the given key. If the key does not exist, the behaviour is
+             * undefined. This method is thread-safe.
+             *
+             * @param key The key to search.
+             * @return The value associated with the given key.
+             */
+            ValueType getValue(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the key that is mapped to the given value. This method is thread-safe, provided that the
+             * call inserting the key has returned.
+             *
+             * @param value The value of the key.
+             * @return The key that is mapped to the given value.
+             */
+            storm::storage::BitVector getKey(ValueType const& value) const;
+
+            /*!
+             * Retrieves the number of keys stored in the map. While insertions are in progress, this number may
+             * include keys whose insertion has not yet finished.
+             *
+             * @return The size of the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the number of slots of the current hash table.
+             *
+             * @return The capacity of the hash table.
+             */
+            uint64_t capacity() const;
+
+            /*!
+             * Releases the memory of the hash tables that were replaced by larger ones. Note that this method must not
+             * be called while other threads access the map.
+             */
+            void releaseRetiredTables();
+
+        private:
+            // A hash table whose slots store the fingerprint and the index of a key.
+            struct Table {
+                Table(uint64_t sizeExponent);
+
+                // The number of slots is 2^sizeExponent.
+                uint64_t sizeExponent;
+
+                // The slots of the table.
+                std::unique_ptr<std::atomic<uint64_t>[]> slots;
+
+                // The table that replaces this one (if any).
+                std::atomic<Table*> successor;
+
+                // The next chunk of slots that is to be migrated to the successor table.
+                std::atomic<uint64_t> nextChunkToMigrate;
+
+                // The number of chunks that were completely migrated to the successor table.
+                std::atomic<uint64_t> numberOfMigratedChunks;
+            };
+
+            // The possible outcomes of an attempt to find or insert a key in a particular table.
+            enum class TableOperationResult { Found, Added, Full, Moved };
+
+            /*!
+             * Attempts to find or insert the given key in the given table.
+             */
+            TableOperationResult findOrAddInTable(Table& table, storm::storage::BitVector const& key, uint64_t hash, uint64_t& index);
+
+            /*!
+             * Searches the given key and returns its index (if it is contained).
+             */
+            std::pair<bool, uint64_t> find(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Allocates the successor of the given table (if this did not already happen).
+             */
+            void startMigration(Table& table);
+
+            /*!
+             * Helps migrating the slots of the given table to its successor and returns once the migration is complete.
+             */
+            void migrate(Table& table);
+
+            /*!
+             * Moves the content of the given slot of the given table to the successor table.
+             */
+            void migrateSlot(Table& table, Table& successor, uint64_t slot, storm::storage::BitVector& scratchKey);
+
+            /*!
+             * Retrieves the first word of the stored key with the given index. The segment holding the key is created
+             * if necessary.
+             */
+            uint64_t* getKeyStorage(uint64_t index, bool create);
+
+            /*!
+             * Retrieves the first word of the stored key with the given index.
+             */
+            uint64_t const* getKeyStorage(uint64_t index) const;
+
+            /*!
+             * Checks whether the stored key with the given index matches the given key.
+             */
+            bool keyMatches(uint64_t index, storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the maximal number of keys the given table can hold before it has to grow.
+             */
+            uint64_t getMaximalLoad(Table const& table) const;
+
+            // The load factor determining when the size of the table is increased.
+            double loadFactor;
+
+            // The size of one key (in bits).
+            uint64_t bucketSize;
+
+            // The number of 64-bit words of one key.
+            uint64_t wordsPerKey;
+
+            // The first table that was allocated. All other tables can be reached through the successor pointers.
+            Table* firstTable;
+
+            // The table that is currently used.
+            std::atomic<Table*> currentTable;
+
+            // The number of keys in this map.
+            std::atomic<uint64_t> numberOfElements;
+
+            // The segments storing the keys. Segment i holds the keys with indices in [2^(i+f) - 2^f, 2^(i+f+1) - 2^f)
+            // where 2^f is the number of keys in the first segment.
+            std::array<std::atomic<uint64_t*>, 64> keySegments;
+
+            // Functor object that is used to perform the actual hashing.
+            Hash hasher;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
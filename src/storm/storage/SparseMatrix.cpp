@@ -2,6 +2,7 @@
 
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseMatrixSimdKernels.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/BitVector.h"
@@ -591,6 +592,35 @@ namespace storm {
             return result;
         }
         
+        template<typename ValueType>
+        std::vector<typename SparseMatrix<ValueType>::index_type> SparseMatrix<ValueType>::getEntryBalancedRowPartition(uint64_t numberOfBlocks) const {
+            STORM_LOG_ASSERT(numberOfBlocks > 0, "Expected at least one block.");
+            std::vector<index_type> result(numberOfBlocks + 1, 0);
+            for (uint64_t block = 1; block < numberOfBlocks; ++block) {
+                // Find the first row that starts at or after the desired number of entries.
+                index_type targetEntry = (this->getEntryCount() * block) / numberOfBlocks;
+                index_type row = std::lower_bound(rowIndications.begin(), rowIndications.begin() + this->getRowCount(), targetEntry) - rowIndications.begin();
+                result[block] = std::max(result[block - 1], row);
+            }
+            result.back() = this->getRowCount();
+            return result;
+        }
+        
+        template<typename ValueType>
+        std::vector<typename SparseMatrix<ValueType>::index_type> SparseMatrix<ValueType>::getEntryBalancedRowGroupPartition(std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfBlocks) const {
+            STORM_LOG_ASSERT(numberOfBlocks > 0, "Expected at least one block.");
+            STORM_LOG_ASSERT(!rowGroupIndices.empty(), "Expected non-empty row group indices.");
+            std::vector<index_type> rowPartition = getEntryBalancedRowPartition(numberOfBlocks);
+            std::vector<index_type> result(numberOfBlocks + 1, 0);
+            for (uint64_t block = 1; block < numberOfBlocks; ++block) {
+                // Move the boundary to the first row group that starts at or after the boundary row.
+                index_type rowGroup = std::lower_bound(rowGroupIndices.begin(), rowGroupIndices.end() - 1, rowPartition[block]) - rowGroupIndices.begin();
+                result[block] = std::max(result[block - 1], rowGroup);
+            }
+            result.back() = rowGroupIndices.size() - 1;
+            return result;
+        }
+        
         template<typename ValueType>
         typename SparseMatrix<ValueType>::index_type SparseMatrix<ValueType>::getNonzeroEntryCount() const {
             return nonzeroEntryCount;
@@ -1563,14 +1593,22 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
-            const_iterator it = this->begin();
+            this->multiplyWithVectorRange(0, result.size(), vector, result, summand);
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            if (detail::SimdKernels<ValueType>::multiplyWithVectorRange(columnsAndValues.data(), rowIndications.data(), startRow, endRow, vector, result, summand)) {
+                return;
+            }
+            std::vector<index_type>::const_iterator rowIterator = rowIndications.begin() + startRow;
+            const_iterator it = this->begin() + *rowIterator;
             const_iterator ite;
-            std::vector<index_type>::const_iterator rowIterator = rowIndications.begin();
-            typename std::vector<ValueType>::iterator resultIterator = result.begin();
-            typename std::vector<ValueType>::iterator resultIteratorEnd = result.end();
+            typename std::vector<ValueType>::iterator resultIterator = result.begin() + startRow;
+            typename std::vector<ValueType>::iterator resultIteratorEnd = result.begin() + endRow;
             typename std::vector<ValueType>::const_iterator summandIterator;
             if (summand) {
-                summandIterator = summand->begin();
+                summandIterator = summand->begin() + startRow;
             }
             
             for (; resultIterator != resultIteratorEnd; ++rowIterator, ++resultIterator, ++summandIterator) {
@@ -1591,6 +1629,9 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            if (detail::SimdKernels<ValueType>::multiplyWithVectorBackward(columnsAndValues.data(), rowIndications.data(), result.size(), vector, result, summand)) {
+                return;
+            }
             const_iterator it = this->end() - 1;
             const_iterator ite;
             std::vector<index_type>::const_iterator rowIterator = rowIndications.end() - 2;
@@ -1754,6 +1795,9 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (detail::SimdKernels<ValueType>::multiplyAndReduceRange(dir == OptimizationDirection::Minimize, columnsAndValues.data(), rowIndications.data(), rowGroupIndices, 0, result.size(), vector, summand, result, choices)) {
+                return;
+            }
             if (dir == OptimizationDirection::Minimize) {
                 multiplyAndReduceForward<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices);
             } else {
@@ -1764,25 +1808,43 @@ namespace storm {
         template<typename ValueType>
         template<typename Compare>
         void SparseMatrix<ValueType>::multiplyAndReduceForward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            multiplyAndReduceRange<Compare>(rowGroupIndices, 0, result.size(), vector, summand, result, choices);
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (detail::SimdKernels<ValueType>::multiplyAndReduceRange(dir == OptimizationDirection::Minimize, columnsAndValues.data(), rowIndications.data(), rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices)) {
+                return;
+            }
+            if (dir == OptimizationDirection::Minimize) {
+                multiplyAndReduceRange<storm::utility::ElementLess<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+            } else {
+                multiplyAndReduceRange<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+            }
+        }
+        
+        template<typename ValueType>
+        template<typename Compare>
+        void SparseMatrix<ValueType>::multiplyAndReduceRange(std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             Compare compare;
-            auto elementIt = this->begin();
-            auto rowGroupIt = rowGroupIndices.begin();
-            auto rowIt = rowIndications.begin();
+            auto rowGroupIt = rowGroupIndices.begin() + startRowGroup;
+            auto rowIt = rowIndications.begin() + *rowGroupIt;
+            auto elementIt = this->begin() + *rowIt;
             typename std::vector<ValueType>::const_iterator summandIt;
             if (summand) {
-                summandIt = summand->begin();
+                summandIt = summand->begin() + *rowGroupIt;
             }
             typename std::vector<uint_fast64_t>::iterator choiceIt;
             if (choices) {
-                choiceIt = choices->begin();
+                choiceIt = choices->begin() + startRowGroup;
             }
             
             // Variables for correctly tracking choices (only update if new choice is strictly better).
             ValueType oldSelectedChoiceValue;
             uint64_t selectedChoice;
             
-            uint64_t currentRow = 0;
-            for (auto resultIt = result.begin(), resultIte = result.end(); resultIt != resultIte; ++resultIt, ++choiceIt, ++rowGroupIt) {
+            uint64_t currentRow = *rowGroupIt;
+            for (auto resultIt = result.begin() + startRowGroup, resultIte = result.begin() + endRowGroup; resultIt != resultIte; ++resultIt, ++choiceIt, ++rowGroupIt) {
                 ValueType currentValue = storm::utility::zero<ValueType>();
                 
                 // Only multiply and reduce if there is at least one row in the group.
@@ -1841,10 +1903,18 @@ namespace storm {
         void SparseMatrix<storm::RationalFunction>::multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices) const {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
         }
+        
+        template<>
+        void SparseMatrix<storm::RationalFunction>::multiplyAndReduceRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
 #endif
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (detail::SimdKernels<ValueType>::multiplyAndReduceBackward(dir == storm::OptimizationDirection::Minimize, columnsAndValues.data(), rowIndications.data(), rowGroupIndices, result.size(), vector, summand, result, choices)) {
+                return;
+            }
             if (dir == storm::OptimizationDirection::Minimize) {
                 multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices);
             } else {
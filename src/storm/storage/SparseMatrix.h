@@ -537,6 +537,27 @@ namespace storm {
             */
             uint_fast64_t getRowGroupEntryCount(uint_fast64_t const group) const;
 
+            /*!
+             * Splits the rows of the matrix into the given number of blocks of consecutive rows such that all blocks
+             * contain roughly the same number of entries.
+             *
+             * @param numberOfBlocks The number of blocks.
+             * @return A vector of size numberOfBlocks + 1 such that block i consists of the rows [result[i], result[i + 1]).
+             * Blocks may be empty.
+             */
+            std::vector<index_type> getEntryBalancedRowPartition(uint64_t numberOfBlocks) const;
+
+            /*!
+             * Splits the given row groups into the given number of blocks of consecutive row groups such that all
+             * blocks contain roughly the same number of entries.
+             *
+             * @param rowGroupIndices The row groups to split.
+             * @param numberOfBlocks The number of blocks.
+             * @return A vector of size numberOfBlocks + 1 such that block i consists of the row groups [result[i], result[i + 1]).
+             * Blocks may be empty.
+             */
+            std::vector<index_type> getEntryBalancedRowGroupPartition(std::vector<uint64_t> const& rowGroupIndices, uint64_t numberOfBlocks) const;
+
             /*!
             * Returns the cached number of nonzero entries in the matrix.
             *
@@ -892,6 +913,19 @@ namespace storm {
 #ifdef STORM_HAVE_INTELTBB
             void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
 #endif
+
+            /*!
+             * Multiplies the rows in the given range with the given vector and writes the result to the corresponding
+             * positions of the given result vector. Other positions of the result vector are not touched, which allows
+             * to process disjoint row ranges concurrently.
+             *
+             * @param startRow The first row to multiply.
+             * @param endRow The row after the last row to multiply.
+             * @param vector The vector with which to multiply the matrix. It must not be the same as the result vector.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
             
             /*!
              * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
@@ -913,6 +947,24 @@ namespace storm {
             template<typename Compare>
             void multiplyAndReduceForward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
             
+            /*!
+             * Multiplies the rows of the row groups in the given range with the given vector and reduces them according
+             * to the given direction. Only the entries of the result (and choice) vector that correspond to the given row
+             * groups are written, which allows to process disjoint ranges concurrently.
+             *
+             * @param dir The optimization direction for the reduction.
+             * @param rowGroupIndices The row groups for the reduction
+             * @param startRowGroup The first row group to process.
+             * @param endRowGroup The row group after the last row group to process.
+             * @param vector The vector with which to multiply the matrix. It must not be the same as the result vector.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param choices If given, the choices made in the reduction process will be written to this vector.
+             */
+            void multiplyAndReduceRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            template<typename Compare>
+            void multiplyAndReduceRange(std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            
             void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
             template<typename Compare>
             void multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
@@ -0,0 +1,84 @@
+#include "storm/storage/SparseMatrixSimdKernels.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace storage {
+        namespace detail {
+
+            // The kernels read the entries as pairs of doubles, i.e., they rely on the column being stored in the first
+            // and the value in the second eight bytes of each entry.
+            static_assert(sizeof(MatrixEntry<uint_fast64_t, double>) == 2 * sizeof(double), "Unexpected layout of matrix entries.");
+            static_assert(sizeof(uint_fast64_t) == sizeof(double), "Unexpected size of column indices.");
+
+            static double const* getRawEntries(MatrixEntry<uint_fast64_t, double> const* entries) {
+                return reinterpret_cast<double const*>(entries);
+            }
+
+            bool SimdKernels<double>::multiplyWithVectorRange(MatrixEntry<uint_fast64_t, double> const* entries, uint_fast64_t const* rowIndications, uint64_t startRow, uint64_t endRow, std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                switch (storm::utility::simd::getInstructionSet()) {
+                    case storm::utility::simd::InstructionSet::Avx2:
+                        avx2::multiplyWithVectorRange(getRawEntries(entries), rowIndications, startRow, endRow, vector.data(), result.data(), summand ? summand->data() : nullptr);
+                        return true;
+                    case storm::utility::simd::InstructionSet::Avx512:
+                        avx512::multiplyWithVectorRange(getRawEntries(entries), rowIndications, startRow, endRow, vector.data(), result.data(), summand ? summand->data() : nullptr);
+                        return true;
+                    default:
+                        break;
+                }
+#endif
+                return false;
+            }
+
+            bool SimdKernels<double>::multiplyWithVectorBackward(MatrixEntry<uint_fast64_t, double> const* entries, uint_fast64_t const* rowIndications, uint64_t rowCount, std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                switch (storm::utility::simd::getInstructionSet()) {
+                    case storm::utility::simd::InstructionSet::Avx2:
+                        avx2::multiplyWithVectorBackward(getRawEntries(entries), rowIndications, rowCount, vector.data(), result.data(), summand ? summand->data() : nullptr);
+                        return true;
+                    case storm::utility::simd::InstructionSet::Avx512:
+                        avx512::multiplyWithVectorBackward(getRawEntries(entries), rowIndications, rowCount, vector.data(), result.data(), summand ? summand->data() : nullptr);
+                        return true;
+                    default:
+                        break;
+                }
+#endif
+                return false;
+            }
+
+            bool SimdKernels<double>::multiplyAndReduceRange(bool minimize, MatrixEntry<uint_fast64_t, double> const* entries, uint_fast64_t const* rowIndications, std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                switch (storm::utility::simd::getInstructionSet()) {
+                    case storm::utility::simd::InstructionSet::Avx2:
+                        avx2::multiplyAndReduceRange(minimize, getRawEntries(entries), rowIndications, rowGroupIndices.data(), startRowGroup, endRowGroup, vector.data(), summand ? summand->data() : nullptr, result.data(), choices ? choices->data() : nullptr);
+                        return true;
+                    case storm::utility::simd::InstructionSet::Avx512:
+                        avx512::multiplyAndReduceRange(minimize, getRawEntries(entries), rowIndications, rowGroupIndices.data(), startRowGroup, endRowGroup, vector.data(), summand ? summand->data() : nullptr, result.data(), choices ? choices->data() : nullptr);
+                        return true;
+                    default:
+                        break;
+                }
+#endif
+                return false;
+            }
+
+            bool SimdKernels<double>::multiplyAndReduceBackward(bool minimize, MatrixEntry<uint_fast64_t, double> const* entries, uint_fast64_t const* rowIndications, std::vector<uint64_t> const& rowGroupIndices, uint64_t rowGroupCount, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices) {
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                switch (storm::utility::simd::getInstructionSet()) {
+                    case storm::utility::simd::InstructionSet::Avx2:
+                        avx2::multiplyAndReduceBackward(minimize, getRawEntries(entries), rowIndications, rowGroupIndices.data(), rowGroupCount, vector.data(), summand ? summand->data() : nullptr, result.data(), choices ? choices->data() : nullptr);
+                        return true;
+                    case storm::utility::simd::InstructionSet::Avx512:
+                        avx512::multiplyAndReduceBackward(minimize, getRawEntries(entries), rowIndications, rowGroupIndices.data(), rowGroupCount, vector.data(), summand ? summand->data() : nullptr, result.data(), choices ? choices->data() : nullptr);
+                        return true;
+                    default:
+                        break;
+                }
+#endif
+                return false;
+            }
+
+        }
+    }
+}
@@ -0,0 +1,89 @@
+// All includes that are not specific to this instruction set have to precede the target pragma. Otherwise, inline functions
+// of these headers may be emitted with the instruction set enabled and be picked by the linker for other translation units.
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/simd.h"
+
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+
+#define STORM_SIMD_KERNEL_TRANSLATION_UNIT
+#include "storm/storage/SparseMatrixSimdKernels.h"
+
+namespace storm {
+    namespace storage {
+        namespace detail {
+            namespace avx2 {
+
+                namespace {
+                    // Multiplies the entries of a row with the vector, four entries at a time. Two loads yield four
+                    // column-value pairs, which are unpacked into a vector of columns and a vector of values.
+                    struct RowAccumulator {
+                        static inline __m256d accumulate(double const* entries, uint64_t entry, uint64_t entryEnd, double const* vector) {
+                            __m256d sums = _mm256_setzero_pd();
+                            for (; entry + 4 <= entryEnd; entry += 4) {
+                                __m256d firstPairs = _mm256_loadu_pd(entries + 2 * entry);
+                                __m256d secondPairs = _mm256_loadu_pd(entries + 2 * entry + 4);
+                                __m256i columns = _mm256_castpd_si256(_mm256_unpacklo_pd(firstPairs, secondPairs));
+                                __m256d values = _mm256_unpackhi_pd(firstPairs, secondPairs);
+                                sums = _mm256_fmadd_pd(values, _mm256_i64gather_pd(vector, columns, 8), sums);
+                            }
+                            if (entry < entryEnd) {
+                                // Load the remaining (at most three) pairs with masks and only gather the vector entries
+                                // of those columns, such that masked lanes are zero even if the vector holds infinity.
+                                __m256i remainingDoubles = _mm256_set1_epi64x(static_cast<int64_t>(2 * (entryEnd - entry)));
+                                __m256i firstMask = _mm256_cmpgt_epi64(remainingDoubles, _mm256_setr_epi64x(0, 1, 2, 3));
+                                __m256i secondMask = _mm256_cmpgt_epi64(remainingDoubles, _mm256_setr_epi64x(4, 5, 6, 7));
+                                __m256d firstPairs = _mm256_maskload_pd(entries + 2 * entry, firstMask);
+                                __m256d secondPairs = _mm256_maskload_pd(entries + 2 * entry + 4, secondMask);
+                                __m256i columns = _mm256_castpd_si256(_mm256_unpacklo_pd(firstPairs, secondPairs));
+                                __m256d values = _mm256_unpackhi_pd(firstPairs, secondPairs);
+                                // After unpacking, the lanes hold the entries 0, 2, 1 and 3 (relative to the current entry).
+                                __m256i laneMask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<int64_t>(entryEnd - entry)), _mm256_setr_epi64x(0, 2, 1, 3));
+                                __m256d gathered = _mm256_mask_i64gather_pd(_mm256_setzero_pd(), vector, columns, _mm256_castsi256_pd(laneMask), 8);
+                                sums = _mm256_fmadd_pd(values, gathered, sums);
+                            }
+                            return sums;
+                        }
+                    };
+
+                    typedef SimdMatrixKernels<RowAccumulator, storm::utility::ElementLess<double>, storm::utility::ElementGreater<double>> Kernels;
+                }
+
+                void multiplyWithVectorRange(double const* entries, uint_fast64_t const* rowIndications, uint64_t startRow, uint64_t endRow, double const* vector, double* result, double const* summand) {
+                    Kernels::multiplyWithVectorRange(entries, rowIndications, startRow, endRow, vector, result, summand);
+                }
+
+                void multiplyWithVectorBackward(double const* entries, uint_fast64_t const* rowIndications, uint64_t rowCount, double const* vector, double* result, double const* summand) {
+                    Kernels::multiplyWithVectorBackward(entries, rowIndications, rowCount, vector, result, summand);
+                }
+
+                void multiplyAndReduceRange(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    Kernels::multiplyAndReduceRange(minimize, entries, rowIndications, rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+                }
+
+                void multiplyAndReduceBackward(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t rowGroupCount, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    Kernels::multiplyAndReduceBackward(minimize, entries, rowIndications, rowGroupIndices, rowGroupCount, vector, summand, result, choices);
+                }
+
+            }
+        }
+    }
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+// All includes that are not specific to this instruction set have to precede the target pragma. Otherwise, inline functions
+// of these headers may be emitted with the instruction set enabled and be picked by the linker for other translation units.
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/simd.h"
+
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx512f,avx2,fma"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,fma")
+#endif
+
+#define STORM_SIMD_KERNEL_TRANSLATION_UNIT
+#include "storm/storage/SparseMatrixSimdKernels.h"
+
+namespace storm {
+    namespace storage {
+        namespace detail {
+            namespace avx512 {
+
+                namespace {
+                    // Multiplies the entries of a row with the vector, eight entries at a time. Two loads yield eight
+                    // column-value pairs, which are unpacked into a vector of columns and a vector of values. The partial
+                    // sums are folded to four lanes in the end.
+                    struct RowAccumulator {
+                        static inline __m256d accumulate(double const* entries, uint64_t entry, uint64_t entryEnd, double const* vector) {
+                            __m512d sums = _mm512_setzero_pd();
+                            for (; entry + 8 <= entryEnd; entry += 8) {
+                                __m512d firstPairs = _mm512_loadu_pd(entries + 2 * entry);
+                                __m512d secondPairs = _mm512_loadu_pd(entries + 2 * entry + 8);
+                                __m512i columns = _mm512_castpd_si512(_mm512_unpacklo_pd(firstPairs, secondPairs));
+                                __m512d values = _mm512_unpackhi_pd(firstPairs, secondPairs);
+                                sums = _mm512_fmadd_pd(values, _mm512_i64gather_pd(columns, vector, 8), sums);
+                            }
+                            if (entry < entryEnd) {
+                                // Load the remaining (at most seven) pairs with masks and only gather the vector entries
+                                // of those columns, such that masked lanes are zero even if the vector holds infinity.
+                                uint64_t remainingDoubles = 2 * (entryEnd - entry);
+                                __mmask8 firstMask = remainingDoubles >= 8 ? static_cast<__mmask8>(0xff) : static_cast<__mmask8>((1u << remainingDoubles) - 1);
+                                __mmask8 secondMask = remainingDoubles > 8 ? static_cast<__mmask8>((1u << (remainingDoubles - 8)) - 1) : static_cast<__mmask8>(0);
+                                __m512d firstPairs = _mm512_maskz_loadu_pd(firstMask, entries + 2 * entry);
+                                __m512d secondPairs = _mm512_maskz_loadu_pd(secondMask, entries + 2 * entry + 8);
+                                __m512i columns = _mm512_castpd_si512(_mm512_unpacklo_pd(firstPairs, secondPairs));
+                                __m512d values = _mm512_unpackhi_pd(firstPairs, secondPairs);
+                                // After unpacking, the lanes hold the entries 0, 4, 1, 5, 2, 6, 3 and 7 (relative to the current entry).
+                                __mmask8 laneMask = _mm512_cmplt_epu64_mask(_mm512_setr_epi64(0, 4, 1, 5, 2, 6, 3, 7), _mm512_set1_epi64(static_cast<int64_t>(entryEnd - entry)));
+                                __m512d gathered = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), laneMask, columns, vector, 8);
+                                sums = _mm512_fmadd_pd(values, gathered, sums);
+                            }
+                            return _mm256_add_pd(_mm512_castpd512_pd256(sums), _mm512_extractf64x4_pd(sums, 1));
+                        }
+                    };
+
+                    typedef SimdMatrixKernels<RowAccumulator, storm::utility::ElementLess<double>, storm::utility::ElementGreater<double>> Kernels;
+                }
+
+                void multiplyWithVectorRange(double const* entries, uint_fast64_t const* rowIndications, uint64_t startRow, uint64_t endRow, double const* vector, double* result, double const* summand) {
+                    Kernels::multiplyWithVectorRange(entries, rowIndications, startRow, endRow, vector, result, summand);
+                }
+
+                void multiplyWithVectorBackward(double const* entries, uint_fast64_t const* rowIndications, uint64_t rowCount, double const* vector, double* result, double const* summand) {
+                    Kernels::multiplyWithVectorBackward(entries, rowIndications, rowCount, vector, result, summand);
+                }
+
+                void multiplyAndReduceRange(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    Kernels::multiplyAndReduceRange(minimize, entries, rowIndications, rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+                }
+
+                void multiplyAndReduceBackward(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t rowGroupCount, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    Kernels::multiplyAndReduceBackward(minimize, entries, rowIndications, rowGroupIndices, rowGroupCount, vector, summand, result, choices);
+                }
+
+            }
+        }
+    }
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif
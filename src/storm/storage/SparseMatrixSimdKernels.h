@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <vector>
+
+#include "storm/utility/simd.h"
+
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace storm {
+    namespace storage {
+        template<typename IndexType, typename ValueType> class MatrixEntry;
+
+        namespace detail {
+
+            /*!
+             * Provides vectorized versions of the multiplications of SparseMatrix. Each function returns false if there
+             * is no vectorized version for the value type or the selected instruction set (see
+             * storm::utility::simd::getInstructionSet), in which case the caller has to perform the multiplication.
+             */
+            template<typename ValueType>
+            struct SimdKernels {
+                static bool multiplyWithVectorRange(MatrixEntry<uint_fast64_t, ValueType> const*, uint_fast64_t const*, uint64_t, uint64_t, std::vector<ValueType> const&, std::vector<ValueType>&, std::vector<ValueType> const*) {
+                    return false;
+                }
+
+                static bool multiplyWithVectorBackward(MatrixEntry<uint_fast64_t, ValueType> const*, uint_fast64_t const*, uint64_t, std::vector<ValueType> const&, std::vector<ValueType>&, std::vector<ValueType> const*) {
+                    return false;
+                }
+
+                static bool multiplyAndReduceRange(bool, MatrixEntry<uint_fast64_t, ValueType> const*, uint_fast64_t const*, std::vector<uint64_t> const&, uint64_t, uint64_t, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, std::vector<uint_fast64_t>*) {
+                    return false;
+                }
+
+                static bool multiplyAndReduceBackward(bool, MatrixEntry<uint_fast64_t, ValueType> const*, uint_fast64_t const*, std::vector<uint64_t> const&, uint64_t, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, std::vector<uint_fast64_t>*) {
+                    return false;
+                }
+            };
+
+            template<>
+            struct SimdKernels<double> {
+                static bool multiplyWithVectorRange(MatrixEntry<uint_fast64_t, double> const* entries, uint_fast64_t const* rowIndications, uint64_t startRow, uint64_t endRow, std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand);
+                static bool multiplyWithVectorBackward(MatrixEntry<uint_fast64_t, double> const* entries, uint_fast64_t const* rowIndications, uint64_t rowCount, std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand);
+                static bool multiplyAndReduceRange(bool minimize, MatrixEntry<uint_fast64_t, double> const* entries, uint_fast64_t const* rowIndications, std::vector<uint64_t> const& rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices);
+                static bool multiplyAndReduceBackward(bool minimize, MatrixEntry<uint_fast64_t, double> const* entries, uint_fast64_t const* rowIndications, std::vector<uint64_t> const& rowGroupIndices, uint64_t rowGroupCount, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices);
+            };
+
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+
+            // The vectorized kernels for the entries of a SparseMatrix<double>. They operate on the raw entry array, in
+            // which the column (as a 64-bit integer) and the value of each entry are stored next to each other. Each
+            // instruction set has its own translation unit in which these functions are defined.
+            namespace avx2 {
+                void multiplyWithVectorRange(double const* entries, uint_fast64_t const* rowIndications, uint64_t startRow, uint64_t endRow, double const* vector, double* result, double const* summand);
+                void multiplyWithVectorBackward(double const* entries, uint_fast64_t const* rowIndications, uint64_t rowCount, double const* vector, double* result, double const* summand);
+                void multiplyAndReduceRange(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, double const* vector, double const* summand, double* result, uint_fast64_t* choices);
+                void multiplyAndReduceBackward(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t rowGroupCount, double const* vector, double const* summand, double* result, uint_fast64_t* choices);
+            }
+
+            namespace avx512 {
+                void multiplyWithVectorRange(double const* entries, uint_fast64_t const* rowIndications, uint64_t startRow, uint64_t endRow, double const* vector, double* result, double const* summand);
+                void multiplyWithVectorBackward(double const* entries, uint_fast64_t const* rowIndications, uint64_t rowCount, double const* vector, double* result, double const* summand);
+                void multiplyAndReduceRange(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, double const* vector, double const* summand, double* result, uint_fast64_t* choices);
+                void multiplyAndReduceBackward(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t rowGroupCount, double const* vector, double const* summand, double* result, uint_fast64_t* choices);
+            }
+
+#ifdef STORM_SIMD_KERNEL_TRANSLATION_UNIT
+            // The following templates are only instantiated in the translation units of the kernels, where the respective
+            // instruction set is enabled for all functions. The RowAccumulator multiplies the entries of one row with the
+            // vector and returns the four partial sums of the row.
+            template<typename RowAccumulator, typename Less, typename Greater>
+            struct SimdMatrixKernels {
+
+                // Retrieves a mask that selects the first count (at most four) lanes.
+                static inline __m256i firstLanes(uint64_t count) {
+                    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<int64_t>(count)), _mm256_setr_epi64x(0, 1, 2, 3));
+                }
+
+                static inline double horizontalSum(__m256d sums) {
+                    __m128d halfSums = _mm_add_pd(_mm256_castpd256_pd128(sums), _mm256_extractf128_pd(sums, 1));
+                    return _mm_cvtsd_f64(_mm_add_sd(halfSums, _mm_unpackhi_pd(halfSums, halfSums)));
+                }
+
+                static inline double horizontalMinimum(__m256d values) {
+                    __m128d halfValues = _mm_min_pd(_mm256_castpd256_pd128(values), _mm256_extractf128_pd(values, 1));
+                    return _mm_cvtsd_f64(_mm_min_sd(halfValues, _mm_unpackhi_pd(halfValues, halfValues)));
+                }
+
+                static inline double horizontalMaximum(__m256d values) {
+                    __m128d halfValues = _mm_max_pd(_mm256_castpd256_pd128(values), _mm256_extractf128_pd(values, 1));
+                    return _mm_cvtsd_f64(_mm_max_sd(halfValues, _mm_unpackhi_pd(halfValues, halfValues)));
+                }
+
+                static inline double multiplyRow(double const* entries, uint_fast64_t const* rowIndications, uint64_t row, double const* vector, double const* summand) {
+                    double result = horizontalSum(RowAccumulator::accumulate(entries, rowIndications[row], rowIndications[row + 1], vector));
+                    return summand ? summand[row] + result : result;
+                }
+
+                // Multiplies the given number (at most four) of consecutive rows with the vector. The result of the i-th
+                // row is placed in the i-th lane, all other lanes are zero. The partial sums of the rows are transposed
+                // and added in registers, so there is only one horizontal reduction for four rows.
+                static inline __m256d multiplyRows(double const* entries, uint_fast64_t const* rowIndications, uint64_t row, uint64_t count, double const* vector) {
+                    __m256d zero = _mm256_setzero_pd();
+                    __m256d first = RowAccumulator::accumulate(entries, rowIndications[row], rowIndications[row + 1], vector);
+                    __m256d second = count > 1 ? RowAccumulator::accumulate(entries, rowIndications[row + 1], rowIndications[row + 2], vector) : zero;
+                    __m256d third = count > 2 ? RowAccumulator::accumulate(entries, rowIndications[row + 2], rowIndications[row + 3], vector) : zero;
+                    __m256d fourth = count > 3 ? RowAccumulator::accumulate(entries, rowIndications[row + 3], rowIndications[row + 4], vector) : zero;
+
+                    __m256d firstAndSecond = _mm256_hadd_pd(first, second);
+                    __m256d thirdAndFourth = _mm256_hadd_pd(third, fourth);
+                    return _mm256_add_pd(_mm256_permute2f128_pd(firstAndSecond, thirdAndFourth, 0x20), _mm256_permute2f128_pd(firstAndSecond, thirdAndFourth, 0x31));
+                }
+
+                static void multiplyWithVectorRange(double const* entries, uint_fast64_t const* rowIndications, uint64_t startRow, uint64_t endRow, double const* vector, double* result, double const* summand) {
+                    if (vector == result) {
+                        // Each row has to see the results of the previous rows, so we cannot combine rows.
+                        for (uint64_t row = startRow; row < endRow; ++row) {
+                            result[row] = multiplyRow(entries, rowIndications, row, vector, summand);
+                        }
+                        return;
+                    }
+
+                    uint64_t row = startRow;
+                    for (; row + 4 <= endRow; row += 4) {
+                        __m256d rowResults = multiplyRows(entries, rowIndications, row, 4, vector);
+                        if (summand) {
+                            rowResults = _mm256_add_pd(_mm256_loadu_pd(summand + row), rowResults);
+                        }
+                        _mm256_storeu_pd(result + row, rowResults);
+                    }
+                    if (row < endRow) {
+                        __m256i mask = firstLanes(endRow - row);
+                        __m256d rowResults = multiplyRows(entries, rowIndications, row, endRow - row, vector);
+                        if (summand) {
+                            rowResults = _mm256_add_pd(_mm256_maskload_pd(summand + row, mask), rowResults);
+                        }
+                        _mm256_maskstore_pd(result + row, mask, rowResults);
+                    }
+                }
+
+                static void multiplyWithVectorBackward(double const* entries, uint_fast64_t const* rowIndications, uint64_t rowCount, double const* vector, double* result, double const* summand) {
+                    for (uint64_t row = rowCount; row > 0;) {
+                        --row;
+                        result[row] = multiplyRow(entries, rowIndications, row, vector, summand);
+                    }
+                }
+
+                // Reduces the rows of a row group to their minimum (or maximum). Blocks of four rows are multiplied at once
+                // and the reduction is carried out on the vector registers.
+                static inline double reduceRowGroup(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t firstRow, uint64_t endRow, double const* vector, double const* summand) {
+                    __m256d neutral = _mm256_set1_pd(minimize ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity());
+                    __m256d best = neutral;
+                    for (uint64_t row = firstRow; row < endRow; row += 4) {
+                        uint64_t count = endRow - row < 4 ? endRow - row : 4;
+                        __m256i mask = firstLanes(count);
+                        __m256d rowResults = multiplyRows(entries, rowIndications, row, count, vector);
+                        if (summand) {
+                            rowResults = _mm256_add_pd(_mm256_maskload_pd(summand + row, mask), rowResults);
+                        }
+                        rowResults = _mm256_blendv_pd(neutral, rowResults, _mm256_castsi256_pd(mask));
+                        best = minimize ? _mm256_min_pd(best, rowResults) : _mm256_max_pd(best, rowResults);
+                    }
+                    return minimize ? horizontalMinimum(best) : horizontalMaximum(best);
+                }
+
+                // Reduces the rows of a row group and updates the choice of the group. As in SparseMatrix, the choice is
+                // only changed if the new choice is strictly better than the old one.
+                template<typename Compare>
+                static inline double reduceRowGroupWithChoice(double const* entries, uint_fast64_t const* rowIndications, uint64_t firstRow, uint64_t endRow, bool backward, double const* vector, double const* summand, uint_fast64_t& choice) {
+                    Compare compare;
+                    uint64_t row = backward ? endRow - 1 : firstRow;
+                    double currentValue = multiplyRow(entries, rowIndications, row, vector, summand);
+                    uint64_t selectedChoice = row - firstRow;
+                    double oldSelectedChoiceValue = currentValue;
+                    for (uint64_t i = firstRow + 1; i < endRow; ++i) {
+                        row = backward ? row - 1 : row + 1;
+                        double newValue = multiplyRow(entries, rowIndications, row, vector, summand);
+                        if (row == choice + firstRow) {
+                            oldSelectedChoiceValue = newValue;
+                        }
+                        if (compare(newValue, currentValue)) {
+                            currentValue = newValue;
+                            selectedChoice = row - firstRow;
+                        }
+                    }
+                    if (compare(currentValue, oldSelectedChoiceValue)) {
+                        choice = selectedChoice;
+                    }
+                    return currentValue;
+                }
+
+                static inline void reduceRowGroup(bool minimize, bool backward, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t group, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    uint64_t const firstRow = rowGroupIndices[group];
+                    uint64_t const endRow = rowGroupIndices[group + 1];
+
+                    // Only multiply and reduce if there is at least one row in the group.
+                    if (firstRow == endRow) {
+                        return;
+                    }
+
+                    if (!choices) {
+                        result[group] = reduceRowGroup(minimize, entries, rowIndications, firstRow, endRow, vector, summand);
+                    } else if (minimize) {
+                        result[group] = reduceRowGroupWithChoice<Less>(entries, rowIndications, firstRow, endRow, backward, vector, summand, choices[group]);
+                    } else {
+                        result[group] = reduceRowGroupWithChoice<Greater>(entries, rowIndications, firstRow, endRow, backward, vector, summand, choices[group]);
+                    }
+                }
+
+                static void multiplyAndReduceRange(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t startRowGroup, uint64_t endRowGroup, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    for (uint64_t group = startRowGroup; group < endRowGroup; ++group) {
+                        reduceRowGroup(minimize, false, entries, rowIndications, rowGroupIndices, group, vector, summand, result, choices);
+                    }
+                }
+
+                static void multiplyAndReduceBackward(bool minimize, double const* entries, uint_fast64_t const* rowIndications, uint64_t const* rowGroupIndices, uint64_t rowGroupCount, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    for (uint64_t group = rowGroupCount; group > 0;) {
+                        --group;
+                        reduceRowGroup(minimize, true, entries, rowIndications, rowGroupIndices, group, vector, summand, result, choices);
+                    }
+                }
+            };
+#endif
+#endif
+
+        }
+    }
+}
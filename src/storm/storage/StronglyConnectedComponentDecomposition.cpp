@@ -1,10 +1,20 @@
 #include <storm/utility/vector.h>
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -152,6 +162,326 @@ namespace storm {
             }
         }
 
+        /*!
+         * Computes a mapping of states to their SCCs using multiple threads. The considered transitions are first
+         * collected in a forward and a backward adjacency structure, which is the only step that accesses the values
+         * of the matrix. The states are then decomposed with the forward-backward algorithm (Fleischer/Hendrickson/Pinar,
+         * "On identifying strongly connected components in parallel"): A set of states that is a union of SCCs is
+         * taken by one of the threads, which first removes all states without predecessors or without successors in the
+         * set as singleton SCCs (trimming). For the remaining states, the SCC of a pivot state is the intersection of the
+         * states reachable from the pivot and the states that reach the pivot. The states that are only reachable from the
+         * pivot, the states that only reach the pivot and all other states of the set form three new sets that can be
+         * decomposed independently. Each set is identified by a color that is stored for each of its states.
+         * As the SCCs are found in no particular order, a topological sort and the SCC depths are computed afterwards on
+         * the graph of SCCs.
+         *
+         * @param transitionMatrix The transition matrix of the system to decompose.
+         * @param options The options of the decomposition.
+         * @param numberOfThreads The number of threads to use.
+         * @param nonTrivialStates A bit vector where entries for non-trivial states will be set to true.
+         * @param stateToSccMapping A mapping from states to the SCC indices they belong to which is filled by this function.
+         * @param sccDepths If given, the depths of the SCCs are inserted into this vector.
+         * @return The number of SCCs.
+         */
+        template <typename ValueType>
+        uint_fast64_t performParallelSccDecompositionFB(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options, uint64_t numberOfThreads, storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& stateToSccMapping, std::vector<uint_fast64_t>* sccDepths) {
+            uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            storm::storage::BitVector const* subsystem = options.subsystemPtr;
+            storm::storage::BitVector const* choices = options.choicesPtr;
+            
+            // Collect the considered transitions.
+            std::vector<uint64_t> consideredStates;
+            std::vector<uint64_t> successorStarts(numberOfStates + 1, 0);
+            std::vector<uint64_t> successors;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (!subsystem || subsystem->get(state)) {
+                    consideredStates.push_back(state);
+                    for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+                        if (choices && !choices->get(row)) {
+                            continue;
+                        }
+                        for (auto const& successor : transitionMatrix.getRow(row)) {
+                            if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                                if (state == successor.getColumn()) {
+                                    nonTrivialStates.set(state, true);
+                                }
+                                successors.push_back(successor.getColumn());
+                            }
+                        }
+                    }
+                }
+                successorStarts[state + 1] = successors.size();
+            }
+            std::vector<uint64_t> predecessorStarts(numberOfStates + 1, 0);
+            for (auto const& successor : successors) {
+                ++predecessorStarts[successor + 1];
+            }
+            std::partial_sum(predecessorStarts.begin(), predecessorStarts.end(), predecessorStarts.begin());
+            std::vector<uint64_t> predecessors(successors.size());
+            {
+                std::vector<uint64_t> positions(predecessorStarts.begin(), predecessorStarts.end() - 1);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    for (uint64_t index = successorStarts[state]; index < successorStarts[state + 1]; ++index) {
+                        predecessors[positions[successors[index]]++] = state;
+                    }
+                }
+            }
+            
+            // States that are not considered or that are already assigned to an SCC have no color. Colors of states are
+            // only changed by the thread that decomposes the set of the state, but they are read by threads that
+            // decompose the sets of neighbouring states.
+            uint64_t const noColor = std::numeric_limits<uint64_t>::max();
+            std::unique_ptr<std::atomic<uint64_t>[]> colors(new std::atomic<uint64_t>[numberOfStates]);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                colors[state].store(noColor, std::memory_order_relaxed);
+            }
+            for (auto const& state : consideredStates) {
+                colors[state].store(0, std::memory_order_relaxed);
+            }
+            auto hasColor = [&colors] (uint64_t state, uint64_t color) {
+                return colors[state].load(std::memory_order_relaxed) == color;
+            };
+            auto setColor = [&colors] (uint64_t state, uint64_t color) {
+                colors[state].store(color, std::memory_order_relaxed);
+            };
+            std::atomic<uint64_t> nextColor(1);
+            std::atomic<uint64_t> nextScc(0);
+            
+            // The SCC indices assigned here are not yet sorted topologically.
+            std::vector<uint64_t> unsortedStateToScc(numberOfStates);
+            std::vector<uint64_t> inDegrees(numberOfStates);
+            std::vector<uint64_t> outDegrees(numberOfStates);
+            
+            typedef std::pair<uint64_t, std::vector<uint64_t>> ColoredSet;
+            auto decomposeSet = [&] (ColoredSet const& set, std::vector<uint64_t>& stack, std::vector<ColoredSet>& newSets) {
+                uint64_t color = set.first;
+                std::vector<uint64_t> const& states = set.second;
+                
+                // Trim the set, i.e., repeatedly remove states without predecessors or without successors in the set.
+                STORM_LOG_ASSERT(stack.empty(), "Expected an empty stack.");
+                for (auto const& state : states) {
+                    uint64_t outDegree = 0;
+                    for (uint64_t index = successorStarts[state]; index < successorStarts[state + 1]; ++index) {
+                        if (hasColor(successors[index], color)) {
+                            ++outDegree;
+                        }
+                    }
+                    uint64_t inDegree = 0;
+                    for (uint64_t index = predecessorStarts[state]; index < predecessorStarts[state + 1]; ++index) {
+                        if (hasColor(predecessors[index], color)) {
+                            ++inDegree;
+                        }
+                    }
+                    outDegrees[state] = outDegree;
+                    inDegrees[state] = inDegree;
+                    if (outDegree == 0 || inDegree == 0) {
+                        stack.push_back(state);
+                    }
+                }
+                while (!stack.empty()) {
+                    uint64_t state = stack.back();
+                    stack.pop_back();
+                    // A state might be put on the stack twice.
+                    if (!hasColor(state, color)) {
+                        continue;
+                    }
+                    setColor(state, noColor);
+                    unsortedStateToScc[state] = nextScc++;
+                    for (uint64_t index = successorStarts[state]; index < successorStarts[state + 1]; ++index) {
+                        uint64_t successor = successors[index];
+                        if (hasColor(successor, color) && --inDegrees[successor] == 0) {
+                            stack.push_back(successor);
+                        }
+                    }
+                    for (uint64_t index = predecessorStarts[state]; index < predecessorStarts[state + 1]; ++index) {
+                        uint64_t predecessor = predecessors[index];
+                        if (hasColor(predecessor, color) && --outDegrees[predecessor] == 0) {
+                            stack.push_back(predecessor);
+                        }
+                    }
+                }
+                
+                auto pivotIt = std::find_if(states.begin(), states.end(), [&hasColor, color] (uint64_t state) { return hasColor(state, color); });
+                if (pivotIt == states.end()) {
+                    return;
+                }
+                uint64_t pivot = *pivotIt;
+                uint64_t forwardColor = nextColor++;
+                uint64_t backwardColor = nextColor++;
+                
+                // Find the states reachable from the pivot.
+                setColor(pivot, forwardColor);
+                stack.push_back(pivot);
+                while (!stack.empty()) {
+                    uint64_t state = stack.back();
+                    stack.pop_back();
+                    for (uint64_t index = successorStarts[state]; index < successorStarts[state + 1]; ++index) {
+                        uint64_t successor = successors[index];
+                        if (hasColor(successor, color)) {
+                            setColor(successor, forwardColor);
+                            stack.push_back(successor);
+                        }
+                    }
+                }
+                
+                // Find the states that reach the pivot. Those that are also reachable from the pivot form its SCC.
+                uint64_t pivotScc = nextScc++;
+                setColor(pivot, noColor);
+                unsortedStateToScc[pivot] = pivotScc;
+                stack.push_back(pivot);
+                while (!stack.empty()) {
+                    uint64_t state = stack.back();
+                    stack.pop_back();
+                    for (uint64_t index = predecessorStarts[state]; index < predecessorStarts[state + 1]; ++index) {
+                        uint64_t predecessor = predecessors[index];
+                        uint64_t predecessorColor = colors[predecessor].load(std::memory_order_relaxed);
+                        if (predecessorColor == forwardColor) {
+                            setColor(predecessor, noColor);
+                            unsortedStateToScc[predecessor] = pivotScc;
+                            stack.push_back(predecessor);
+                        } else if (predecessorColor == color) {
+                            setColor(predecessor, backwardColor);
+                            stack.push_back(predecessor);
+                        }
+                    }
+                }
+                
+                // Split the remaining states into the three new sets.
+                std::vector<uint64_t> forwardStates, backwardStates, remainingStates;
+                for (auto const& state : states) {
+                    uint64_t stateColor = colors[state].load(std::memory_order_relaxed);
+                    if (stateColor == forwardColor) {
+                        forwardStates.push_back(state);
+                    } else if (stateColor == backwardColor) {
+                        backwardStates.push_back(state);
+                    } else if (stateColor == color) {
+                        remainingStates.push_back(state);
+                    }
+                }
+                if (!forwardStates.empty()) {
+                    newSets.emplace_back(forwardColor, std::move(forwardStates));
+                }
+                if (!backwardStates.empty()) {
+                    newSets.emplace_back(backwardColor, std::move(backwardStates));
+                }
+                if (!remainingStates.empty()) {
+                    newSets.emplace_back(color, std::move(remainingStates));
+                }
+            };
+            
+            // The threads take the sets that still need to be decomposed from a shared stack. They are done once the stack
+            // is empty and no thread is decomposing a set (which might create new ones).
+            std::vector<ColoredSet> pendingSets;
+            if (!consideredStates.empty()) {
+                pendingSets.emplace_back(0, consideredStates);
+            }
+            std::mutex mutex;
+            std::condition_variable condition;
+            uint64_t numberOfBusyThreads = 0;
+            bool aborted = false;
+            storm::utility::parallel::runOnThreads(numberOfThreads, [&] (uint64_t) {
+                std::vector<uint64_t> stack;
+                std::vector<ColoredSet> newSets;
+                while (true) {
+                    ColoredSet set;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        condition.wait(lock, [&] { return aborted || !pendingSets.empty() || numberOfBusyThreads == 0; });
+                        if (aborted || pendingSets.empty()) {
+                            break;
+                        }
+                        set = std::move(pendingSets.back());
+                        pendingSets.pop_back();
+                        ++numberOfBusyThreads;
+                    }
+                    try {
+                        decomposeSet(set, stack, newSets);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        aborted = true;
+                        condition.notify_all();
+                        throw;
+                    }
+                    std::lock_guard<std::mutex> lock(mutex);
+                    --numberOfBusyThreads;
+                    for (auto& newSet : newSets) {
+                        pendingSets.push_back(std::move(newSet));
+                    }
+                    newSets.clear();
+                    condition.notify_all();
+                }
+            });
+            
+            // Collect the states of each SCC.
+            uint_fast64_t sccCount = nextScc.load();
+            std::vector<uint64_t> sccStarts(sccCount + 1, 0);
+            for (auto const& state : consideredStates) {
+                ++sccStarts[unsortedStateToScc[state] + 1];
+            }
+            std::partial_sum(sccStarts.begin(), sccStarts.end(), sccStarts.begin());
+            std::vector<uint64_t> sccStates(consideredStates.size());
+            {
+                std::vector<uint64_t> positions(sccStarts.begin(), sccStarts.end() - 1);
+                for (auto const& state : consideredStates) {
+                    sccStates[positions[unsortedStateToScc[state]]++] = state;
+                }
+            }
+            
+            // Sort the SCCs such that every SCC comes after all SCCs reachable from it, which is also the order produced
+            // by the sequential algorithm. For this, an SCC is appended once all its successor SCCs have been appended.
+            std::vector<uint64_t> remainingSuccessorCounts(sccCount, 0);
+            for (auto const& state : consideredStates) {
+                for (uint64_t index = successorStarts[state]; index < successorStarts[state + 1]; ++index) {
+                    if (unsortedStateToScc[successors[index]] != unsortedStateToScc[state]) {
+                        ++remainingSuccessorCounts[unsortedStateToScc[state]];
+                    }
+                }
+            }
+            std::vector<uint64_t> sortedSccs;
+            sortedSccs.reserve(sccCount);
+            for (uint64_t scc = 0; scc < sccCount; ++scc) {
+                if (remainingSuccessorCounts[scc] == 0) {
+                    sortedSccs.push_back(scc);
+                }
+            }
+            std::vector<uint64_t> unsortedSccDepths(sccCount, 0);
+            for (uint64_t position = 0; position < sortedSccs.size(); ++position) {
+                uint64_t scc = sortedSccs[position];
+                for (uint64_t sccStateIndex = sccStarts[scc]; sccStateIndex < sccStarts[scc + 1]; ++sccStateIndex) {
+                    uint64_t state = sccStates[sccStateIndex];
+                    for (uint64_t index = predecessorStarts[state]; index < predecessorStarts[state + 1]; ++index) {
+                        uint64_t predecessorScc = unsortedStateToScc[predecessors[index]];
+                        if (predecessorScc != scc) {
+                            unsortedSccDepths[predecessorScc] = std::max(unsortedSccDepths[predecessorScc], unsortedSccDepths[scc] + 1);
+                            if (--remainingSuccessorCounts[predecessorScc] == 0) {
+                                sortedSccs.push_back(predecessorScc);
+                            }
+                        }
+                    }
+                }
+            }
+            STORM_LOG_ASSERT(sortedSccs.size() == sccCount, "Unable to sort the SCCs topologically.");
+            
+            std::vector<uint64_t> sccToSortedScc(sccCount);
+            for (uint64_t position = 0; position < sccCount; ++position) {
+                sccToSortedScc[sortedSccs[position]] = position;
+            }
+            for (auto const& state : consideredStates) {
+                uint64_t scc = unsortedStateToScc[state];
+                stateToSccMapping[state] = sccToSortedScc[scc];
+                if (sccStarts[scc + 1] - sccStarts[scc] > 1) {
+                    nonTrivialStates.set(state, true);
+                }
+            }
+            if (sccDepths) {
+                sccDepths->resize(sccCount);
+                for (uint64_t position = 0; position < sccCount; ++position) {
+                    (*sccDepths)[position] = unsortedSccDepths[sortedSccs[position]];
+                }
+            }
+            return sccCount;
+        }
+
         template <typename ValueType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options) {
             
@@ -165,7 +495,19 @@ namespace storm {
             
             // Obtain a mapping from states to the SCC it belongs to
             std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-            {
+            
+            // Store scc depths if requested
+            std::vector<uint_fast64_t>* sccDepthsPtr = nullptr;
+            sccDepths = boost::none;
+            if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+                sccDepths = std::vector<uint_fast64_t>();
+                sccDepthsPtr = &sccDepths.get();
+            }
+            
+            uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(options.threadCount);
+            if (numberOfThreads > 1) {
+                sccCount = performParallelSccDecompositionFB(transitionMatrix, options, numberOfThreads, nonTrivialStates, stateToSccMapping, sccDepthsPtr);
+            } else {
             
                 // Set up the environment of the algorithm.
                 // Start with the two stacks it maintains.
@@ -182,15 +524,6 @@ namespace storm {
                 storm::storage::BitVector hasPreorderNumber(numberOfStates);
                 storm::storage::BitVector stateHasScc(numberOfStates);
                 
-                // Store scc depths if requested
-                std::vector<uint_fast64_t>* sccDepthsPtr = nullptr;
-                sccDepths = boost::none;
-                if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
-                    sccDepths = std::vector<uint_fast64_t>();
-                    sccDepthsPtr = &sccDepths.get();
-                }
-
-                
                 // Start the search for SCCs from every state in the block.
                 uint_fast64_t currentIndex = 0;
                 if (options.subsystemPtr) {
@@ -248,6 +581,11 @@ namespace storm {
             return sccDepths.get()[sccIndex];
         }
         
+        template <typename ValueType>
+        bool StronglyConnectedComponentDecomposition<ValueType>::hasSccDepths() const {
+            return sccDepths.is_initialized();
+        }
+        
         template <typename ValueType>
         uint_fast64_t StronglyConnectedComponentDecomposition<ValueType>::getMaxSccDepth() const {
             STORM_LOG_THROW(sccDepths.is_initialized(), storm::exceptions::InvalidOperationException, "Tried to get the maximum SCC depth but SCC depths were not computed upon construction.");
@@ -31,6 +31,8 @@ namespace storm {
             StronglyConnectedComponentDecompositionOptions& forceTopologicalSort(bool value = true) { isTopologicalSortForced = value; return *this; }
             /// Sets if scc depths can be retrieved.
             StronglyConnectedComponentDecompositionOptions& computeSccDepths(bool value = true) { isComputeSccDepthsSet = value; return *this; }
+            /// Sets the number of threads used for the decomposition (zero refers to the number of hardware threads).
+            StronglyConnectedComponentDecompositionOptions& numberOfThreads(uint64_t value) { threadCount = value; return *this; }
             
             storm::storage::BitVector const* subsystemPtr = nullptr;
             storm::storage::BitVector const* choicesPtr = nullptr;
@@ -38,6 +40,7 @@ namespace storm {
             bool areOnlyBottomSccsConsidered = false;
             bool isTopologicalSortForced = false;
             bool isComputeSccDepthsSet = false;
+            uint64_t threadCount = 1;
             
         };
         
@@ -104,6 +107,11 @@ namespace storm {
              */
             uint_fast64_t getMaxSccDepth() const;
             
+            /*!
+             * Retrieves whether the SCC depths have been computed upon construction.
+             */
+            bool hasSccDepths() const;
+            
         private:
             /*
              * Performs the SCC decomposition of the given block in the given model. As a side-effect this fills
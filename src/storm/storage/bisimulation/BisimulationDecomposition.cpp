@@ -1,10 +1,12 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
+#include <atomic>
 #include <chrono>
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidOptionException.h"
+#include "storm/exceptions/NotImplementedException.h"
 
 #include "storm/logic/FormulaInformation.h"
 #include "storm/logic/FragmentSpecification.h"
@@ -19,11 +21,14 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/BisimulationSettings.h"
 
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace storage {
@@ -50,8 +55,12 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
-            // Intentionally left empty.
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), signatureRefinement(false), numberOfThreads(0), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+            if (storm::settings::hasModule<storm::settings::modules::BisimulationSettings>()) {
+                auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+                signatureRefinement = bisimulationSettings.getSparseRefinementMode() == storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+                numberOfThreads = bisimulationSettings.getNumberOfThreads();
+            }
         }
         
         template<typename ModelType, typename BlockDataType>
@@ -234,6 +243,14 @@ namespace storm {
         
         template<typename ModelType, typename BlockDataType>
         void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+            if (options.signatureRefinement) {
+                if (this->supportsSignatureRefinement()) {
+                    this->performSignatureRefinement();
+                    return;
+                }
+                STORM_LOG_WARN("Signature-based refinement is not supported for this kind of bisimulation. Falling back to splitter-based refinement.");
+            }
+            
             // Insert all blocks into the splitter queue as a (potential) splitter.
             std::vector<Block<BlockDataType>*> splitterQueue;
             std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&] (std::unique_ptr<Block<BlockDataType>> const& block) { block->data().setSplitter(); splitterQueue.push_back(block.get()); } );
@@ -262,6 +279,87 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+            // As the arithmetic of exact values is not thread-safe, we only use multiple threads for floating point values.
+            uint64_t numberOfThreads = storm::NumberTraits<ValueType>::IsExact ? 1 : storm::utility::parallel::getNumberOfThreads(options.numberOfThreads);
+            uint64_t numberOfStates = model.getNumberOfStates();
+            auto signatureLess = [this] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) { return this->signatureLess(state1, state2); };
+            
+            uint_fast64_t iterations = 0;
+            bool changed = true;
+            while (changed) {
+                ++iterations;
+                changed = false;
+                
+                // Compute the signatures of all states with respect to the current partition.
+                uint64_t statesPerThread = (numberOfStates + numberOfThreads - 1) / numberOfThreads;
+                storm::utility::parallel::runOnThreads(numberOfThreads, [&] (uint64_t threadIndex) {
+                    storm::storage::sparse::state_type firstState = std::min(numberOfStates, threadIndex * statesPerThread);
+                    storm::storage::sparse::state_type lastState = std::min(numberOfStates, firstState + statesPerThread);
+                    this->computeSignatures(firstState, lastState);
+                });
+                
+                // Sort the states of each block by their signatures and determine the ranges of equal signatures. As
+                // the blocks occupy disjoint ranges of the partition, they can be sorted concurrently. Large blocks are
+                // handed out first to balance the load.
+                std::vector<Block<BlockDataType>*> blocksToRefine;
+                for (auto const& block : partition.getBlocks()) {
+                    if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                        blocksToRefine.push_back(block.get());
+                    }
+                }
+                std::sort(blocksToRefine.begin(), blocksToRefine.end(), [] (Block<BlockDataType> const* b1, Block<BlockDataType> const* b2) { return b1->getNumberOfStates() > b2->getNumberOfStates(); } );
+                std::vector<std::vector<uint_fast64_t>> splitPositions(blocksToRefine.size());
+                std::atomic<uint64_t> nextBlock(0);
+                storm::utility::parallel::runOnThreads(std::min<uint64_t>(numberOfThreads, std::max<uint64_t>(blocksToRefine.size(), 1)), [&] (uint64_t) {
+                    for (uint64_t blockIndex = nextBlock++; blockIndex < blocksToRefine.size(); blockIndex = nextBlock++) {
+                        Block<BlockDataType>& block = *blocksToRefine[blockIndex];
+                        partition.sortBlock(block, signatureLess);
+                        splitPositions[blockIndex] = partition.computeRangesOfEqualValue(block.getBeginIndex(), block.getEndIndex(), signatureLess);
+                    }
+                });
+                
+                // Finally, split the blocks. The positions of a block are increasing, so the remaining part of the block
+                // always starts at the current split position.
+                for (uint64_t blockIndex = 0; blockIndex < blocksToRefine.size(); ++blockIndex) {
+                    Block<BlockDataType>& block = *blocksToRefine[blockIndex];
+                    std::vector<uint_fast64_t> const& positions = splitPositions[blockIndex];
+                    for (uint64_t positionIndex = 1; positionIndex + 1 < positions.size(); ++positionIndex) {
+                        auto result = partition.splitBlock(block, positions[positionIndex]);
+                        if (result.second) {
+                            changed = true;
+                            
+                            // Keep track of whether this is a block with reward states.
+                            (*result.first)->data().setHasRewards(block.data().hasRewards());
+                        }
+                    }
+                }
+                STORM_LOG_TRACE("Partition has " << partition.size() << " blocks after " << iterations << " rounds of signature refinement.");
+                
+                if (storm::utility::resources::isTerminate()) {
+                    std::cout << "Performed " << iterations << " rounds of signature refinement before abort." << std::endl;
+                    STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+                }
+            }
+            STORM_LOG_DEBUG("Signature refinement converged after " << iterations << " rounds with " << partition.size() << " blocks.");
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        bool BisimulationDecomposition<ModelType, BlockDataType>::supportsSignatureRefinement() const {
+            return false;
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::computeSignatures(storm::storage::sparse::state_type, storm::storage::sparse::state_type) {
+            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Signature-based refinement is not implemented for this kind of bisimulation.");
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        bool BisimulationDecomposition<ModelType, BlockDataType>::signatureLess(storm::storage::sparse::state_type, storm::storage::sparse::state_type) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Signature-based refinement is not implemented for this kind of bisimulation.");
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
@@ -128,6 +128,14 @@ namespace storm {
                 /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
                 bool buildQuotient;
                 
+                /// A flag that indicates whether the partition is refined with respect to the signatures of all states
+                /// in rounds rather than with respect to one splitter at a time. Both yield the same partition.
+                bool signatureRefinement;
+                
+                /// The number of threads used by the signature-based refinement (zero refers to the number of hardware
+                /// threads).
+                uint64_t numberOfThreads;
+                
             private:
                 boost::optional<OptimizationDirection> optimalityType;
                 
@@ -209,6 +217,35 @@ namespace storm {
              */
             void performPartitionRefinement();
             
+            /*!
+             * Performs the partition refinement based on signatures. In each round, the signatures of all states with
+             * respect to the current partition are computed and every block is split into the classes of states with
+             * equal signatures. This is repeated until no block is split anymore. Computing the signatures and
+             * splitting the blocks is distributed among multiple threads.
+             */
+            void performSignatureRefinement();
+            
+            /*!
+             * Retrieves whether the signature-based refinement supports the kind of bisimulation that is computed.
+             */
+            virtual bool supportsSignatureRefinement() const;
+            
+            /*!
+             * Computes the signatures of the states in the given range with respect to the current partition. This is
+             * called concurrently for disjoint ranges of states, so implementations may only write data belonging to
+             * the given states.
+             *
+             * @param firstState The first state of the range.
+             * @param lastState The state after the last state of the range.
+             */
+            virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState);
+            
+            /*!
+             * Compares the signatures of the given states (that were computed before). This must be a strict weak order
+             * on the states of a block whose equivalence classes are the states with equal signatures.
+             */
+            virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const;
+            
             /*!
              * Refines the partition by considering the given splitter. All blocks that become potential splitters
              * because of this refinement, are marked as splitters and inserted into the splitter vector.
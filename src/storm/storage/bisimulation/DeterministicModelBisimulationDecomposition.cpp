@@ -559,6 +559,84 @@ namespace storm {
             }
         }
         
+        template<typename ModelType>
+        void DeterministicModelBisimulationDecomposition<ModelType>::initialize() {
+            if (this->options.signatureRefinement && this->supportsSignatureRefinement()) {
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix = this->model.getTransitionMatrix();
+                signatureEntries.resize(transitionMatrix.getEntryCount());
+                signatureStarts.resize(this->model.getNumberOfStates());
+                signatureSizes.resize(this->model.getNumberOfStates());
+                uint_fast64_t start = 0;
+                for (storm::storage::sparse::state_type state = 0; state < this->model.getNumberOfStates(); ++state) {
+                    signatureStarts[state] = start;
+                    start += transitionMatrix.getRow(state).getNumberOfEntries();
+                }
+            }
+        }
+        
+        template<typename ModelType>
+        bool DeterministicModelBisimulationDecomposition<ModelType>::supportsSignatureRefinement() const {
+            // Weak bisimulation on DTMCs needs the silent probabilities of the states, which are not captured by signatures.
+            return this->options.getType() == BisimulationType::Strong || this->model.getType() == storm::models::ModelType::Ctmc;
+        }
+        
+        template<typename ModelType>
+        void DeterministicModelBisimulationDecomposition<ModelType>::computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) {
+            bool ignoreOwnBlock = this->options.getType() == BisimulationType::Weak;
+            for (storm::storage::sparse::state_type state = firstState; state < lastState; ++state) {
+                Block<BlockDataType> const& block = this->partition.getBlock(state);
+                if (block.data().absorbing()) {
+                    signatureSizes[state] = 0;
+                    continue;
+                }
+                
+                auto signatureBegin = signatureEntries.begin() + signatureStarts[state];
+                auto signatureEnd = signatureBegin;
+                for (auto const& entry : this->model.getRows(state)) {
+                    Block<BlockDataType> const& successorBlock = this->partition.getBlock(entry.getColumn());
+                    
+                    // For weak bisimulation on CTMCs, the transitions within the block are not relevant.
+                    if (ignoreOwnBlock && successorBlock == block) {
+                        continue;
+                    }
+                    *signatureEnd = std::make_pair(successorBlock.getId(), entry.getValue());
+                    ++signatureEnd;
+                }
+                
+                // Sort the entries by their blocks and sum up the probabilities of entries with the same block.
+                std::sort(signatureBegin, signatureEnd, [] (std::pair<storm::storage::sparse::state_type, ValueType> const& a, std::pair<storm::storage::sparse::state_type, ValueType> const& b) { return a.first < b.first; });
+                auto writeIt = signatureBegin;
+                for (auto readIt = signatureBegin; readIt != signatureEnd; ++readIt) {
+                    if (writeIt != signatureBegin && std::prev(writeIt)->first == readIt->first) {
+                        std::prev(writeIt)->second += readIt->second;
+                    } else {
+                        *writeIt = *readIt;
+                        ++writeIt;
+                    }
+                }
+                signatureSizes[state] = std::distance(signatureBegin, writeIt);
+            }
+        }
+        
+        template<typename ModelType>
+        bool DeterministicModelBisimulationDecomposition<ModelType>::signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const {
+            auto firstIt = signatureEntries.begin() + signatureStarts[state1];
+            auto firstIte = firstIt + signatureSizes[state1];
+            auto secondIt = signatureEntries.begin() + signatureStarts[state2];
+            auto secondIte = secondIt + signatureSizes[state2];
+            for (; firstIt != firstIte && secondIt != secondIte; ++firstIt, ++secondIt) {
+                if (firstIt->first != secondIt->first) {
+                    return firstIt->first < secondIt->first;
+                }
+                if (this->comparator.isLess(firstIt->second, secondIt->second)) {
+                    return true;
+                } else if (this->comparator.isLess(secondIt->second, firstIt->second)) {
+                    return false;
+                }
+            }
+            return firstIt == firstIte && secondIt != secondIte;
+        }
+        
         template<typename ModelType>
         void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
             // In order to create the quotient model, we need to construct
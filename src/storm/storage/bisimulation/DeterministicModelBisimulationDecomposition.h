@@ -36,6 +36,14 @@ namespace storm {
             virtual void buildQuotient() override;
             
             virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
+            
+            virtual void initialize() override;
+            
+            virtual bool supportsSignatureRefinement() const override;
+            
+            virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) override;
+            
+            virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const override;
 
         private:
             // Post-processes the initial partition to properly initialize it.
@@ -125,6 +133,17 @@ namespace storm {
             
             // A vector mapping each state to its silent probability.
             std::vector<ValueType> silentProbabilities;
+            
+            // The signatures of the states used by the signature-based refinement. The signature of a state is a list
+            // of pairs of a block and the probability to move to that block (sorted by the blocks). It is stored at the
+            // positions of the state's row in the transition matrix, so it needs no additional allocations.
+            std::vector<std::pair<storm::storage::sparse::state_type, ValueType>> signatureEntries;
+            
+            // The start of the signature of each state in the vector of signature entries.
+            std::vector<uint_fast64_t> signatureStarts;
+            
+            // The number of entries of the signature of each state.
+            std::vector<uint_fast64_t> signatureSizes;
         };
     }
 }
@@ -87,7 +87,7 @@ namespace storm {
         
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuotientDistributions(storm::storage::sparse::state_type state) {
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             std::sort(this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state], this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state + 1],
                       [this] (storm::storage::Distribution<ValueType> const* dist1, storm::storage::Distribution<ValueType> const* dist2) {
                           return dist1->less(*dist2, this->comparator);
@@ -383,7 +383,7 @@ namespace storm {
         template<typename ModelType>
         bool NondeterministicModelBisimulationDecomposition<ModelType>::quotientDistributionsLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const {
             STORM_LOG_TRACE("Comparing the quotient distributions of state " << state1 << " and " << state2 << ".");
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             
             auto firstIt = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1];
             auto firstIte = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1 + 1];
@@ -414,6 +414,45 @@ namespace storm {
             return false;
         }
         
+        template<typename ModelType>
+        bool NondeterministicModelBisimulationDecomposition<ModelType>::supportsSignatureRefinement() const {
+            return true;
+        }
+        
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) {
+            // The signature of a state is given by its ordered quotient distributions, which we recompute from scratch
+            // wrt. the current partition.
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            bool keepActionRewards = this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards();
+            for (storm::storage::sparse::state_type state = firstState; state < lastState; ++state) {
+                // The distributions of absorbing blocks were set upon initialization and do not change.
+                if (this->partition.getBlock(state).data().absorbing()) {
+                    continue;
+                }
+                
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                    storm::storage::DistributionWithReward<ValueType>& distribution = this->quotientDistributions[choice];
+                    distribution = storm::storage::DistributionWithReward<ValueType>();
+                    if (keepActionRewards) {
+                        distribution.setReward(this->model.getUniqueRewardModel().getStateActionReward(choice));
+                    }
+                    for (auto const& entry : this->model.getTransitionMatrix().getRow(choice)) {
+                        if (!this->comparator.isZero(entry.getValue())) {
+                            distribution.addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                        }
+                    }
+                    orderedQuotientDistributions[choice] = &distribution;
+                }
+                updateOrderedQuotientDistributions(state);
+            }
+        }
+        
+        template<typename ModelType>
+        bool NondeterministicModelBisimulationDecomposition<ModelType>::signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const {
+            return quotientDistributionsLess(state1, state2);
+        }
+        
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) {
             if (!possiblyNeedsRefinement(splitter)) {
@@ -37,6 +37,12 @@ namespace storm {
             
             virtual void initialize() override;
             
+            virtual bool supportsSignatureRefinement() const override;
+            
+            virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) override;
+            
+            virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const override;
+            
         private:
             // Creates the mapping from the choice indices to the states.
             void createChoiceToStateMapping();
@@ -3,6 +3,8 @@
 #include <cmath>
 #include <iostream>
 
+#include <unistd.h>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/SylvanSettings.h"
 
@@ -54,6 +56,18 @@ namespace storm {
             return 0;
         }
         
+        /*!
+         * Retrieves the size of the physical memory (in bytes) or zero if it can not be determined.
+         */
+        static uint64_t getPhysicalMemory() {
+            long pages = sysconf(_SC_PHYS_PAGES);
+            long pageSize = sysconf(_SC_PAGE_SIZE);
+            if (pages <= 0 || pageSize <= 0) {
+                return 0;
+            }
+            return static_cast<uint64_t>(pages) * static_cast<uint64_t>(pageSize);
+        }
+        
         InternalDdManager<DdType::Sylvan>::InternalDdManager() {
             if (numberOfInstances == 0) {
                 storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
@@ -65,10 +79,18 @@ namespace storm {
                 lace_startup(0, 0, 0);
                 
                 // Table/cache size computation taken from newer version of sylvan.
-                uint64_t memorycap = storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024;
+                uint64_t memorycap = settings.getMaximalMemory() * 1024 * 1024;
+                if (memorycap == 0) {
+                    // Sylvan only reserves (virtual) memory for the maximal table sizes and uses the smaller initial sizes
+                    // until the tables fill up, so a generous cap does not cost memory for small models.
+                    memorycap = getPhysicalMemory() / 2;
+                    if (memorycap == 0) {
+                        memorycap = 4096ull * 1024 * 1024;
+                        STORM_LOG_WARN("Unable to determine the physical memory. Sylvan uses at most " << memorycap / (1024 * 1024) << "MB.");
+                    }
+                }
                 
                 uint64_t table_ratio = 0;
-                uint64_t initial_ratio = 0;
                 
                 uint64_t max_t = 1;
                 uint64_t max_c = 1;
@@ -87,14 +109,16 @@ namespace storm {
                     max_c *= 2;
                     cur *= 2;
                 }
+                // End of copied code.
                 
+                // The tables start small and are enlarged by each garbage collection until they reach their maximal size.
+                // Hence, their sizes adapt to the model and garbage collections are cheap for small models.
                 uint64_t min_t = max_t, min_c = max_c;
-                while (initial_ratio > 0 && min_t > 0x1000 && min_c > 0x1000) {
+                uint64_t initialTableSize = settings.getInitialTableSize();
+                while (initialTableSize > 0 && min_t > initialTableSize && min_t > 0x1000 && min_c > 0x1000) {
                     min_t >>= 1;
                     min_c >>= 1;
-                    initial_ratio--;
                 }
-                // End of copied code.
                 
                 STORM_LOG_DEBUG("Initializing sylvan library. Initial/max table size: " << min_t << "/" << max_t << ", initial/max cache size: " << min_c << "/" << max_c << ".");
                 sylvan::Sylvan::initPackage(min_t, max_t, min_c, max_c);
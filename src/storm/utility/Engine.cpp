@@ -15,6 +15,8 @@
 
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
 #include "storm/modelchecker/CheckTask.h"
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -52,6 +54,8 @@ namespace storm {
                     return "expl";
                 case Engine::AbstractionRefinement:
                     return "abs";
+                case Engine::Statistical:
+                    return "smc";
                 case Engine::Automatic:
                     return "automatic";
                 case Engine::Unknown:
@@ -97,6 +101,8 @@ namespace storm {
                 return storm::builder::BuilderType::Explicit;
                 case Engine::AbstractionRefinement:
                     return storm::builder::BuilderType::Dd;
+                case Engine::Statistical:
+                    return storm::builder::BuilderType::Explicit;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given engine has no builder type to it.");
                     return storm::builder::BuilderType::Explicit;
@@ -157,6 +163,20 @@ namespace storm {
                             return false;
                     }
                     break;
+                case Engine::Statistical:
+                    // The statistical model checker only supports floating point numbers.
+                    switch (modelType) {
+                        case ModelType::DTMC:
+                            return std::is_same<ValueType, double>::value && storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>>::canHandleStatic(checkTask.template convertValueType<double>());
+                        case ModelType::MDP:
+                            return std::is_same<ValueType, double>::value && storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Mdp<double>>::canHandleStatic(checkTask.template convertValueType<double>());
+                        case ModelType::CTMC:
+                        case ModelType::MA:
+                        case ModelType::POMDP:
+                        case ModelType::SMG:
+                            return false;
+                    }
+                    break;
                 default:
                     STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
             }
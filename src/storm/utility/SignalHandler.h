@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdlib>
 #include <cstdint>
 
@@ -97,8 +98,8 @@ namespace storm {
                 virtual ~SignalInformation();
 
 
-                // Flag whether the program should terminate
-                bool terminate;
+                // Flag whether the program should terminate (may be set from other threads)
+                std::atomic<bool> terminate;
                 // Store last signal code
                 int lastSignal;
             };
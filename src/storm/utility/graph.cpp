@@ -389,21 +389,20 @@ namespace storm {
             
             template <storm::dd::DdType Type, typename ValueType>
             storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates, boost::optional<uint_fast64_t> const& stepBound) {
-                // Initialize environment for backward search.
-                storm::dd::DdManager<Type> const& manager = model.getManager();
-                storm::dd::Bdd<Type> lastIterationStates = manager.getBddZero();
+                // Initialize environment for backward search. As the predecessors of the other states have been added
+                // already, only the predecessors of the states found in the last iteration (the frontier) are computed.
                 storm::dd::Bdd<Type> statesWithProbabilityGreater0 = psiStates;
+                storm::dd::Bdd<Type> frontier = psiStates;
                 
                 uint_fast64_t iterations = 0;
-                while (lastIterationStates != statesWithProbabilityGreater0) {
+                while (!frontier.isZero()) {
                     if (stepBound && iterations >= stepBound.get()) {
                         break;
                     }
                     
-                    lastIterationStates = statesWithProbabilityGreater0;
-                    statesWithProbabilityGreater0 = statesWithProbabilityGreater0.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
-                    statesWithProbabilityGreater0 &= phiStates;
-                    statesWithProbabilityGreater0 |= lastIterationStates;
+                    frontier = frontier.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+                    frontier &= phiStates && !statesWithProbabilityGreater0;
+                    statesWithProbabilityGreater0 |= frontier;
                     ++iterations;
                 }
                 
@@ -987,18 +986,17 @@ namespace storm {
             
             template <storm::dd::DdType Type, typename ValueType>
             storm::dd::Bdd<Type> performProbGreater0E(storm::models::symbolic::NondeterministicModel<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates) {
-                // Initialize environment for backward search.
-                storm::dd::DdManager<Type> const& manager = model.getManager();
-                storm::dd::Bdd<Type> lastIterationStates = manager.getBddZero();
+                // Initialize environment for backward search. As for deterministic models, only the predecessors of the
+                // frontier are computed.
                 storm::dd::Bdd<Type> statesWithProbabilityGreater0E = psiStates;
+                storm::dd::Bdd<Type> frontier = psiStates;
                 
                 uint_fast64_t iterations = 0;
                 storm::dd::Bdd<Type> abstractedTransitionMatrix = transitionMatrix.existsAbstract(model.getNondeterminismVariables());
-                while (lastIterationStates != statesWithProbabilityGreater0E) {
-                    lastIterationStates = statesWithProbabilityGreater0E;
-                    statesWithProbabilityGreater0E = statesWithProbabilityGreater0E.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
-                    statesWithProbabilityGreater0E &= phiStates;
-                    statesWithProbabilityGreater0E |= lastIterationStates;
+                while (!frontier.isZero()) {
+                    frontier = frontier.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
+                    frontier &= phiStates && !statesWithProbabilityGreater0E;
+                    statesWithProbabilityGreater0E |= frontier;
                     ++iterations;
                 }
                 
@@ -10,10 +10,36 @@
 namespace storm {
     namespace utility {
 
+        namespace {
+            // If set, console log entries of the current thread are appended to this buffer instead of being printed.
+            thread_local std::string* consoleLogBuffer = nullptr;
+
+            /*!
+             * A sink that writes to std::cout unless the log output of the current thread is captured.
+             */
+            class ConsoleSink : public l3pp::Sink {
+                void logEntry(std::string const& entry) const override {
+                    if (consoleLogBuffer) {
+                        consoleLogBuffer->append(entry);
+                    } else {
+                        std::cout << entry << std::flush;
+                    }
+                }
+            };
+        }
+
+        ConsoleLogCapture::ConsoleLogCapture(std::string& buffer) : previousBuffer(consoleLogBuffer) {
+            consoleLogBuffer = &buffer;
+        }
+
+        ConsoleLogCapture::~ConsoleLogCapture() {
+            consoleLogBuffer = previousBuffer;
+        }
+
         void initializeLogger() {
             l3pp::Logger::initialize();
             // By default output to std::cout
-            l3pp::SinkPtr sink = l3pp::StreamSink::create(std::cout);
+            l3pp::SinkPtr sink = std::make_shared<ConsoleSink>();
             l3pp::Logger::getRootLogger()->addSink(sink);
             // Default to warn, set by user to something else
             l3pp::Logger::getRootLogger()->setLevel(l3pp::LogLevel::WARN);
@@ -1,10 +1,29 @@
 #ifndef STORM_UTILITY_INITIALIZE_H
 #define	STORM_UTILITY_INITIALIZE_H
 
+#include <string>
+
 #include "storm/utility/logging.h"
 
 namespace storm {
     namespace utility {
+        /*!
+         * While an object of this class exists, the log entries that the calling thread writes to the console are
+         * appended to the given buffer instead. Log files and output that is written to std::cout directly are not
+         * affected.
+         */
+        class ConsoleLogCapture {
+        public:
+            explicit ConsoleLogCapture(std::string& buffer);
+            ~ConsoleLogCapture();
+
+            ConsoleLogCapture(ConsoleLogCapture const&) = delete;
+            ConsoleLogCapture& operator=(ConsoleLogCapture const&) = delete;
+
+        private:
+            std::string* previousBuffer;
+        };
+
         /*!
          * Initializes the logging framework and sets up logging to console.
          */
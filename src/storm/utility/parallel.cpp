@@ -0,0 +1,218 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            uint64_t getNumberOfThreads(uint64_t requestedNumberOfThreads) {
+                if (requestedNumberOfThreads == 0) {
+                    uint64_t hardwareThreads = std::thread::hardware_concurrency();
+                    STORM_LOG_WARN_COND(hardwareThreads > 0, "Unable to detect the number of hardware threads. Falling back to a single thread.");
+                    return std::max<uint64_t>(hardwareThreads, 1);
+                }
+                return requestedNumberOfThreads;
+            }
+
+            void runOnThreads(uint64_t numberOfThreads, std::function<void (uint64_t)> const& function) {
+                STORM_LOG_ASSERT(numberOfThreads > 0, "Expected at least one thread.");
+
+                std::exception_ptr firstException = nullptr;
+                std::mutex exceptionMutex;
+                auto guardedFunction = [&function, &firstException, &exceptionMutex] (uint64_t threadIndex) {
+                    try {
+                        function(threadIndex);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(exceptionMutex);
+                        if (!firstException) {
+                            firstException = std::current_exception();
+                        }
+                    }
+                };
+
+                std::vector<std::thread> threads;
+                threads.reserve(numberOfThreads - 1);
+                for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+                    threads.emplace_back(guardedFunction, threadIndex);
+                }
+                guardedFunction(0);
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+
+                if (firstException) {
+                    std::rethrow_exception(firstException);
+                }
+            }
+
+            void processInOrder(uint64_t numberOfThreads, uint64_t numberOfTasks, std::function<void (uint64_t)> const& process, std::function<void (uint64_t)> const& report) {
+                STORM_LOG_ASSERT(numberOfThreads > 0, "Expected at least one thread.");
+                if (numberOfThreads == 1) {
+                    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+                        process(task);
+                        report(task);
+                    }
+                    return;
+                }
+
+                std::vector<bool> processed(numberOfTasks, false);
+                std::atomic<uint64_t> nextTask(0);
+                std::atomic<bool> aborted(false);
+                // The first task that has not been reported yet.
+                uint64_t nextReportedTask = 0;
+                std::mutex reportMutex;
+
+                runOnThreads(numberOfThreads, [&] (uint64_t) {
+                    try {
+                        for (uint64_t task = nextTask++; task < numberOfTasks && !aborted; task = nextTask++) {
+                            process(task);
+
+                            std::lock_guard<std::mutex> lock(reportMutex);
+                            processed[task] = true;
+                            while (!aborted && nextReportedTask < numberOfTasks && processed[nextReportedTask]) {
+                                report(nextReportedTask++);
+                            }
+                        }
+                    } catch (...) {
+                        // Let the other threads stop as soon as possible.
+                        aborted = true;
+                        throw;
+                    }
+                });
+            }
+
+#ifdef __linux__
+            namespace detail {
+                void pinThread(pthread_t thread, uint64_t threadIndex, int processor) {
+                    cpu_set_t processors;
+                    CPU_ZERO(&processors);
+                    CPU_SET(processor, &processors);
+                    int error = pthread_setaffinity_np(thread, sizeof(cpu_set_t), &processors);
+                    STORM_LOG_WARN_COND(error == 0, "Unable to pin thread " << threadIndex << " to processor " << processor << ".");
+                }
+            }
+#endif
+
+            ThreadPool::ThreadPool(uint64_t numberOfThreads, bool pinThreads) : numberOfThreads(numberOfThreads), pinThreads(pinThreads), currentFunction(nullptr), currentRun(0), numberOfBusyWorkers(0), shutdown(false), firstException(nullptr) {
+                STORM_LOG_ASSERT(numberOfThreads > 0, "Expected at least one thread.");
+#ifdef __linux__
+                // The processors the calling thread may run on (e.g. restricted by taskset or a cgroup), in ascending order.
+                std::vector<int> processors;
+                if (this->pinThreads) {
+                    cpu_set_t callerAffinity;
+                    if (sched_getaffinity(0, sizeof(cpu_set_t), &callerAffinity) == 0) {
+                        for (int processor = 0; processor < CPU_SETSIZE; ++processor) {
+                            if (CPU_ISSET(processor, &callerAffinity)) {
+                                processors.push_back(processor);
+                            }
+                        }
+                    }
+                    STORM_LOG_WARN_COND(!processors.empty(), "Unable to retrieve the processors available to the calling thread. Threads are not pinned.");
+                    STORM_LOG_WARN_COND(processors.empty() || processors.size() >= numberOfThreads, "Only " << processors.size() << " processors are available for " << numberOfThreads << " threads. Some threads share a processor.");
+                }
+#else
+                STORM_LOG_WARN_COND(!pinThreads, "Pinning threads to processors is not supported on this platform.");
+#endif
+                workers.reserve(numberOfThreads - 1);
+                for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+                    workers.emplace_back(&ThreadPool::work, this, threadIndex);
+#ifdef __linux__
+                    if (!processors.empty()) {
+                        detail::pinThread(workers.back().native_handle(), threadIndex, processors[threadIndex % processors.size()]);
+                    }
+#endif
+                }
+            }
+
+            ThreadPool::~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    shutdown = true;
+                }
+                startCondition.notify_all();
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+
+            uint64_t ThreadPool::getNumberOfThreads() const {
+                return numberOfThreads;
+            }
+
+            bool ThreadPool::areThreadsPinned() const {
+                return pinThreads;
+            }
+
+            void ThreadPool::run(std::function<void (uint64_t)> const& function) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    currentFunction = &function;
+                    firstException = nullptr;
+                    numberOfBusyWorkers = workers.size();
+                    ++currentRun;
+                }
+                startCondition.notify_all();
+
+                std::exception_ptr callerException = nullptr;
+                try {
+                    function(0);
+                } catch (...) {
+                    callerException = std::current_exception();
+                }
+
+                std::unique_lock<std::mutex> lock(mutex);
+                finishedCondition.wait(lock, [this] { return numberOfBusyWorkers == 0; });
+                currentFunction = nullptr;
+                if (!firstException) {
+                    firstException = callerException;
+                }
+                if (firstException) {
+                    std::exception_ptr exception = firstException;
+                    firstException = nullptr;
+                    std::rethrow_exception(exception);
+                }
+            }
+
+            void ThreadPool::work(uint64_t threadIndex) {
+                uint64_t lastRun = 0;
+                while (true) {
+                    std::function<void (uint64_t)> const* function;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        startCondition.wait(lock, [this, lastRun] { return shutdown || currentRun != lastRun; });
+                        if (shutdown) {
+                            return;
+                        }
+                        lastRun = currentRun;
+                        function = currentFunction;
+                    }
+
+                    std::exception_ptr exception = nullptr;
+                    try {
+                        (*function)(threadIndex);
+                    } catch (...) {
+                        exception = std::current_exception();
+                    }
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (exception && !firstException) {
+                        firstException = exception;
+                    }
+                    if (--numberOfBusyWorkers == 0) {
+                        finishedCondition.notify_one();
+                    }
+                }
+            }
+
+        }
+    }
+}
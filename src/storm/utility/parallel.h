@@ -0,0 +1,111 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            /*!
+             * Retrieves the number of threads that is to be used for the given requested number of threads. A request
+             * of zero threads refers to the number of hardware threads available on the current machine.
+             *
+             * @param requestedNumberOfThreads The number of threads that was requested (e.g. via the settings).
+             * @return The number of threads to use (at least one).
+             */
+            uint64_t getNumberOfThreads(uint64_t requestedNumberOfThreads);
+
+            /*!
+             * Runs the given function on the given number of threads and waits until all of them have finished.
+             * The function is called with the index of the executing thread, i.e., a value in {0, ..., numberOfThreads-1}.
+             * The function call with index 0 is executed by the calling thread. If any of the calls throws an exception,
+             * the first such exception is rethrown once all threads have finished.
+             *
+             * @param numberOfThreads The number of threads to use.
+             * @param function The function to execute.
+             */
+            void runOnThreads(uint64_t numberOfThreads, std::function<void (uint64_t)> const& function);
+
+            /*!
+             * Processes the tasks {0, ..., numberOfTasks-1} on the given number of threads and reports the processed
+             * tasks in the order of their indices. A task is reported as soon as it and all tasks with a smaller index
+             * have been processed. Reports are made by the processing threads, but never concurrently. If processing or
+             * reporting a task throws an exception, no further tasks are started and the first such exception is
+             * rethrown once all threads have finished.
+             *
+             * @param numberOfThreads The number of threads to use.
+             * @param numberOfTasks The number of tasks.
+             * @param process The function that processes the task with the given index. It is called concurrently.
+             * @param report The function that reports the task with the given index.
+             */
+            void processInOrder(uint64_t numberOfThreads, uint64_t numberOfTasks, std::function<void (uint64_t)> const& process, std::function<void (uint64_t)> const& report);
+
+            /*!
+             * A fixed set of worker threads that repeatedly execute functions on behalf of a calling thread. In contrast
+             * to runOnThreads, the threads are only created once, which makes the pool suitable for many short parallel
+             * sections (e.g., one per iteration of an iterative solver). Moreover, worker i always executes the calls with
+             * index i, so a fixed assignment of work to indices yields a fixed assignment of work to threads.
+             */
+            class ThreadPool {
+            public:
+                /*!
+                 * Creates a pool for the given number of threads. As the calling thread participates in each run, only
+                 * numberOfThreads - 1 worker threads are created.
+                 *
+                 * @param numberOfThreads The number of threads (at least one).
+                 * @param pinThreads If set, worker i is bound to the i-th processor (modulo their number) among the
+                 * processors the calling thread may run on. The affinity of the calling thread itself is not changed.
+                 * Pinning only fixes where the workers run; the memory touched by the threads is not placed on
+                 * particular NUMA nodes. This is only supported on Linux and ignored (with a warning) on other platforms.
+                 */
+                ThreadPool(uint64_t numberOfThreads, bool pinThreads = false);
+                ~ThreadPool();
+
+                ThreadPool(ThreadPool const& other) = delete;
+                ThreadPool& operator=(ThreadPool const& other) = delete;
+
+                /*!
+                 * Retrieves the number of threads (including the calling thread) that execute the functions.
+                 */
+                uint64_t getNumberOfThreads() const;
+
+                /*!
+                 * Retrieves whether binding the worker threads to processors was requested upon construction.
+                 */
+                bool areThreadsPinned() const;
+
+                /*!
+                 * Runs the given function on all threads of the pool and waits until all calls have finished. The call
+                 * with index 0 is executed by the calling thread. If any of the calls throws an exception, the first such
+                 * exception is rethrown once all calls have finished. This method must not be called concurrently.
+                 *
+                 * @param function The function to execute.
+                 */
+                void run(std::function<void (uint64_t)> const& function);
+
+            private:
+                void work(uint64_t threadIndex);
+
+                uint64_t numberOfThreads;
+                bool pinThreads;
+                std::vector<std::thread> workers;
+
+                std::mutex mutex;
+                std::condition_variable startCondition;
+                std::condition_variable finishedCondition;
+                std::function<void (uint64_t)> const* currentFunction;
+                uint64_t currentRun;
+                uint64_t numberOfBusyWorkers;
+                bool shutdown;
+                std::exception_ptr firstException;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#include "storm/utility/simd.h"
+
+#include <atomic>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            bool isSupported(InstructionSet instructionSet) {
+                switch (instructionSet) {
+                    case InstructionSet::None:
+                        return true;
+#ifdef STORM_HAVE_X86_SIMD_DISPATCH
+                    case InstructionSet::Avx2:
+                        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+                    case InstructionSet::Avx512:
+                        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+                    default:
+                        return false;
+                }
+            }
+
+            InstructionSet getBestSupportedInstructionSet() {
+                if (isSupported(InstructionSet::Avx512)) {
+                    return InstructionSet::Avx512;
+                } else if (isSupported(InstructionSet::Avx2)) {
+                    return InstructionSet::Avx2;
+                }
+                return InstructionSet::None;
+            }
+
+            static std::atomic<InstructionSet>& activeInstructionSet() {
+                static std::atomic<InstructionSet> instructionSet(getBestSupportedInstructionSet());
+                return instructionSet;
+            }
+
+            InstructionSet getInstructionSet() {
+                return activeInstructionSet().load(std::memory_order_relaxed);
+            }
+
+            void setInstructionSet(InstructionSet instructionSet) {
+                STORM_LOG_THROW(isSupported(instructionSet), storm::exceptions::NotSupportedException, "The instruction set " << toString(instructionSet) << " is not supported by this processor.");
+                activeInstructionSet().store(instructionSet, std::memory_order_relaxed);
+            }
+
+            std::string toString(InstructionSet instructionSet) {
+                switch (instructionSet) {
+                    case InstructionSet::None:
+                        return "none";
+                    case InstructionSet::Avx2:
+                        return "avx2";
+                    case InstructionSet::Avx512:
+                        return "avx512";
+                }
+                return "unknown";
+            }
+
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+
+// Kernels using x86 vector instructions are compiled for specific instruction sets via function attributes and are
+// selected at runtime, so the remaining code does not depend on the instruction sets the compiler targets.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_HAVE_X86_SIMD_DISPATCH
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            /*!
+             * The instruction sets for which vectorized kernels are available.
+             */
+            enum class InstructionSet {
+                None, Avx2, Avx512
+            };
+
+            /*!
+             * Retrieves whether the processor executing this program supports the given instruction set (and whether
+             * support for it was compiled in).
+             */
+            bool isSupported(InstructionSet instructionSet);
+
+            /*!
+             * Retrieves the most powerful instruction set that is supported by the processor executing this program.
+             */
+            InstructionSet getBestSupportedInstructionSet();
+
+            /*!
+             * Retrieves the instruction set that is used by the vectorized matrix-vector multiplications. Unless set
+             * otherwise, this is the most powerful instruction set supported by the processor.
+             */
+            InstructionSet getInstructionSet();
+
+            /*!
+             * Sets the instruction set that is used by the vectorized matrix-vector multiplications. Setting it to
+             * None disables the vectorized kernels.
+             *
+             * @param instructionSet The instruction set to use. It must be supported by the current processor.
+             */
+            void setInstructionSet(InstructionSet instructionSet);
+
+            std::string toString(InstructionSet instructionSet);
+
+        }
+    }
+}
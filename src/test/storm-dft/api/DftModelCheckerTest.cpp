@@ -12,6 +12,7 @@ namespace {
         bool useSR;
         bool useMod;
         bool useDC;
+        uint64_t threads = 1;
     };
 
     class NoOptimizationsConfig {
@@ -41,6 +42,15 @@ namespace {
         }
     };
 
+    class ParallelModularisationConfig {
+    public:
+        typedef double ValueType;
+
+        static DftAnalysisConfig createConfig() {
+            return DftAnalysisConfig{false, true, false, 4};
+        }
+    };
+
     class SymmetryReductionConfig {
     public:
         typedef double ValueType;
@@ -89,7 +99,7 @@ namespace {
             storm::utility::RelevantEvents relevantEvents = storm::api::computeRelevantEvents<ValueType>(*dft, properties, relevantNames);
 
             // Perform model checking
-            typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, config.useSR, config.useMod, relevantEvents, false);
+            typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, config.useSR, config.useMod, relevantEvents, false, 0.0, storm::builder::ApproximationHeuristic::DEPTH, false, storm::transformer::EliminationLabelBehavior::KeepLabels, false, config.threads);
             return boost::get<double>(results[0]);
         }
 
@@ -111,6 +121,7 @@ namespace {
             NoOptimizationsConfig,
             DontCareConfig,
             ModularisationConfig,
+            ParallelModularisationConfig,
             SymmetryReductionConfig,
             AllOptimizationsConfig
         > TestingTypes;
@@ -1,6 +1,8 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 
+#include <map>
+
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/transformations/DftTransformator.h"
 #include "storm-dft/generator/DftNextStateGenerator.h"
@@ -195,4 +197,118 @@ namespace {
         EXPECT_TRUE(state->hasFailed(dft->getTopLevelIndex()));
     }
 
+    TYPED_TEST(DftTraceGeneratorTest, BufferedSuccessors) {
+        typedef std::shared_ptr<storm::storage::DFTState<double>> DFTStatePointer;
+        // The choices of a state, each given by the status of the successors and their probabilities (or rates).
+        typedef std::vector<std::map<storm::storage::BitVector, double>> Choices;
+
+        for (std::string const& file : {"/dft/and.dft", "/dft/spare.dft", "/dft/fdep.dft", "/dft/pdep.dft", "/dft/seq.dft"}) {
+            auto pair = this->prepareDFT(STORM_TEST_RESOURCES_DIR + file);
+            auto dft = pair.first;
+            storm::generator::DftNextStateGenerator<double> generator(*dft, pair.second);
+
+            // Explore the state space with expand(), which computes the successors in a buffer. New states are kept by the
+            // callback (like the model builder does), so the generator has to hand the buffer over.
+            std::vector<DFTStatePointer> states;
+            std::vector<storm::storage::BitVector> statusOnInsertion;
+            std::map<storm::storage::BitVector, uint32_t> stateToId;
+            auto stateToIdCallback = [&] (DFTStatePointer const& state) -> uint32_t {
+                auto it = stateToId.find(state->status());
+                if (it != stateToId.end()) {
+                    return it->second;
+                }
+                uint32_t id = states.size();
+                state->setId(id);
+                stateToId.emplace(state->status(), id);
+                states.push_back(state);
+                statusOnInsertion.push_back(state->status());
+                return id;
+            };
+            generator.getInitialStates(stateToIdCallback);
+            std::vector<Choices> bufferedBehaviors;
+            for (uint64_t id = 0; id < states.size(); ++id) {
+                generator.load(states[id]);
+                Choices choices;
+                for (auto const& choice : generator.expand(stateToIdCallback)) {
+                    std::map<storm::storage::BitVector, double> distribution;
+                    for (auto const& entry : choice) {
+                        ASSERT_LT(entry.first, statusOnInsertion.size());
+                        distribution[statusOnInsertion[entry.first]] += entry.second;
+                    }
+                    choices.push_back(std::move(distribution));
+                }
+                bufferedBehaviors.push_back(std::move(choices));
+            }
+            ASSERT_GT(states.size(), 1ul);
+
+            // The kept states must not be overwritten by the computation of later successors.
+            for (uint64_t id = 0; id < states.size(); ++id) {
+                EXPECT_EQ(statusOnInsertion[id], states[id]->status()) << "State " << id << " of " << file << " was modified after it was kept.";
+                EXPECT_EQ(id, states[id]->getId());
+            }
+
+            // Compute the same behavior with createSuccessorState(), which returns independent states.
+            for (uint64_t id = 0; id < states.size(); ++id) {
+                DFTStatePointer const& state = states[id];
+                Choices choices;
+                bool exploreDependencies = state->getFailableElements().hasDependencies();
+                while (true) {
+                    auto iterFailable = state->getFailableElements().begin(!exploreDependencies);
+                    if (!state->hasOperationalRelevantEvent() || iterFailable == state->getFailableElements().end(!exploreDependencies)) {
+                        // Absorbing state
+                        choices.push_back({{state->status(), 1.0}});
+                        break;
+                    }
+                    std::map<storm::storage::BitVector, double> rates;
+                    for (; iterFailable != state->getFailableElements().end(!exploreDependencies); ++iterFailable) {
+                        auto nextBEPair = iterFailable.getFailBE(*dft);
+                        auto nextBE = nextBEPair.first;
+                        auto dependency = nextBEPair.second;
+                        DFTStatePointer successor = generator.createSuccessorState(state, nextBE, dependency);
+                        if (successor->isInvalid() || successor->isTransient()) {
+                            continue;
+                        }
+                        if (exploreDependencies) {
+                            std::map<storm::storage::BitVector, double> distribution;
+                            distribution[successor->status()] += dependency->probability();
+                            if (!storm::utility::isOne(dependency->probability())) {
+                                DFTStatePointer unsuccessfulSuccessor = generator.createSuccessorState(state, nextBE, dependency, false);
+                                distribution[unsuccessfulSuccessor->status()] += 1.0 - dependency->probability();
+                            }
+                            choices.push_back(std::move(distribution));
+                        } else {
+                            rates[successor->status()] += state->getBERate(nextBE->id());
+                        }
+                        if (iterFailable.isFailureDueToDependency() && !iterFailable.isConflictingDependency()) {
+                            break;
+                        }
+                    }
+                    if (exploreDependencies) {
+                        if (choices.empty()) {
+                            // Continue with the BEs
+                            exploreDependencies = false;
+                            continue;
+                        }
+                    } else {
+                        if (rates.empty()) {
+                            rates[state->status()] = 1.0;
+                        }
+                        choices.push_back(std::move(rates));
+                    }
+                    break;
+                }
+
+                ASSERT_EQ(choices.size(), bufferedBehaviors[id].size()) << "State " << id << " of " << file;
+                for (uint64_t choice = 0; choice < choices.size(); ++choice) {
+                    ASSERT_EQ(choices[choice].size(), bufferedBehaviors[id][choice].size()) << "State " << id << " of " << file;
+                    for (auto const& entry : choices[choice]) {
+                        auto bufferedEntry = bufferedBehaviors[id][choice].find(entry.first);
+                        ASSERT_NE(bufferedEntry, bufferedBehaviors[id][choice].end()) << "State " << id << " of " << file;
+                        EXPECT_NEAR(entry.second, bufferedEntry->second, 1e-12);
+                    }
+                }
+            }
+        }
+    }
+
 }
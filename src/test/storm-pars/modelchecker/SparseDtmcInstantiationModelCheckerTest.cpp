@@ -0,0 +1,138 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include <carl/core/VariablePool.h>
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+    class SparseDtmcInstantiationModelCheckerTest : public ::testing::Test {
+    protected:
+        virtual void SetUp() { carl::VariablePool::getInstance().clear(); }
+        virtual void TearDown() { carl::VariablePool::getInstance().clear(); }
+
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> buildModel(std::string const& formulaAsString) {
+            storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+            formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+            return storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        }
+
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> getValuations() const {
+            storm::RationalFunctionVariable pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+            storm::RationalFunctionVariable pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+            std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+            for (double valueL : {0.3, 0.8, 0.95}) {
+                for (double valueK : {0.5, 0.9}) {
+                    storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+                    valuation[pL] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueL);
+                    valuation[pK] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueK);
+                    valuations.push_back(valuation);
+                }
+            }
+            return valuations;
+        }
+
+        storm::Environment getEnvironment() const {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            return env;
+        }
+
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    };
+
+    TEST_F(SparseDtmcInstantiationModelCheckerTest, BatchEqualsSingleChecks) {
+        auto dtmc = buildModel("P=? [F s=5]");
+        uint64_t initialState = *dtmc->getInitialStates().begin();
+        auto valuations = getValuations();
+        storm::Environment env = getEnvironment();
+
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelchecker(*dtmc);
+        modelchecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas.front(), true));
+        modelchecker.setInstantiationsAreGraphPreserving(true);
+
+        auto batchResults = modelchecker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            auto result = modelchecker.check(env, valuations[i]);
+            EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[initialState], batchResults[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-8);
+        }
+    }
+
+    TEST_F(SparseDtmcInstantiationModelCheckerTest, BatchWithBound) {
+        auto dtmc = buildModel("P<=0.84 [F s=5]");
+        uint64_t initialState = *dtmc->getInitialStates().begin();
+        auto valuations = getValuations();
+        storm::Environment env = getEnvironment();
+
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelchecker(*dtmc);
+        modelchecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas.front(), true));
+        modelchecker.setInstantiationsAreGraphPreserving(true);
+
+        auto batchResults = modelchecker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            auto result = modelchecker.check(env, valuations[i]);
+            EXPECT_EQ(result->asExplicitQualitativeCheckResult()[initialState], batchResults[i]->asExplicitQualitativeCheckResult()[initialState]);
+        }
+    }
+
+    TEST_F(SparseDtmcInstantiationModelCheckerTest, BatchSound) {
+        auto dtmc = buildModel("P=? [F s=5]");
+        uint64_t initialState = *dtmc->getInitialStates().begin();
+        auto valuations = getValuations();
+        storm::Environment env = getEnvironment();
+        env.solver().setForceSoundness(true);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().native().setRelativeTerminationCriterion(false);
+
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelchecker(*dtmc);
+        modelchecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas.front(), true));
+        modelchecker.setInstantiationsAreGraphPreserving(true);
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber> exactModelchecker(*dtmc);
+        exactModelchecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas.front(), true));
+        storm::Environment exactEnv;
+
+        // The interval iteration guarantees the precision for every valuation of the batch.
+        auto batchResults = modelchecker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            auto exactResult = exactModelchecker.check(exactEnv, valuations[i]);
+            EXPECT_NEAR(storm::utility::convertNumber<double>(exactResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initialState]), batchResults[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        }
+    }
+
+    TEST_F(SparseDtmcInstantiationModelCheckerTest, BatchExact) {
+        auto dtmc = buildModel("P=? [F s=5]");
+        uint64_t initialState = *dtmc->getInitialStates().begin();
+        auto valuations = getValuations();
+        storm::Environment env;
+
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber> modelchecker(*dtmc);
+        modelchecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas.front(), true));
+        modelchecker.setInstantiationsAreGraphPreserving(true);
+
+        auto batchResults = modelchecker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            auto result = modelchecker.check(env, valuations[i]);
+            EXPECT_EQ(result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initialState], batchResults[i]->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initialState]);
+        }
+    }
+}
+
+#endif
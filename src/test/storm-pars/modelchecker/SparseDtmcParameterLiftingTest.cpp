@@ -989,5 +989,36 @@ namespace {
         // Twice, as the monRes will be initialized now
         EXPECT_EQ(regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true), regionCheckerMon->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true, order, monRes));
     }
+
+    TEST(SparseDtmcParameterLiftingRefinementTest, Brp_Prob_MultipleThreads) {
+        carl::VariablePool::getInstance().clear();
+        storm::Environment env = DoubleViEnvironment::createEnvironment();
+
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P<=0.84 [F s=5 ]", program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+
+        std::vector<std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<storm::RationalFunction>>> results;
+        for (uint64_t numberOfThreads : {1, 2, 4}) {
+            auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, double>(env, model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+            regionChecker->setNumberOfRefinementThreads(numberOfThreads);
+            results.push_back(regionChecker->performRegionRefinement(env, region, storm::utility::convertNumber<storm::RationalFunction>(0.05), 8));
+        }
+
+        // The regions are processed in the same order and warm started in the same way, so the result does not depend on the number of threads.
+        auto const& singleThreadRegions = results[0]->getRegionResults();
+        for (uint64_t run = 1; run < results.size(); ++run) {
+            auto const& regions = results[run]->getRegionResults();
+            ASSERT_EQ(singleThreadRegions.size(), regions.size());
+            for (uint64_t i = 0; i < singleThreadRegions.size(); ++i) {
+                EXPECT_EQ(singleThreadRegions[i].first.toString(), regions[i].first.toString());
+                EXPECT_EQ(singleThreadRegions[i].second, regions[i].second);
+            }
+            EXPECT_EQ(results[0]->getSatFraction(), results[run]->getSatFraction());
+            EXPECT_EQ(results[0]->getUnsatFraction(), results[run]->getUnsatFraction());
+        }
+    }
 }
 #endif
@@ -0,0 +1,122 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include <carl/core/VariablePool.h>
+
+#include "storm-pars/utility/CompiledFunctionEvaluator.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+    storm::RationalFunction parseFunction(carl::StringParser& parser, std::shared_ptr<storm::RawPolynomialCache> const& cache, std::string const& nominator, std::string const& denominator) {
+        storm::Polynomial nominatorPolynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>(nominator), cache);
+        storm::Polynomial denominatorPolynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>(denominator), cache);
+        return storm::RationalFunction(nominatorPolynomial, denominatorPolynomial);
+    }
+}
+
+TEST(CompiledFunctionEvaluatorTest, Functions) {
+    carl::VariablePool::getInstance().clear();
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    carl::StringParser parser;
+    parser.setVariables({"p", "q"});
+
+    std::vector<storm::RationalFunction> functions;
+    functions.push_back(parseFunction(parser, cache, "1-p", "1"));
+    functions.push_back(parseFunction(parser, cache, "1-2*p^3*q+3*p*q^2", "1+p"));
+    functions.push_back(parseFunction(parser, cache, "p^7*q^2+p^2*q^7", "4"));
+    functions.push_back(parseFunction(parser, cache, "p*q", "p*q+(1-p)*(1-q)"));
+    functions.push_back(storm::RationalFunction(3));
+
+    storm::utility::parametric::CompiledFunctionEvaluator<storm::RationalFunction> evaluator;
+    std::vector<uint64_t> indices;
+    for (auto const& function : functions) {
+        indices.push_back(evaluator.addFunction(function));
+    }
+    EXPECT_EQ(functions.size(), evaluator.getNumberOfFunctions());
+    // Functions that were added before are not compiled again.
+    EXPECT_EQ(indices[1], evaluator.addFunction(functions[1]));
+    EXPECT_EQ(2ull, evaluator.getVariables().size());
+
+    storm::RationalFunctionVariable p = carl::VariablePool::getInstance().findVariableWithName("p");
+    storm::RationalFunctionVariable q = carl::VariablePool::getInstance().findVariableWithName("q");
+    for (double valueP : {0.0, 0.25, 0.6, 1.0}) {
+        for (double valueQ : {0.1, 0.5, 0.9}) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation[p] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueP);
+            valuation[q] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueQ);
+            evaluator.setValuation(valuation);
+            for (uint64_t i = 0; i < functions.size(); ++i) {
+                double expected = storm::utility::convertNumber<double>(functions[i].evaluate(valuation));
+                EXPECT_NEAR(expected, evaluator.evaluate(indices[i]), 1e-12);
+            }
+        }
+    }
+}
+
+TEST(CompiledFunctionEvaluatorTest, BrpMatrix) {
+    carl::VariablePool::getInstance().clear();
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F s=5 ]", program));
+    auto dtmc = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::utility::parametric::CompiledFunctionEvaluator<storm::RationalFunction> evaluator;
+    for (auto const& entry : dtmc->getTransitionMatrix()) {
+        evaluator.addFunction(entry.getValue());
+    }
+
+    storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+    valuation[carl::VariablePool::getInstance().findVariableWithName("pL")] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.8);
+    valuation[carl::VariablePool::getInstance().findVariableWithName("pK")] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.9);
+    evaluator.setValuation(valuation);
+    for (auto const& entry : dtmc->getTransitionMatrix()) {
+        double expected = storm::utility::convertNumber<double>(entry.getValue().evaluate(valuation));
+        EXPECT_NEAR(expected, evaluator.evaluate(evaluator.addFunction(entry.getValue())), 1e-12);
+    }
+}
+
+TEST(CompiledFunctionEvaluatorTest, SharedSubexpressions) {
+    carl::VariablePool::getInstance().clear();
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    carl::StringParser parser;
+    parser.setVariables({"p", "q"});
+
+    // The functions share powers, monomials and polynomials, which are only computed once per valuation.
+    std::vector<storm::RationalFunction> functions;
+    functions.push_back(parseFunction(parser, cache, "p^5*q^2+p*q", "1"));
+    functions.push_back(parseFunction(parser, cache, "p^5*q^2", "1+p*q"));
+    functions.push_back(parseFunction(parser, cache, "p*q", "p^5*q^2+p*q"));
+    functions.push_back(parseFunction(parser, cache, "1-p^5", "2"));
+
+    storm::utility::parametric::CompiledFunctionEvaluator<storm::RationalFunction> evaluator;
+    std::vector<uint64_t> indices;
+    for (auto const& function : functions) {
+        indices.push_back(evaluator.addFunction(function));
+    }
+    storm::RationalFunctionVariable p = carl::VariablePool::getInstance().findVariableWithName("p");
+    storm::RationalFunctionVariable q = carl::VariablePool::getInstance().findVariableWithName("q");
+    uint64_t indexP = evaluator.getVariableIndex(p);
+    uint64_t indexQ = evaluator.getVariableIndex(q);
+
+    // Change single variables between the evaluations and evaluate the functions in different orders.
+    std::vector<std::pair<double, double>> values = {{0.5, 0.5}, {0.5, 0.25}, {0.8, 0.25}, {0.8, 0.25}, {0.1, 0.9}};
+    for (uint64_t round = 0; round < values.size(); ++round) {
+        evaluator.setVariableValue(indexP, values[round].first);
+        evaluator.setVariableValue(indexQ, values[round].second);
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        valuation[p] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(values[round].first);
+        valuation[q] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(values[round].second);
+        for (uint64_t i = 0; i < functions.size(); ++i) {
+            uint64_t function = (round % 2 == 0) ? i : functions.size() - 1 - i;
+            double expected = storm::utility::convertNumber<double>(functions[function].evaluate(valuation));
+            EXPECT_NEAR(expected, evaluator.evaluate(indices[function]), 1e-12);
+        }
+    }
+}
+
+#endif
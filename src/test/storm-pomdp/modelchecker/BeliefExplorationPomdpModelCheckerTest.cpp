@@ -1,6 +1,8 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 
+#include <sstream>
+
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
 #include "storm-pomdp/transformer/MakePOMDPCanonic.h"
 #include "storm/api/storm.h"
@@ -10,6 +12,7 @@
 #include "storm-pomdp/transformer/KnownProbabilityTransformer.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/utility/SignalHandler.h"
 
 
 namespace {
@@ -123,6 +126,21 @@ namespace {
         static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision();}
     };
     
+    class ParallelRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision(); options.explorationThreads = 4;}
+    };
+    
     class DefaultDoubleOVIEnvironment {
     public:
         typedef double ValueType;
@@ -241,6 +259,7 @@ namespace {
             FineDoubleVIEnvironment,
             RefineDoubleVIEnvironment,
             PreprocessedRefineDoubleVIEnvironment,
+            ParallelRefineDoubleVIEnvironment,
             DefaultDoubleOVIEnvironment,
             DefaultRationalPIEnvironment,
             PreprocessedDefaultRationalPIEnvironment
@@ -430,6 +449,68 @@ namespace {
         EXPECT_LE(result.diff(), this->precision()) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise." << std::endl;
     }
     
+    TEST(BeliefExplorationParallelTest, maze2_slippery_Rmin_reproducible) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+        program = storm::utility::prism::preprocess(program, "sl=0.075");
+        auto formula = storm::api::parsePropertiesForPrismProgram("R[exp]min=? [F \"goal\"]", program).front().getRawFormula();
+        auto model = storm::api::buildSparseModel<double>(program, {formula})->template as<storm::models::sparse::Pomdp<double>>();
+        storm::transformer::MakePOMDPCanonic<double> makeCanonic(*model);
+        model = makeCanonic.transform();
+        
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double> options(true, true);
+        options.refine = true;
+        options.refineStepLimit = 3;
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<double>> sequentialChecker(model, options);
+        auto sequentialResult = sequentialChecker.check(*formula);
+        
+        // The explored beliefs (and thus the results) must not depend on the number of threads.
+        options.explorationThreads = 4;
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<double>> parallelChecker(model, options);
+        auto parallelResult = parallelChecker.check(*formula);
+        EXPECT_EQ(sequentialResult.lowerBound, parallelResult.lowerBound);
+        EXPECT_EQ(sequentialResult.upperBound, parallelResult.upperBound);
+    }
     
+    TEST(BeliefExplorationBudgetTest, maze2_slippery_Rmin_timeBudget) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+        program = storm::utility::prism::preprocess(program, "sl=0.075");
+        auto formula = storm::api::parsePropertiesForPrismProgram("R[exp]min=? [F \"goal\"]", program).front().getRawFormula();
+        auto model = storm::api::buildSparseModel<double>(program, {formula})->template as<storm::models::sparse::Pomdp<double>>();
+        storm::transformer::MakePOMDPCanonic<double> makeCanonic(*model);
+        model = makeCanonic.transform();
+        
+        // Refinement without any limit only stops due to the budget.
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double> options(true, true);
+        options.refine = true;
+        options.timeBudget = 0;
+        typedef storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<double>> CheckerType;
+        CheckerType checker(model, options);
+        std::vector<CheckerType::Result> reportedBounds;
+        bool terminationRequested = false;
+        checker.setBoundsReporter([&reportedBounds, &terminationRequested](CheckerType::Result const& bounds, double) {
+            reportedBounds.push_back(bounds);
+            terminationRequested |= storm::utility::resources::isTerminate();
+        }, 10);
+        auto result = checker.check(*formula);
+        
+        // The exceeded budget only stops this checker and does not request termination of the whole process.
+        std::stringstream statistics;
+        checker.printStatisticsToStream(statistics);
+        EXPECT_NE(std::string::npos, statistics.str().find("budget was exceeded"));
+        EXPECT_FALSE(terminationRequested);
+        EXPECT_FALSE(storm::utility::resources::isTerminate());
+        ASSERT_FALSE(reportedBounds.empty());
+        EXPECT_EQ(result.lowerBound, reportedBounds.back().lowerBound);
+        EXPECT_EQ(result.upperBound, reportedBounds.back().upperBound);
+        // The reported bounds only get tighter
+        for (uint64_t i = 1; i < reportedBounds.size(); ++i) {
+            EXPECT_LE(reportedBounds[i - 1].lowerBound, reportedBounds[i].lowerBound);
+            EXPECT_GE(reportedBounds[i - 1].upperBound, reportedBounds[i].upperBound);
+        }
+        // The bounds are still correct
+        double expected = 80.0 / 91.0;
+        EXPECT_LE(result.lowerBound, expected + 1e-6);
+        EXPECT_GE(result.upperBound, expected - 1e-6);
+    }
     
 }
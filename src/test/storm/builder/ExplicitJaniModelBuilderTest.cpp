@@ -156,3 +156,60 @@ TEST(ExplicitJaniModelBuilderTest, unassignedVariables) {
     EXPECT_EQ(25ul, model->getNumberOfStates());
     EXPECT_EQ(81ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitJaniModelBuilderTest, BytecodeExpressions) {
+    std::vector<storm::jani::Model> janiModels;
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"}) {
+        janiModels.push_back(storm::parser::PrismParser::parse(file).toJani().substituteConstantsFunctions());
+    }
+    janiModels.push_back(storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/mdp/unassigned-variables.jani").first);
+
+    for (auto const& janiModel : janiModels) {
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels();
+        generatorOptions.setBuildAllRewardModels();
+        auto model = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions).build();
+
+        generatorOptions.setUseBytecodeExpressions();
+        auto bytecodeModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions).build();
+        EXPECT_EQ(model->getNumberOfStates(), bytecodeModel->getNumberOfStates());
+        EXPECT_TRUE(model->getTransitionMatrix() == bytecodeModel->getTransitionMatrix());
+        EXPECT_TRUE(model->getStateLabeling() == bytecodeModel->getStateLabeling());
+    }
+}
+
+TEST(ExplicitJaniModelBuilderTest, MultiThreaded) {
+    // The generators of all threads share the expression manager of the model.
+    std::vector<storm::jani::Model> janiModels;
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"}) {
+        janiModels.push_back(storm::parser::PrismParser::parse(file).toJani().substituteConstantsFunctions());
+    }
+    janiModels.push_back(storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/mdp/unassigned-variables.jani").first);
+
+    for (auto const& janiModel : janiModels) {
+        for (bool useBytecodeExpressions : {false, true}) {
+            storm::generator::NextStateGeneratorOptions generatorOptions;
+            generatorOptions.setBuildAllLabels();
+            generatorOptions.setBuildAllRewardModels();
+            generatorOptions.setBuildStateValuations();
+            if (useBytecodeExpressions) {
+                generatorOptions.setUseBytecodeExpressions();
+            }
+            storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+            builderOptions.numberOfThreads = 1;
+            auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions, builderOptions).build();
+            uint64_t numberOfVariables = janiModel.getManager().getNumberOfVariables();
+
+            builderOptions.numberOfThreads = 4;
+            auto parallelModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions, builderOptions).build();
+            EXPECT_EQ(numberOfVariables, janiModel.getManager().getNumberOfVariables());
+            EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+            EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+            EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+            EXPECT_EQ(sequentialModel->getInitialStates(), parallelModel->getInitialStates());
+            for (uint64_t state = 0; state < sequentialModel->getNumberOfStates(); ++state) {
+                EXPECT_EQ(sequentialModel->getStateValuations().toString(state), parallelModel->getStateValuations().toString(state));
+            }
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
+#include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm-parsers/parser/PrismParser.h"
@@ -137,3 +138,82 @@ TEST(ExplicitPrismModelBuilderTest, FailUnbounded) {
     storm::prism::Program program = modelDescription.preprocess("N=7").asPrismProgram();
     STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::WrongFormatException);
 }
+
+TEST(ExplicitPrismModelBuilderTest, MultiThreaded) {
+    std::vector<std::string> files = {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"};
+    for (auto const& file : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels();
+        generatorOptions.setBuildAllRewardModels();
+        generatorOptions.setBuildStateValuations();
+
+        for (auto explorationOrder : {storm::builder::ExplorationOrder::Bfs, storm::builder::ExplorationOrder::Dfs}) {
+            storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+            builderOptions.explorationOrder = explorationOrder;
+            builderOptions.numberOfThreads = 1;
+            auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+
+            for (uint64_t numberOfThreads : {2, 4}) {
+                builderOptions.numberOfThreads = numberOfThreads;
+                auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+                EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+                EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+                EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+                for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+                    ASSERT_TRUE(parallelModel->hasRewardModel(rewardModel.first));
+                    auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+                    ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+                    if (rewardModel.second.hasStateRewards()) {
+                        EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+                    }
+                    ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+                    if (rewardModel.second.hasStateActionRewards()) {
+                        EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, BytecodeExpressions) {
+    std::vector<std::string> files = {STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm", STORM_TEST_RESOURCES_DIR "/ma/stream2.ma"};
+    for (auto const& file : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file, true);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels();
+        generatorOptions.setBuildAllRewardModels();
+        auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+
+        generatorOptions.setUseBytecodeExpressions();
+        auto bytecodeModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        EXPECT_EQ(model->getNumberOfStates(), bytecodeModel->getNumberOfStates());
+        EXPECT_TRUE(model->getTransitionMatrix() == bytecodeModel->getTransitionMatrix());
+        EXPECT_TRUE(model->getStateLabeling() == bytecodeModel->getStateLabeling());
+        for (auto const& rewardModel : model->getRewardModels()) {
+            ASSERT_TRUE(bytecodeModel->hasRewardModel(rewardModel.first));
+            auto const& bytecodeRewardModel = bytecodeModel->getRewardModel(rewardModel.first);
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), bytecodeRewardModel.getStateRewardVector());
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), bytecodeRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, BytecodeExpressionsExact) {
+    // Bytecode computes with doubles, so exact models are built with the default evaluator.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    auto model = storm::builder::ExplicitModelBuilder<storm::RationalNumber>(program, generatorOptions).build();
+
+    generatorOptions.setUseBytecodeExpressions();
+    auto bytecodeModel = storm::builder::ExplicitModelBuilder<storm::RationalNumber>(program, generatorOptions).build();
+    EXPECT_EQ(model->getNumberOfStates(), bytecodeModel->getNumberOfStates());
+    EXPECT_TRUE(model->getTransitionMatrix() == bytecodeModel->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == bytecodeModel->getStateLabeling());
+}
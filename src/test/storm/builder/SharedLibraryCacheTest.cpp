@@ -0,0 +1,85 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <ctime>
+#include <fstream>
+
+#include "storm/builder/jit/SharedLibraryCache.h"
+
+namespace {
+    class SharedLibraryCacheTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%");
+            library = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.so");
+            std::ofstream libraryFile(library.native(), std::ios::binary);
+            libraryFile << std::string(100, 'x');
+        }
+
+        void TearDown() override {
+            boost::filesystem::remove_all(directory);
+            boost::filesystem::remove(library);
+        }
+
+        boost::filesystem::path directory;
+        boost::filesystem::path library;
+    };
+}
+
+TEST_F(SharedLibraryCacheTest, FindAndInsert) {
+    storm::builder::jit::SharedLibraryCache cache(directory, 1024 * 1024, ".so");
+    EXPECT_FALSE(static_cast<bool>(cache.find("first")));
+
+    boost::filesystem::path cachedLibrary = cache.insert("first", library);
+    EXPECT_TRUE(boost::filesystem::exists(cachedLibrary));
+    EXPECT_EQ(100ull, boost::filesystem::file_size(cachedLibrary));
+
+    auto result = cache.find("first");
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(cachedLibrary, result.get());
+    EXPECT_FALSE(static_cast<bool>(cache.find("second")));
+
+    // A second cache on the same directory sees the entry.
+    storm::builder::jit::SharedLibraryCache otherCache(directory, 1024 * 1024, ".so");
+    EXPECT_TRUE(static_cast<bool>(otherCache.find("first")));
+
+    EXPECT_EQ(storm::builder::jit::SharedLibraryCache::computeKey("first"), storm::builder::jit::SharedLibraryCache::computeKey("first"));
+    EXPECT_NE(storm::builder::jit::SharedLibraryCache::computeKey("first"), storm::builder::jit::SharedLibraryCache::computeKey("second"));
+}
+
+TEST_F(SharedLibraryCacheTest, DescriptionMismatch) {
+    storm::builder::jit::SharedLibraryCache cache(directory, 1024 * 1024, ".so");
+    boost::filesystem::path cachedLibrary = cache.insert("first", library);
+
+    // Simulate a hash collision by overwriting the stored description.
+    boost::filesystem::path descriptionPath = cachedLibrary;
+    descriptionPath.replace_extension(".key");
+    {
+        std::ofstream descriptionFile(descriptionPath.native(), std::ios::binary);
+        descriptionFile << "colliding";
+    }
+    EXPECT_FALSE(static_cast<bool>(cache.find("first")));
+}
+
+TEST_F(SharedLibraryCacheTest, Eviction) {
+    // Two entries fit into the cache, three do not.
+    storm::builder::jit::SharedLibraryCache cache(directory, 250, ".so");
+    boost::filesystem::path first = cache.insert("first", library);
+    boost::filesystem::path second = cache.insert("second", library);
+    EXPECT_TRUE(boost::filesystem::exists(first));
+    EXPECT_TRUE(boost::filesystem::exists(second));
+
+    std::time_t now = std::time(nullptr);
+    boost::filesystem::last_write_time(first, now - 100);
+    boost::filesystem::last_write_time(second, now - 50);
+
+    // Using the first entry makes the second one the least recently used.
+    EXPECT_TRUE(static_cast<bool>(cache.find("first")));
+
+    boost::filesystem::path third = cache.insert("third", library);
+    EXPECT_TRUE(boost::filesystem::exists(first));
+    EXPECT_FALSE(boost::filesystem::exists(second));
+    EXPECT_TRUE(boost::filesystem::exists(third));
+    EXPECT_FALSE(static_cast<bool>(cache.find("second")));
+    EXPECT_LE(cache.getSize(), 250ull);
+}
@@ -3,6 +3,7 @@
 #include "storm-config.h"
 
 #include "storm/api/builder.h"
+#include "storm/api/verification.h"
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm/api/properties.h"
 #include "storm-conv/api/storm-conv.h"
@@ -18,6 +19,7 @@
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
@@ -27,6 +29,7 @@
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 
 namespace {
     
@@ -446,4 +449,102 @@ namespace {
         EXPECT_NEAR(0.404043, result[0], 1e-6);
         EXPECT_NEAR(0.595957, result[1], 1e-6);
     }
+
+    TEST(CtmcCslModelCheckerTest, AdaptiveUniformization) {
+        // A chain of slow states followed by two fast states.
+        uint64_t numberOfSlowStates = 50;
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        for (uint64_t state = 0; state < numberOfSlowStates; ++state) {
+            matrixBuilder.addNextValue(state, state + 1, 1.0);
+        }
+        matrixBuilder.addNextValue(numberOfSlowStates, numberOfSlowStates + 1, 1000.0);
+        matrixBuilder.addNextValue(numberOfSlowStates + 1, numberOfSlowStates, 500.0);
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+        uint64_t numberOfStates = matrix.getRowCount();
+
+        std::vector<double> exitRates = matrix.getRowSumVector();
+        storm::storage::BitVector initialStates(numberOfStates);
+        initialStates.set(0);
+        storm::storage::BitVector phiStates(numberOfStates);
+        storm::storage::BitVector psiStates(numberOfStates);
+
+        storm::Environment env;
+        env.solver().timeBounded().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        storm::Environment adaptiveEnv = env;
+        adaptiveEnv.solver().timeBounded().setAdaptiveUniformization(true);
+
+        for (double timeBound : {0.5, 5.0, 60.0}) {
+            std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(env, matrix, initialStates, phiStates, psiStates, exitRates, timeBound);
+            std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(adaptiveEnv, matrix, initialStates, phiStates, psiStates, exitRates, timeBound);
+            ASSERT_EQ(expected.size(), result.size());
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                EXPECT_NEAR(expected[state], result[state], 1e-7);
+            }
+        }
+
+        // Poisson probabilities of the slow chain.
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(adaptiveEnv, matrix, initialStates, phiStates, psiStates, exitRates, 2.0);
+        EXPECT_NEAR(std::exp(-2.0), result[0], 1e-7);
+        EXPECT_NEAR(2.0 * std::exp(-2.0), result[1], 1e-7);
+    }
+
+    TEST(CtmcCslModelCheckerTest, TransientProbabilitiesForTimeBounds) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        matrixBuilder.addNextValue(0, 1, 3.0);
+        matrixBuilder.addNextValue(1, 0, 2.0);
+        matrixBuilder.addNextValue(1, 2, 1.0);
+        matrixBuilder.addNextValue(2, 2, 1.0);
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+        std::vector<double> exitRates = {3, 3, 1};
+
+        double uniformizationRate = 3.06;
+        storm::storage::SparseMatrix<double> uniformizedMatrix = storm::modelchecker::helper::SparseCtmcCslHelper::computeUniformizedMatrix(matrix, storm::storage::BitVector(3, true), uniformizationRate, exitRates);
+        std::vector<double> values = {0.0, 0.0, 1.0};
+        std::vector<double> timeBounds = {0.0, 0.5, 2.0, 0.5, 10.0};
+
+        for (bool adaptive : {false, true}) {
+            storm::Environment env;
+            env.solver().timeBounded().setAdaptiveUniformization(adaptive);
+            std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds<double>(env, uniformizedMatrix, nullptr, timeBounds, uniformizationRate, values, 1e-8);
+            ASSERT_EQ(timeBounds.size(), results.size());
+            for (uint64_t index = 0; index < timeBounds.size(); ++index) {
+                std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double>(env, uniformizedMatrix, nullptr, timeBounds[index], uniformizationRate, values, 1e-8);
+                ASSERT_EQ(expected.size(), results[index].size());
+                for (uint64_t state = 0; state < expected.size(); ++state) {
+                    EXPECT_NEAR(expected[state], results[index][state], 1e-7);
+                }
+            }
+        }
+    }
+
+    TEST(CtmcCslModelCheckerTest, BoundedUntilForTimeBounds) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        matrixBuilder.addNextValue(0, 1, 3.0);
+        matrixBuilder.addNextValue(1, 0, 2.0);
+        matrixBuilder.addNextValue(1, 2, 1.0);
+        matrixBuilder.addNextValue(2, 2, 1.0);
+        storm::models::sparse::StateLabeling labeling(3);
+        labeling.addLabel("init");
+        labeling.addLabelToState("init", 0);
+        labeling.addLabel("goal");
+        labeling.addLabelToState("goal", 2);
+        std::shared_ptr<storm::models::sparse::Model<double>> ctmc = std::make_shared<storm::models::sparse::Ctmc<double>>(matrixBuilder.build(), labeling);
+        
+        storm::parser::FormulaParser formulaParser;
+        storm::Environment env;
+        std::vector<double> timeBounds = {0.0, 0.5, 2.0, 2.0, 10.0, storm::utility::infinity<double>()};
+        auto results = storm::api::verifyWithSparseEngineForTimeBounds<double>(env, ctmc, storm::api::createTask<double>(formulaParser.parseSingleFormulaFromString("P=? [F<=1 \"goal\"]")), timeBounds);
+        ASSERT_EQ(timeBounds.size(), results.size());
+        for (uint64_t index = 0; index < timeBounds.size(); ++index) {
+            std::string formulaString = storm::utility::isInfinity(timeBounds[index]) ? "P=? [F \"goal\"]" : "P=? [F<=" + std::to_string(timeBounds[index]) + " \"goal\"]";
+            auto expected = storm::api::verifyWithSparseEngine<double>(env, ctmc, storm::api::createTask<double>(formulaParser.parseSingleFormulaFromString(formulaString)));
+            auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            auto const& values = results[index]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(expectedValues.size(), values.size());
+            for (uint64_t state = 0; state < values.size(); ++state) {
+                EXPECT_NEAR(expectedValues[state], values[state], 1e-6);
+            }
+        }
+        EXPECT_NEAR(1.0, results.back()->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+    }
 }
@@ -4,6 +4,7 @@
 #include "test/storm_gtest.h"
 
 #include "storm/api/builder.h"
+#include "storm/api/verification.h"
 #include "storm-conv/api/storm-conv.h"
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm/api/properties.h"
@@ -349,4 +350,31 @@ namespace {
         }
 #endif
     }
+
+    TEST(MarkovAutomatonCslModelCheckerTest, BoundedUntilForTimeBounds) {
+        std::string formulasString = "Pmax=? [F<=1.3 s=3]";
+                 formulasString += "; Pmax=? [F<=0.5 s=3]";
+                 formulasString += "; Pmax=? [F<=3 s=3]";
+        
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
+        program = storm::utility::prism::preprocess(program, "");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas);
+        storm::Environment env;
+        
+        // The time bound of the formula is replaced by the given ones, which need not be sorted.
+        std::vector<double> timeBounds = {1.3, 0.5, 3.0, 0.0};
+        auto results = storm::api::verifyWithSparseEngineForTimeBounds<double>(env, model, storm::api::createTask<double>(formulas[0], true), timeBounds);
+        ASSERT_EQ(timeBounds.size(), results.size());
+        storm::modelchecker::ExplicitQualitativeCheckResult initialStates(model->getInitialStates());
+        for (uint64_t index = 0; index < formulas.size(); ++index) {
+            auto expected = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas[index], true));
+            expected->filter(initialStates);
+            results[index]->filter(initialStates);
+            EXPECT_NEAR(expected->asQuantitativeCheckResult<double>().getMin(), results[index]->asQuantitativeCheckResult<double>().getMin(), 2e-6);
+        }
+        EXPECT_NEAR(0.727468207, results[0]->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+        results[3]->filter(initialStates);
+        EXPECT_EQ(0.0, results[3]->asQuantitativeCheckResult<double>().getMin());
+    }
 }
@@ -10,6 +10,9 @@
 #include "storm/api/storm.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
+#include "storm/solver/LinearEquationSolver.h"
 
 TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_die) {
     storm::Environment env;
@@ -99,3 +102,52 @@ TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
     ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
     EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")), result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
+
+TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds_parallel_epochs) {
+    typedef storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<double, true> RewardUnfolding;
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
+    std::string formulasAsString = "P=? [F{\"num_runs\"}<=3,{\"observe0\"}>1 true]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "CrowdSize=4");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+
+    RewardUnfolding rewardUnfolding(*dtmc, std::dynamic_pointer_cast<storm::logic::OperatorFormula const>(formulas[0]));
+    auto initEpoch = rewardUnfolding.getStartEpoch();
+    auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+    auto epochLayers = rewardUnfolding.getEpochComputationLayers(initEpoch);
+
+    // Each epoch occurs in exactly one layer and all epochs of a layer belong to the same epoch class.
+    std::set<RewardUnfolding::Epoch> layeredEpochs;
+    uint64_t numLayeredEpochs = 0;
+    for (auto const& layer : epochLayers) {
+        ASSERT_FALSE(layer.empty());
+        for (auto const& epoch : layer) {
+            EXPECT_TRUE(rewardUnfolding.getEpochManager().compareEpochClass(layer.front(), epoch));
+            layeredEpochs.insert(epoch);
+            ++numLayeredEpochs;
+        }
+    }
+    EXPECT_EQ(epochOrder.size(), numLayeredEpochs);
+    EXPECT_EQ(std::set<RewardUnfolding::Epoch>(epochOrder.begin(), epochOrder.end()), layeredEpochs);
+    EXPECT_LT(epochLayers.size(), epochOrder.size());
+
+    double precision = 1e-6;
+    storm::Environment env;
+    env.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, precision)));
+    storm::solver::GeneralLinearEquationSolverFactory<double> linearEquationSolverFactory;
+    rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(env));
+    auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
+    auto upperBound = rewardUnfolding.getUpperObjectiveBound();
+
+    uint64_t numberOfThreads = 4;
+    std::vector<std::vector<double>> x(numberOfThreads), b(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<double>>> linEqSolver(numberOfThreads);
+    uint64_t numAnalyzedEpochs = rewardUnfolding.analyzeEpochs(epochLayers, numberOfThreads, [&] (uint64_t threadIndex, RewardUnfolding::Epoch const&, storm::modelchecker::helper::rewardbounded::EpochModel<double, true>& epochModel) {
+        return epochModel.analyzeSingleObjective(env, x[threadIndex], b[threadIndex], linEqSolver[threadIndex], lowerBound, upperBound);
+    }, [] (RewardUnfolding::Epoch const&) { return true; });
+    EXPECT_EQ(epochOrder.size(), numAnalyzedEpochs);
+    EXPECT_NEAR(78686542099694893.0 / 1268858272000000000.0, rewardUnfolding.getInitialStateResult(initEpoch), precision);
+}
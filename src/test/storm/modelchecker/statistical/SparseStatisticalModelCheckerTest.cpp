@@ -0,0 +1,107 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+    storm::Environment getEnvironment() {
+        storm::Environment env;
+        env.modelchecker().statistical().setSeed(42);
+        env.modelchecker().statistical().setPrecision(0.01);
+        env.modelchecker().statistical().setErrorProbability(0.001);
+        return env;
+    }
+
+    template<typename ModelType>
+    std::pair<std::shared_ptr<ModelType>, std::vector<std::shared_ptr<storm::logic::Formula const>>> buildModelFormulas(std::string const& pathToPrismFile, std::string const& formulasAsString) {
+        storm::prism::Program program = storm::api::parseProgram(pathToPrismFile);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+        return std::make_pair(storm::api::buildSparseModel<double>(program, formulas)->template as<ModelType>(), formulas);
+    }
+
+    TEST(SparseStatisticalModelCheckerTest, Die) {
+        storm::Environment env = getEnvironment();
+        std::string formulasString = "P=? [F \"one\"]; P=? [F<=3 \"done\"]; P=? [X s=1]; P=? [s!=2 U \"done\"]; P>=0.1 [F \"one\"]; P<0.2 [F \"one\"]; P>0.2 [F \"one\"]";
+        auto modelFormulas = buildModelFormulas<storm::models::sparse::Dtmc<double>>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", formulasString);
+        auto const& dtmc = *modelFormulas.first;
+        auto const& formulas = modelFormulas.second;
+        uint64_t initialState = *dtmc.getInitialStates().begin();
+
+        storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(dtmc);
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> exactChecker(dtmc);
+        for (uint64_t i = 0; i < 4; ++i) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas[i], true);
+            ASSERT_TRUE(checker.canHandle(task));
+            auto result = checker.check(env, task);
+            auto exactResult = exactChecker.check(env, task);
+            EXPECT_NEAR(exactResult->asExplicitQuantitativeCheckResult<double>()[initialState], result->asExplicitQuantitativeCheckResult<double>()[initialState], 0.01);
+        }
+
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[4], true));
+        EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initialState]);
+        result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[5], true));
+        EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initialState]);
+        env.modelchecker().statistical().setHypothesisTestMethod(storm::modelchecker::HypothesisTestMethod::Chernoff);
+        result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[6], true));
+        EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[initialState]);
+
+        // Formulas that are not restricted to the initial states can not be handled.
+        EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0], false)));
+    }
+
+    TEST(SparseStatisticalModelCheckerTest, MultipleThreads) {
+        storm::Environment env = getEnvironment();
+        auto modelFormulas = buildModelFormulas<storm::models::sparse::Dtmc<double>>(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", "P=? [F observe0>1]");
+        auto const& dtmc = *modelFormulas.first;
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*modelFormulas.second.front(), true);
+        uint64_t initialState = *dtmc.getInitialStates().begin();
+
+        storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(dtmc);
+        double singleThreadResult = checker.check(env, task)->asExplicitQuantitativeCheckResult<double>()[initialState];
+        env.modelchecker().statistical().setNumberOfThreads(4);
+        double multiThreadResult = checker.check(env, task)->asExplicitQuantitativeCheckResult<double>()[initialState];
+        // The paths do not depend on the number of threads.
+        EXPECT_EQ(singleThreadResult, multiThreadResult);
+
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> exactChecker(dtmc);
+        EXPECT_NEAR(exactChecker.check(env, task)->asExplicitQuantitativeCheckResult<double>()[initialState], multiThreadResult, 0.01);
+    }
+
+    TEST(SparseStatisticalModelCheckerTest, MdpWithScheduler) {
+        storm::Environment env = getEnvironment();
+        auto modelFormulas = buildModelFormulas<storm::models::sparse::Mdp<double>>(STORM_TEST_RESOURCES_DIR "/mdp/die_selection.nm", "Pmax=? [F \"one\"]; Pmin=? [F \"one\"]");
+        auto const& mdp = *modelFormulas.first;
+        auto const& formulas = modelFormulas.second;
+        uint64_t initialState = *mdp.getInitialStates().begin();
+
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> exactChecker(mdp);
+        for (auto const& formula : formulas) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+            task.setProduceSchedulers(true);
+            auto exactResult = exactChecker.check(env, task);
+            auto const& quantitativeResult = exactResult->asExplicitQuantitativeCheckResult<double>();
+            ASSERT_TRUE(quantitativeResult.hasScheduler());
+            auto scheduler = std::make_shared<storm::storage::Scheduler<double>>(quantitativeResult.getScheduler());
+
+            storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Mdp<double>> checker(mdp, scheduler);
+            auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true));
+            EXPECT_NEAR(quantitativeResult[initialState], result->asExplicitQuantitativeCheckResult<double>()[initialState], 0.01);
+        }
+    }
+}
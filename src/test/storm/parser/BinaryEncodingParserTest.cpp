@@ -0,0 +1,165 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstddef>
+#include <fstream>
+#include <limits>
+
+#include <boost/filesystem.hpp>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/api/export.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        boost::filesystem::path file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.bin");
+        storm::api::exportSparseModelAsBinary(model, file.string());
+        auto result = storm::parser::BinaryEncodingParser<double>::parseModel(file.string());
+        boost::filesystem::remove(file);
+        return result;
+    }
+
+    /*!
+     * Exports the given model, overwrites the 64-bit words at the given positions of the file and parses the result.
+     */
+    void exportCorruptAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::vector<std::pair<uint64_t, uint64_t>> const& positionsAndValues) {
+        boost::filesystem::path file = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.bin");
+        storm::api::exportSparseModelAsBinary(model, file.string());
+        {
+            std::fstream stream(file.string(), std::ios::in | std::ios::out | std::ios::binary);
+            for (auto const& positionAndValue : positionsAndValues) {
+                stream.seekp(positionAndValue.first);
+                stream.write(reinterpret_cast<char const*>(&positionAndValue.second), sizeof(positionAndValue.second));
+            }
+        }
+        try {
+            storm::parser::BinaryEncodingParser<double>::parseModel(file.string());
+        } catch (...) {
+            boost::filesystem::remove(file);
+            throw;
+        }
+        boost::filesystem::remove(file);
+    }
+
+    void exportCorruptAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model, uint64_t position, uint64_t value) {
+        exportCorruptAndParse(model, {{position, value}});
+    }
+
+    /*!
+     * Retrieves the position of the section that follows the transition matrix of the given model in the binary format.
+     */
+    uint64_t getPositionAfterMatrix(storm::models::sparse::Model<double> const& model) {
+        auto const& matrix = model.getTransitionMatrix();
+        uint64_t position = sizeof(storm::exporter::BinaryEncodingHeader);
+        if (!matrix.hasTrivialRowGrouping()) {
+            position += (matrix.getRowGroupCount() + 1) * sizeof(uint64_t);
+        }
+        position += (matrix.getRowCount() + 1) * sizeof(uint64_t);
+        return position + matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, double>);
+    }
+
+    void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+        EXPECT_EQ(expected.getType(), actual.getType());
+        EXPECT_EQ(expected.getTransitionMatrix(), actual.getTransitionMatrix());
+        EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+        EXPECT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling());
+        EXPECT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+        for (auto const& rewardModel : expected.getRewardModels()) {
+            ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+            auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+            EXPECT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+            EXPECT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+            EXPECT_EQ(rewardModel.second.hasTransitionRewards(), actualRewardModel.hasTransitionRewards());
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+}
+
+TEST(BinaryEncodingParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+}
+
+TEST(BinaryEncodingParserTest, MdpRoundTrip) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+    ASSERT_TRUE(parsedModel->hasChoiceLabeling());
+    EXPECT_EQ(model->getChoiceLabeling(), parsedModel->getChoiceLabeling());
+}
+
+TEST(BinaryEncodingParserTest, MaRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto parsedModel = exportAndParse(model);
+    expectEqualModels(*model, *parsedModel);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto parsedMa = parsedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getMarkovianStates(), parsedMa->getMarkovianStates());
+    EXPECT_EQ(ma->getExitRates(), parsedMa->getExitRates());
+}
+
+TEST(BinaryEncodingParserTest, WrongFormat) {
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryEncodingParserTest, CorruptedMatrix) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    uint64_t const stateCount = model->getNumberOfStates();
+    uint64_t const choiceCount = model->getTransitionMatrix().getRowCount();
+    // The header is followed by the row groups, the row indications and the entries (column and value).
+    uint64_t const rowGroupsPosition = sizeof(storm::exporter::BinaryEncodingHeader);
+    uint64_t const entriesPosition = rowGroupsPosition + (stateCount + 1) * sizeof(uint64_t) + (choiceCount + 1) * sizeof(uint64_t);
+
+    // Row groups that are not non-decreasing.
+    STORM_SILENT_EXPECT_THROW(exportCorruptAndParse(model, rowGroupsPosition + sizeof(uint64_t), choiceCount + 1), storm::exceptions::WrongFormatException);
+    // A column outside of the matrix.
+    STORM_SILENT_EXPECT_THROW(exportCorruptAndParse(model, entriesPosition, stateCount), storm::exceptions::WrongFormatException);
+    // The unmodified file is still accepted.
+    EXPECT_NO_THROW(exportCorruptAndParse(model, entriesPosition, model->getTransitionMatrix().begin()->getColumn()));
+}
+
+TEST(BinaryEncodingParserTest, CorruptedSizes) {
+    uint64_t const hugeSize = 1ull << 62;
+    
+    // A number of rows for which the number of row indications overflows.
+    auto dtmc = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    uint64_t const stateCountPosition = offsetof(storm::exporter::BinaryEncodingHeader, stateCount);
+    uint64_t const choiceCountPosition = offsetof(storm::exporter::BinaryEncodingHeader, choiceCount);
+    uint64_t const maxCount = std::numeric_limits<uint64_t>::max();
+    STORM_SILENT_EXPECT_THROW(exportCorruptAndParse(dtmc, {{stateCountPosition, maxCount}, {choiceCountPosition, maxCount}}), storm::exceptions::WrongFormatException);
+    // More rows than the file can hold.
+    STORM_SILENT_EXPECT_THROW(exportCorruptAndParse(dtmc, {{stateCountPosition, hugeSize}, {choiceCountPosition, hugeSize}}), storm::exceptions::WrongFormatException);
+    
+    // The Markovian states follow the matrix and the exit rates.
+    auto ma = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    uint64_t const stateCount = ma->getNumberOfStates();
+    uint64_t const markovianStatesPosition = getPositionAfterMatrix(*ma) + stateCount * sizeof(double);
+    // Markovian states that do not match the number of states.
+    STORM_SILENT_EXPECT_THROW(exportCorruptAndParse(ma, markovianStatesPosition, stateCount + 1), storm::exceptions::WrongFormatException);
+    // Markovian states that exceed the remaining input.
+    STORM_SILENT_EXPECT_THROW(exportCorruptAndParse(ma, markovianStatesPosition, hugeSize), storm::exceptions::WrongFormatException);
+    
+    // The state labeling follows the Markovian states. It starts with the number of labels and the name of the first label (in alphabetical order).
+    uint64_t const labelingPosition = markovianStatesPosition + sizeof(uint64_t) * (1 + (stateCount + 63) / 64);
+    uint64_t const firstLabelLength = ma->getStateLabeling().getLabels().begin()->size();
+    uint64_t const firstLabelStatesPosition = labelingPosition + 2 * sizeof(uint64_t) + (firstLabelLength + 7) / 8 * 8;
+    // A label whose states do not match the number of states.
+    STORM_SILENT_EXPECT_THROW(exportCorruptAndParse(ma, firstLabelStatesPosition, stateCount - 1), storm::exceptions::WrongFormatException);
+    // A label whose states exceed the remaining input.
+    STORM_SILENT_EXPECT_THROW(exportCorruptAndParse(ma, firstLabelStatesPosition, hugeSize), storm::exceptions::WrongFormatException);
+    // The unmodified sizes are still accepted.
+    EXPECT_NO_THROW(exportCorruptAndParse(ma, {{markovianStatesPosition, stateCount}, {firstLabelStatesPosition, stateCount}}));
+}
@@ -120,4 +120,61 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
+    TEST(MultiplierTest, NativeMultiThreaded) {
+        // Build a matrix that is large enough such that the multiplication is distributed among threads.
+        // Row groups and rows have varying sizes so that the partition does not align with row group boundaries.
+        uint64_t const numberOfRowGroups = 20000;
+        storm::storage::SparseMatrixBuilder<double> builder(0, numberOfRowGroups, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+            builder.newRowGroup(row);
+            for (uint64_t choice = 0; choice < 1 + (group % 3); ++choice, ++row) {
+                uint64_t const numberOfEntries = 1 + ((group * 7 + choice) % 11);
+                for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                    builder.addNextValue(row, (group * 13 + choice) % (numberOfRowGroups - 1200) + entry * 101, 1.0 / numberOfEntries);
+                }
+            }
+        }
+        storm::storage::SparseMatrix<double> A = builder.build();
+        
+        std::vector<double> x(numberOfRowGroups);
+        for (uint64_t i = 0; i < x.size(); ++i) {
+            x[i] = static_cast<double>(i % 17) / 17.0;
+        }
+        std::vector<double> b(A.getRowCount());
+        for (uint64_t i = 0; i < b.size(); ++i) {
+            b[i] = static_cast<double>(i % 5) / 50.0;
+        }
+        
+        storm::Environment sequentialEnv;
+        sequentialEnv.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        sequentialEnv.solver().multiplier().setNumberOfThreads(1);
+        storm::Environment parallelEnv = sequentialEnv;
+        parallelEnv.solver().multiplier().setNumberOfThreads(4);
+        
+        auto factory = storm::solver::MultiplierFactory<double>();
+        auto sequentialMultiplier = factory.create(sequentialEnv, A);
+        auto parallelMultiplier = factory.create(parallelEnv, A);
+        
+        std::vector<double> sequentialResult(A.getRowCount()), parallelResult(A.getRowCount());
+        sequentialMultiplier->multiply(sequentialEnv, x, &b, sequentialResult);
+        parallelMultiplier->multiply(parallelEnv, x, &b, parallelResult);
+        EXPECT_EQ(sequentialResult, parallelResult);
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<uint64_t> sequentialChoices(numberOfRowGroups, 0), parallelChoices(numberOfRowGroups, 0);
+            sequentialResult.assign(numberOfRowGroups, 0.0);
+            parallelResult.assign(numberOfRowGroups, 0.0);
+            sequentialMultiplier->multiplyAndReduce(sequentialEnv, dir, x, &b, sequentialResult, &sequentialChoices);
+            parallelMultiplier->multiplyAndReduce(parallelEnv, dir, x, &b, parallelResult, &parallelChoices);
+            EXPECT_EQ(sequentialResult, parallelResult);
+            EXPECT_EQ(sequentialChoices, parallelChoices);
+            
+            std::vector<double> sequentialX = x, parallelX = x;
+            sequentialMultiplier->repeatedMultiplyAndReduce(sequentialEnv, dir, sequentialX, nullptr, 10);
+            parallelMultiplier->repeatedMultiplyAndReduce(parallelEnv, dir, parallelX, nullptr, 10);
+            EXPECT_EQ(sequentialX, parallelX);
+        }
+    }
+    
 }
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace {
+    storm::storage::BitVector createKey(uint64_t bucketSize, uint64_t index) {
+        storm::storage::BitVector key(bucketSize);
+        key.setFromInt(0, 64, index * 0x9E3779B97F4A7C15ull);
+        for (uint64_t word = 1; word < bucketSize / 64; ++word) {
+            key.setFromInt(word * 64, 64, index + word);
+        }
+        return key;
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+
+    EXPECT_EQ(std::make_pair(0ul, true), map.findOrAdd(first));
+    EXPECT_EQ(std::make_pair(1ul, true), map.findOrAdd(second));
+    EXPECT_EQ(std::make_pair(0ul, false), map.findOrAdd(first));
+    EXPECT_EQ(std::make_pair(1ul, false), map.findOrAdd(second));
+
+    // Insert enough keys to trigger the growth of the table several times.
+    for (uint64_t index = 0; index < 1000; ++index) {
+        map.findOrAdd(createKey(64, index));
+    }
+    EXPECT_EQ(1002ul, map.size());
+    EXPECT_LE(1002ul, map.capacity());
+
+    EXPECT_TRUE(map.contains(first));
+    EXPECT_TRUE(map.contains(second));
+    EXPECT_EQ(0ul, map.getValue(first));
+    EXPECT_EQ(1ul, map.getValue(second));
+    EXPECT_EQ(first, map.getKey(0));
+    EXPECT_EQ(second, map.getKey(1));
+    for (uint64_t index = 0; index < 1000; ++index) {
+        auto key = createKey(64, index);
+        EXPECT_TRUE(map.contains(key));
+        EXPECT_EQ(key, map.getKey(map.getValue(key)));
+    }
+
+    storm::storage::BitVector unknown(64);
+    unknown.set(1);
+    unknown.set(2);
+    EXPECT_FALSE(map.contains(unknown));
+
+    // Releasing the replaced tables must neither lose keys nor prevent further growth.
+    uint64_t capacity = map.capacity();
+    map.releaseRetiredTables();
+    EXPECT_EQ(capacity, map.capacity());
+    EXPECT_EQ(0ul, map.getValue(first));
+    EXPECT_EQ(1ul, map.getValue(second));
+    for (uint64_t index = 1000; index < 3000; ++index) {
+        map.findOrAdd(createKey(64, index));
+    }
+    map.releaseRetiredTables();
+    EXPECT_EQ(3002ul, map.size());
+    for (uint64_t index = 0; index < 3000; ++index) {
+        EXPECT_TRUE(map.contains(createKey(64, index)));
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    uint64_t const numberOfKeys = 100000;
+    uint64_t const numberOfThreads = 4;
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 2);
+
+    // Every thread inserts all keys (in different orders), so every key needs to be added exactly once.
+    std::vector<std::vector<uint32_t>> values(numberOfThreads, std::vector<uint32_t>(numberOfKeys));
+    std::vector<uint64_t> numberOfAddedKeys(numberOfThreads, 0);
+    storm::utility::parallel::runOnThreads(numberOfThreads, [&] (uint64_t threadIndex) {
+        for (uint64_t step = 0; step < numberOfKeys; ++step) {
+            uint64_t index = (step * 7919 + threadIndex * 104729) % numberOfKeys;
+            auto valueAddedPair = map.findOrAdd(createKey(128, index));
+            values[threadIndex][index] = valueAddedPair.first;
+            if (valueAddedPair.second) {
+                ++numberOfAddedKeys[threadIndex];
+            }
+        }
+    });
+
+    uint64_t totalNumberOfAddedKeys = 0;
+    for (auto const& count : numberOfAddedKeys) {
+        totalNumberOfAddedKeys += count;
+    }
+    EXPECT_EQ(numberOfKeys, totalNumberOfAddedKeys);
+    EXPECT_EQ(numberOfKeys, map.size());
+
+    storm::storage::BitVector usedValues(numberOfKeys, false);
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+            ASSERT_EQ(values[0][index], values[threadIndex][index]);
+        }
+        ASSERT_LT(values[0][index], numberOfKeys);
+        EXPECT_FALSE(usedValues.get(values[0][index]));
+        usedValues.set(values[0][index]);
+        EXPECT_EQ(createKey(128, index), map.getKey(values[0][index]));
+    }
+}
+
+// Compares the throughput of the concurrent map with the sequential BitVectorHashMap for 10^6 up to 10^9 keys. The
+// largest number of keys can be limited by setting the environment variable STORM_BENCHMARK_MAX_KEYS.
+// Run with --gtest_also_run_disabled_tests.
+TEST(ConcurrentBitVectorHashMapTest, DISABLED_Benchmark) {
+    uint64_t maximalNumberOfKeys = 1000000000ull;
+    if (char const* maximalNumberOfKeysString = std::getenv("STORM_BENCHMARK_MAX_KEYS")) {
+        maximalNumberOfKeys = std::stoull(maximalNumberOfKeysString);
+    }
+    uint64_t const numberOfThreads = storm::utility::parallel::getNumberOfThreads(0);
+
+    for (uint64_t numberOfKeys = 1000000; numberOfKeys <= maximalNumberOfKeys; numberOfKeys *= 10) {
+        storm::utility::Stopwatch sequentialWatch(true);
+        {
+            storm::storage::BitVectorHashMap<uint32_t> map(64, 1000);
+            for (uint64_t index = 0; index < numberOfKeys; ++index) {
+                map.findOrAdd(createKey(64, index), map.size());
+            }
+            // Query every key a second time as it happens during state space exploration.
+            for (uint64_t index = 0; index < numberOfKeys; ++index) {
+                map.findOrAdd(createKey(64, index), map.size());
+            }
+        }
+        sequentialWatch.stop();
+
+        storm::utility::Stopwatch concurrentWatch(true);
+        {
+            storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(64, 1000);
+            storm::utility::parallel::runOnThreads(numberOfThreads, [&] (uint64_t threadIndex) {
+                for (uint64_t index = threadIndex; index < numberOfKeys; index += numberOfThreads) {
+                    map.findOrAdd(createKey(64, index));
+                }
+                for (uint64_t index = threadIndex; index < numberOfKeys; index += numberOfThreads) {
+                    map.findOrAdd(createKey(64, index));
+                }
+            });
+            EXPECT_EQ(numberOfKeys, map.size());
+        }
+        concurrentWatch.stop();
+
+        std::cout << numberOfKeys << " keys: BitVectorHashMap " << sequentialWatch << ", ConcurrentBitVectorHashMap (" << numberOfThreads << " threads) " << concurrentWatch << "." << std::endl;
+    }
+}
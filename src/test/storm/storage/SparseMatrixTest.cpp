@@ -1,9 +1,11 @@
 #include "test/storm_gtest.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
+#include "storm/utility/simd.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 TEST(SparseMatrixBuilder, CreationWithDimensions) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 4, 5);
@@ -792,3 +794,92 @@ TEST(SparseMatrix, Permute) {
     EXPECT_EQ(matrix.getRowSum(3), matrixperm.getRowSum(3));
     EXPECT_EQ(matrix.getRowSum(2), matrixperm.getRowSum(4));
 }
+
+TEST(SparseMatrix, VectorizedMultiplications) {
+    // A matrix with empty row groups, empty rows and rows and row groups of different sizes.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    uint64_t const numberOfRowGroups = 500;
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+        matrixBuilder.newRowGroup(row);
+        uint64_t const numberOfRows = (group % 7 == 0) ? 0 : 1 + (group % 6);
+        for (uint64_t choice = 0; choice < numberOfRows; ++choice, ++row) {
+            uint64_t const numberOfEntries = (group * 3 + choice) % 19;
+            for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                matrixBuilder.addNextValue(row, (group * 17 + choice) % 20 + entry * 25, 0.01 + 0.001 * ((group + entry) % 13));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build(row, numberOfRowGroups, numberOfRowGroups);
+    std::vector<double> b(matrix.getRowCount()), x(matrix.getColumnCount());
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<double>((i * 31 + 2) % 97) / 97.0;
+    }
+    for (uint64_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<double>((i * 31 + 1) % 97) / 97.0;
+    }
+
+    // Compute reference results without vector instructions.
+    storm::utility::simd::InstructionSet defaultInstructionSet = storm::utility::simd::getInstructionSet();
+    storm::utility::simd::setInstructionSet(storm::utility::simd::InstructionSet::None);
+    std::vector<double> expected(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    std::vector<std::vector<double>> expectedReduced;
+    std::vector<std::vector<uint64_t>> expectedChoices;
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+        std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, result, &choices);
+        expectedReduced.push_back(result);
+        expectedChoices.push_back(choices);
+    }
+
+    for (auto instructionSet : {storm::utility::simd::InstructionSet::Avx2, storm::utility::simd::InstructionSet::Avx512}) {
+        if (!storm::utility::simd::isSupported(instructionSet)) {
+            STORM_SILENT_EXPECT_THROW(storm::utility::simd::setInstructionSet(instructionSet), storm::exceptions::NotSupportedException);
+            continue;
+        }
+        storm::utility::simd::setInstructionSet(instructionSet);
+        EXPECT_EQ(instructionSet, storm::utility::simd::getInstructionSet());
+
+        // Vectorized kernels sum up the entries of a row in a different order, so we compare up to a tolerance.
+        std::vector<double> result(matrix.getRowCount());
+        matrix.multiplyWithVector(x, result, &b);
+        for (uint64_t i = 0; i < result.size(); ++i) {
+            EXPECT_NEAR(expected[i], result[i], 1e-12);
+        }
+        std::fill(result.begin(), result.end(), 0.0);
+        matrix.multiplyWithVectorRange(0, 13, x, result, &b);
+        matrix.multiplyWithVectorRange(13, matrix.getRowCount(), x, result, &b);
+        for (uint64_t i = 0; i < result.size(); ++i) {
+            EXPECT_NEAR(expected[i], result[i], 1e-12);
+        }
+
+        uint64_t dirIndex = 0;
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<double> reduced(matrix.getRowGroupCount(), 0.0), reducedWithChoices(matrix.getRowGroupCount(), 0.0);
+            std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+            matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, reduced, nullptr);
+            matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, reducedWithChoices, &choices);
+            for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+                EXPECT_NEAR(expectedReduced[dirIndex][group], reduced[group], 1e-12);
+                EXPECT_NEAR(expectedReduced[dirIndex][group], reducedWithChoices[group], 1e-12);
+            }
+            EXPECT_EQ(expectedChoices[dirIndex], choices);
+
+            // Gauss-Seidel style multiplications, where the input and output vectors coincide.
+            std::vector<double> expectedX = x, vectorizedX = x;
+            storm::utility::simd::setInstructionSet(storm::utility::simd::InstructionSet::None);
+            matrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), expectedX, &b, expectedX, nullptr);
+            matrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), expectedX, &b, expectedX, nullptr);
+            storm::utility::simd::setInstructionSet(instructionSet);
+            matrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), vectorizedX, &b, vectorizedX, nullptr);
+            matrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), vectorizedX, &b, vectorizedX, nullptr);
+            for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+                EXPECT_NEAR(expectedX[group], vectorizedX[group], 1e-12);
+            }
+            ++dirIndex;
+        }
+    }
+    storm::utility::simd::setInstructionSet(defaultInstructionSet);
+}
@@ -1,5 +1,9 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
+
+#include <algorithm>
+#include <random>
+
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
@@ -86,3 +90,82 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, MultipleThreads) {
+    // Generate a system with many SCCs of different sizes, trivial SCCs and selfloops.
+    uint64_t const numberOfStates = 2000;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint64_t> successorCountDistribution(0, 3);
+    std::uniform_int_distribution<int64_t> offsetDistribution(-8, 30);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::vector<uint64_t> successors;
+        uint64_t successorCount = successorCountDistribution(generator);
+        for (uint64_t i = 0; i < successorCount; ++i) {
+            int64_t successor = static_cast<int64_t>(state) + offsetDistribution(generator);
+            if (successor >= 0 && successor < static_cast<int64_t>(numberOfStates)) {
+                successors.push_back(static_cast<uint64_t>(successor));
+            }
+        }
+        std::sort(successors.begin(), successors.end());
+        successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+        for (auto const& successor : successors) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(state, successor, 1.0 / successors.size()));
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    for (uint64_t state = 0; state < numberOfStates; state += 7) {
+        subsystem.set(state, false);
+    }
+    
+    auto compareDecompositions = [&matrix] (storm::storage::StronglyConnectedComponentDecompositionOptions options) {
+        options.forceTopologicalSort().computeSccDepths();
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options);
+        options.numberOfThreads(4);
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options);
+        
+        ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+        EXPECT_GT(parallelDecomposition.size(), 1ul);
+        
+        std::vector<uint64_t> sequentialStateToScc(matrix.getRowGroupCount(), parallelDecomposition.size());
+        for (uint64_t sccIndex = 0; sccIndex < sequentialDecomposition.size(); ++sccIndex) {
+            for (auto const& state : sequentialDecomposition[sccIndex]) {
+                sequentialStateToScc[state] = sccIndex;
+            }
+        }
+        std::vector<uint64_t> parallelStateToScc(matrix.getRowGroupCount(), parallelDecomposition.size());
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            for (auto const& state : parallelDecomposition[sccIndex]) {
+                parallelStateToScc[state] = sccIndex;
+            }
+        }
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            auto const& scc = parallelDecomposition[sccIndex];
+            ASSERT_FALSE(scc.empty());
+            // The sequential decomposition needs to find the same SCC with the same depth.
+            uint64_t sequentialSccIndex = sequentialStateToScc[*scc.begin()];
+            ASSERT_LT(sequentialSccIndex, sequentialDecomposition.size());
+            EXPECT_TRUE(scc == sequentialDecomposition[sequentialSccIndex]);
+            EXPECT_EQ(scc.isTrivial(), sequentialDecomposition[sequentialSccIndex].isTrivial());
+            EXPECT_EQ(sequentialDecomposition.getSccDepth(sequentialSccIndex), parallelDecomposition.getSccDepth(sccIndex));
+            // The SCCs need to be sorted topologically and successor SCCs need to have smaller depths.
+            for (auto const& state : scc) {
+                for (auto const& entry : matrix.getRow(state)) {
+                    uint64_t successorSccIndex = parallelStateToScc[entry.getColumn()];
+                    if (successorSccIndex != sccIndex && successorSccIndex < parallelDecomposition.size()) {
+                        EXPECT_LT(successorSccIndex, sccIndex);
+                        EXPECT_LT(parallelDecomposition.getSccDepth(successorSccIndex), parallelDecomposition.getSccDepth(sccIndex));
+                    }
+                }
+            }
+        }
+    };
+    
+    compareDecompositions(storm::storage::StronglyConnectedComponentDecompositionOptions());
+    compareDecompositions(storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(&subsystem));
+    compareDecompositions(storm::storage::StronglyConnectedComponentDecompositionOptions().dropNaiveSccs());
+    compareDecompositions(storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+}
@@ -12,6 +12,9 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/utility/graph.h"
+#include "storm/modelchecker/helper/utility/GraphAnalysisCache.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -668,3 +671,93 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitAnalysisCache) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build()->as<storm::models::sparse::Mdp<double>>();
+    storm::storage::SparseMatrix<double> const& transitionMatrix = static_cast<storm::models::sparse::Mdp<double> const&>(*mdp).getTransitionMatrix();
+    storm::storage::SparseMatrix<double> backwardTransitions = mdp->getBackwardTransitions();
+    storm::storage::BitVector allStates(mdp->getNumberOfStates(), true);
+    storm::storage::BitVector targetStates = mdp->getStates("all_coins_equal_0");
+    
+    auto& cache = mdp->getGraphAnalysisCache();
+    storm::Environment env;
+    env.modelchecker().setAnalysisCacheSize(1024 * 1024);
+    
+    auto expected = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, targetStates);
+    for (uint64_t i = 0; i < 2; ++i) {
+        auto statesWithProbability01 = cache.performProb01Max(env, transitionMatrix, backwardTransitions, allStates, targetStates);
+        EXPECT_EQ(expected.first, statesWithProbability01.first);
+        EXPECT_EQ(expected.second, statesWithProbability01.second);
+    }
+    expected = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, targetStates);
+    auto statesWithProbability01 = cache.performProb01Min(env, transitionMatrix, backwardTransitions, allStates, targetStates);
+    EXPECT_EQ(expected.first, statesWithProbability01.first);
+    EXPECT_EQ(expected.second, statesWithProbability01.second);
+    
+    auto mecDecomposition = cache.getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, ~targetStates);
+    EXPECT_EQ(storm::storage::MaximalEndComponentDecomposition<double>(transitionMatrix, backwardTransitions, ~targetStates).size(), mecDecomposition->size());
+    EXPECT_EQ(mecDecomposition, cache.getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, ~targetStates));
+    EXPECT_EQ(2ull, cache.getNumberOfHits());
+    EXPECT_EQ(3ull, cache.getNumberOfMisses());
+    EXPECT_LE(cache.getSize(), 1024ull * 1024ull);
+    
+    // Requests on other matrices are neither answered from nor stored in the cache.
+    storm::storage::SparseMatrix<double> otherMatrix = transitionMatrix;
+    EXPECT_NE(mecDecomposition, cache.getMaximalEndComponentDecomposition(env, otherMatrix, backwardTransitions, ~targetStates));
+    EXPECT_EQ(2ull, cache.getNumberOfHits());
+    EXPECT_EQ(3ull, cache.getNumberOfMisses());
+    
+    // Reducing the budget evicts the least recently used results.
+    uint64_t reducedBudget = cache.getSize() / 2;
+    env.modelchecker().setAnalysisCacheSize(reducedBudget);
+    cache.performProb01Min(env, transitionMatrix, backwardTransitions, allStates, targetStates);
+    EXPECT_LE(cache.getSize(), reducedBudget);
+    
+    // Accessing the matrix for modification drops all results.
+    env.modelchecker().setAnalysisCacheSize(1024 * 1024);
+    mecDecomposition = cache.getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, ~targetStates);
+    EXPECT_LT(0ull, cache.getSize());
+    mdp->getTransitionMatrix();
+    EXPECT_EQ(0ull, cache.getSize());
+    EXPECT_NE(mecDecomposition, cache.getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, ~targetStates));
+    
+    // The backward transitions are cached as well.
+    auto cachedBackwardTransitions = cache.getBackwardTransitions(env, transitionMatrix);
+    EXPECT_EQ(backwardTransitions, *cachedBackwardTransitions);
+    EXPECT_EQ(cachedBackwardTransitions, cache.getBackwardTransitions(env, transitionMatrix));
+    
+    // A copy of the model has its own cache, so modifying the copy keeps the results of the original.
+    mecDecomposition = cache.getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, ~targetStates);
+    uint64_t sizeOfOriginal = cache.getSize();
+    storm::models::sparse::Mdp<double> copy(*mdp);
+    auto& copyCache = copy.getGraphAnalysisCache();
+    EXPECT_NE(&cache, &copyCache);
+    EXPECT_EQ(0ull, copyCache.getSize());
+    copy.getTransitionMatrix();
+    EXPECT_EQ(sizeOfOriginal, cache.getSize());
+    EXPECT_EQ(mecDecomposition, cache.getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, ~targetStates));
+    
+    // The copy caches results for its own matrix only.
+    storm::storage::SparseMatrix<double> const& copyMatrix = static_cast<storm::models::sparse::Mdp<double> const&>(copy).getTransitionMatrix();
+    copyCache.getMaximalEndComponentDecomposition(env, copyMatrix, backwardTransitions, ~targetStates);
+    EXPECT_LT(0ull, copyCache.getSize());
+    copyCache.clear();
+    copyCache.getMaximalEndComponentDecomposition(env, transitionMatrix, backwardTransitions, ~targetStates);
+    EXPECT_EQ(0ull, copyCache.getSize());
+    
+    // The same holds for moved models.
+    storm::models::sparse::Mdp<double> moved(std::move(copy));
+    EXPECT_EQ(0ull, moved.getGraphAnalysisCache().getSize());
+    storm::storage::SparseMatrix<double> const& movedMatrix = static_cast<storm::models::sparse::Mdp<double> const&>(moved).getTransitionMatrix();
+    moved.getGraphAnalysisCache().getMaximalEndComponentDecomposition(env, movedMatrix, backwardTransitions, ~targetStates);
+    EXPECT_LT(0ull, moved.getGraphAnalysisCache().getSize());
+    
+    // Without a budget, nothing is cached.
+    cache.clear();
+    env.modelchecker().setAnalysisCacheSize(0);
+    cache.performProb01Max(env, transitionMatrix, backwardTransitions, allStates, targetStates);
+    EXPECT_EQ(0ull, cache.getSize());
+    EXPECT_EQ(0ull, cache.getNumberOfMisses());
+}
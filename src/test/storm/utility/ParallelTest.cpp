@@ -0,0 +1,79 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/utility/parallel.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+TEST(ParallelTest, processInOrder) {
+    uint64_t const numberOfTasks = 50;
+    for (uint64_t numberOfThreads : {1, 4}) {
+        std::vector<uint64_t> results(numberOfTasks, 0);
+        std::vector<uint64_t> reportedTasks;
+        std::vector<uint64_t> reportedResults;
+        std::atomic<uint64_t> concurrentReports(0);
+        storm::utility::parallel::processInOrder(numberOfThreads, numberOfTasks, [&] (uint64_t task) {
+            // Tasks with a small index take longer, so later tasks are usually processed first.
+            std::this_thread::sleep_for(std::chrono::microseconds((numberOfTasks - task) % 7 * 100));
+            results[task] = task * task;
+        }, [&] (uint64_t task) {
+            EXPECT_EQ(0ull, concurrentReports++);
+            reportedTasks.push_back(task);
+            reportedResults.push_back(results[task]);
+            --concurrentReports;
+        });
+
+        ASSERT_EQ(numberOfTasks, reportedTasks.size());
+        for (uint64_t task = 0; task < numberOfTasks; ++task) {
+            EXPECT_EQ(task, reportedTasks[task]);
+            EXPECT_EQ(task * task, reportedResults[task]);
+        }
+    }
+}
+
+TEST(ParallelTest, processInOrderException) {
+    uint64_t const numberOfTasks = 50;
+    std::vector<uint64_t> reportedTasks;
+    EXPECT_THROW(storm::utility::parallel::processInOrder(4, numberOfTasks, [] (uint64_t task) {
+        if (task == 10) {
+            throw std::runtime_error("Task failed.");
+        }
+    }, [&] (uint64_t task) {
+        reportedTasks.push_back(task);
+    }), std::runtime_error);
+
+    // The failed task and its successors are never reported.
+    EXPECT_LE(reportedTasks.size(), 10ull);
+    for (uint64_t index = 0; index < reportedTasks.size(); ++index) {
+        EXPECT_EQ(index, reportedTasks[index]);
+    }
+}
+
+#ifdef __linux__
+TEST(ParallelTest, ThreadPoolPinning) {
+    cpu_set_t originalAffinity;
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(cpu_set_t), &originalAffinity));
+    storm::utility::parallel::ThreadPool pool(4, true);
+    std::vector<int> processors(pool.getNumberOfThreads(), -1);
+    pool.run([&processors] (uint64_t threadIndex) {
+        processors[threadIndex] = sched_getcpu();
+    });
+    // All threads run on processors the calling thread was allowed to use.
+    for (int processor : processors) {
+        ASSERT_LE(0, processor);
+        EXPECT_TRUE(CPU_ISSET(processor, &originalAffinity));
+    }
+
+    // The affinity of the calling thread is left untouched, also by nested pools.
+    storm::utility::parallel::ThreadPool nestedPool(2, true);
+    cpu_set_t callerAffinity;
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(cpu_set_t), &callerAffinity));
+    EXPECT_TRUE(CPU_EQUAL(&originalAffinity, &callerAffinity));
+}
+#endif